@@ -240,6 +240,61 @@ dnnl_status_t DNNL_API dnnl_primitive_get_cache_blob(
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_primitive_destroy(dnnl_primitive_t primitive);
 
+/// Starts recording primitive executions submitted to a stream.
+///
+/// Until #dnnl_stream_end_capture() is called, #dnnl_primitive_execute()
+/// calls on the stream record the primitive together with its arguments
+/// instead of executing it. The recorded sequence can then be executed as a
+/// whole with #dnnl_stream_capture_replay(), which skips argument
+/// conversion and scratchpad setup for every primitive.
+///
+/// @note
+///     Only CPU streams support capturing. Executing a compiled partition of
+///     the graph API on a stream that is being captured returns
+///     #dnnl_unimplemented.
+///
+/// @param stream Stream to record executions of.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_begin_capture(dnnl_stream_t stream);
+
+/// Stops recording primitive executions submitted to a stream and returns
+/// the recorded sequence.
+///
+/// @param stream Stream that is being captured.
+/// @param capture Output stream capture.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_end_capture(
+        dnnl_stream_t stream, dnnl_stream_capture_t *capture);
+
+/// Executes a recorded sequence of primitive executions.
+///
+/// The primitives are executed in the recording order with the memory
+/// objects passed at recording time. Data handles of these memory objects
+/// may be changed between replays, but the memory objects themselves must
+/// stay alive as long as the stream capture is used.
+///
+/// @note
+///     All the replays of a stream capture share its execution contexts and
+///     scratchpad, so a stream capture must not be replayed concurrently.
+///
+/// @param capture Stream capture to execute.
+/// @param stream Stream to use. Must be the stream the sequence was recorded
+///     on.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_capture_replay(
+        const_dnnl_stream_capture_t capture, dnnl_stream_t stream);
+
+/// Destroys a stream capture.
+///
+/// @param capture Stream capture to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_capture_destroy(
+        dnnl_stream_capture_t capture);
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_attributes
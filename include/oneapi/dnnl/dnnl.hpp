@@ -88,6 +88,13 @@ struct handle_traits<dnnl_primitive_t> {
     }
 };
 
+template <>
+struct handle_traits<dnnl_stream_capture_t> {
+    static dnnl_status_t destructor(dnnl_stream_capture_t p) {
+        return dnnl_stream_capture_destroy(p);
+    }
+};
+
 /// @endcond
 
 /// @} dnnl_api_utils
@@ -255,6 +262,54 @@ std::vector<uint8_t> primitive::get_cache_blob() const {
     return cache_blob;
 }
 
+/// A sequence of primitive executions recorded on a stream.
+///
+/// While a stream is being captured, primitive executions submitted to it
+/// are recorded instead of executed. Replaying the capture executes the
+/// whole sequence with arguments and scratchpads resolved at recording time,
+/// which removes most of the per-primitive dispatching overhead. This is
+/// useful for models made of many small primitives, e.g. batch-1 inference.
+///
+/// @note
+///     Only CPU streams support capturing, and graph API compiled partitions
+///     cannot be executed on a stream that is being captured.
+///
+/// Example:
+/// @code
+///     stream_capture::begin(strm);
+///     for (auto &p : net)
+///         p.first.execute(strm, p.second);
+///     auto capture = stream_capture::end(strm);
+///     for (int iter = 0; iter < n_iters; ++iter)
+///         capture.replay(strm);
+/// @endcode
+struct stream_capture : public handle<dnnl_stream_capture_t> {
+    using handle::handle;
+
+    /// Constructs an empty stream capture. An empty stream capture cannot be
+    /// used in any operations.
+    stream_capture() = default;
+
+    /// Starts recording primitive executions submitted to a stream.
+    ///
+    /// @param astream Stream to record executions of.
+    static void begin(stream &astream);
+
+    /// Stops recording primitive executions submitted to a stream.
+    ///
+    /// @param astream Stream that is being captured.
+    /// @returns The recorded sequence of primitive executions.
+    static stream_capture end(stream &astream);
+
+    /// Executes the recorded sequence of primitive executions. Memory
+    /// objects passed at recording time must still be alive, but their data
+    /// handles may have changed. A stream capture must not be replayed
+    /// concurrently.
+    ///
+    /// @param astream Stream the sequence was recorded on.
+    void replay(stream &astream) const;
+};
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_attributes
@@ -599,6 +654,9 @@ enum class rnn_flags : unsigned {
     undef = dnnl_rnn_flags_undef,
     /// Do not add weights gradient to existing diff_weights memory
     diff_weights_overwrite = dnnl_rnn_flags_diff_weights_overwrite,
+    /// Use per-sample sequence lengths passed as #DNNL_ARG_SEQ_LENGTHS
+    /// (forward inference only)
+    seq_lengths = dnnl_rnn_flags_seq_lengths,
 };
 
 /// Converts RNN cell flags enum value from C++ API to C API type.
@@ -9278,6 +9336,14 @@ struct rnn_primitive_desc_base : public primitive_desc {
         return base::query_md(query::exec_arg_md, DNNL_ARG_AUGRU_ATTENTION);
     }
 
+    /// Returns sequence lengths memory descriptor.
+    /// @returns Sequence lengths memory descriptor.
+    /// @returns A zero memory descriptor if the primitive was not created
+    ///          with #dnnl::rnn_flags::seq_lengths.
+    memory::desc seq_lengths_desc() const {
+        return base::query_md(query::exec_arg_md, DNNL_ARG_SEQ_LENGTHS);
+    }
+
     /// Returns source iteration memory descriptor.
     /// @returns Source iteration memory descriptor.
     /// @returns A zero memory descriptor if the primitive does not have a
@@ -10486,6 +10552,66 @@ struct lstm_forward : public primitive {
                     bias_desc, dst_layer_desc, dst_iter_desc, &dst_iter_c_desc,
                     rnn_flags::undef, 0.0f, 0.0f, attr, allow_empty) {}
 
+        /// Constructs a primitive descriptor for an LSTM forward propagation
+        ///     primitive with RNN flags.
+        ///
+        /// With #dnnl::rnn_flags::seq_lengths, the primitive takes an
+        /// additional #DNNL_ARG_SEQ_LENGTHS s32 argument of shape [mb] with
+        /// the number of valid time steps of each sample. Time steps past the
+        /// length of a sample do not update its states and produce zeros in
+        /// the output vector, so that the output recurrent states hold the
+        /// states of the last valid time step. The flag is only supported
+        /// for #dnnl::prop_kind::forward_inference. Sorting samples by
+        /// decreasing length lets the implementation skip inactive samples.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training, and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param direction RNN direction. See @ref dnnl::rnn_direction for
+        ///     more info.
+        /// @param src_layer_desc Memory descriptor for the input vector.
+        /// @param src_iter_desc Memory descriptor for the input recurrent
+        ///     hidden state vector.
+        /// @param src_iter_c_desc Memory descriptor for the input recurrent
+        ///     cell state vector.
+        /// @param weights_layer_desc Memory descriptor for the weights
+        ///     applied to the layer input.
+        /// @param weights_iter_desc Memory descriptor for the weights applied
+        ///     to the recurrent input.
+        /// @param bias_desc Bias memory descriptor.
+        /// @param dst_layer_desc Memory descriptor for the output vector.
+        /// @param dst_iter_desc Memory descriptor for the output recurrent
+        ///     hidden state vector.
+        /// @param dst_iter_c_desc Memory descriptor for the output recurrent
+        ///     cell state vector.
+        /// @param flags Unused for LSTM primitive, except for
+        ///     #dnnl::rnn_flags::seq_lengths.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, prop_kind aprop_kind,
+                rnn_direction direction, const memory::desc &src_layer_desc,
+                const memory::desc &src_iter_desc,
+                const memory::desc &src_iter_c_desc,
+                const memory::desc &weights_layer_desc,
+                const memory::desc &weights_iter_desc,
+                const memory::desc &bias_desc,
+                const memory::desc &dst_layer_desc,
+                const memory::desc &dst_iter_desc,
+                const memory::desc &dst_iter_c_desc, rnn_flags flags,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : rnn_primitive_desc_base(aengine, algorithm::vanilla_lstm,
+                    aprop_kind, algorithm::undef, direction, src_layer_desc,
+                    src_iter_desc, &src_iter_c_desc, nullptr,
+                    weights_layer_desc, weights_iter_desc, nullptr, nullptr,
+                    bias_desc, dst_layer_desc, dst_iter_desc, &dst_iter_c_desc,
+                    flags, 0.0f, 0.0f, attr, allow_empty) {}
+
         /// Constructs a primitive descriptor for an LSTM forward propagation
         /// primitive from a C API primitive descriptor that must have a
         /// matching kind.
@@ -10502,6 +10628,11 @@ struct lstm_forward : public primitive {
             return rnn_base::src_layer_desc();
         }
 
+        /// @copydoc dnnl::rnn_primitive_desc_base::seq_lengths_desc()const
+        memory::desc seq_lengths_desc() const {
+            return rnn_base::seq_lengths_desc();
+        }
+
         /// @copydoc dnnl::rnn_primitive_desc_base::src_iter_desc()const
         memory::desc src_iter_desc() const { return rnn_base::src_iter_desc(); }
 
@@ -11126,6 +11257,56 @@ struct gru_forward : public primitive {
                     dst_layer_desc, dst_iter_desc, nullptr, rnn_flags::undef,
                     0.0f, 0.0f, attr, allow_empty) {}
 
+        /// Constructs a primitive descriptor for a GRU forward propagation
+        ///     primitive with RNN flags.
+        ///
+        /// With #dnnl::rnn_flags::seq_lengths, the primitive takes an
+        /// additional #DNNL_ARG_SEQ_LENGTHS s32 argument of shape [mb] with
+        /// the number of valid time steps of each sample. See
+        /// @ref dnnl::lstm_forward::primitive_desc for the semantics.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training, and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param direction RNN direction. See @ref dnnl::rnn_direction for
+        ///     more info.
+        /// @param src_layer_desc Memory descriptor for the input vector.
+        /// @param src_iter_desc Memory descriptor for the input recurrent
+        ///     hidden state vector.
+        /// @param weights_layer_desc Memory descriptor for the weights
+        ///     applied to the layer input.
+        /// @param weights_iter_desc Memory descriptor for the weights applied
+        ///     to the recurrent input.
+        /// @param bias_desc Bias memory descriptor.
+        /// @param dst_layer_desc Memory descriptor for the output vector.
+        /// @param dst_iter_desc Memory descriptor for the output recurrent
+        ///     hidden state vector.
+        /// @param flags Unused for GRU primitive, except for
+        ///     #dnnl::rnn_flags::seq_lengths.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, prop_kind aprop_kind,
+                rnn_direction direction, const memory::desc &src_layer_desc,
+                const memory::desc &src_iter_desc,
+                const memory::desc &weights_layer_desc,
+                const memory::desc &weights_iter_desc,
+                const memory::desc &bias_desc,
+                const memory::desc &dst_layer_desc,
+                const memory::desc &dst_iter_desc, rnn_flags flags,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : rnn_primitive_desc_base(aengine, algorithm::vanilla_gru,
+                    aprop_kind, algorithm::undef, direction, src_layer_desc,
+                    src_iter_desc, nullptr, nullptr, weights_layer_desc,
+                    weights_iter_desc, nullptr, nullptr, bias_desc,
+                    dst_layer_desc, dst_iter_desc, nullptr, flags, 0.0f, 0.0f,
+                    attr, allow_empty) {}
+
         /// Constructs a primitive descriptor for a GRU forward propagation
         /// primitive from a C API primitive descriptor that must have a
         /// matching kind.
@@ -11142,6 +11323,11 @@ struct gru_forward : public primitive {
             return rnn_base::src_layer_desc();
         }
 
+        /// @copydoc dnnl::rnn_primitive_desc_base::seq_lengths_desc()const
+        memory::desc seq_lengths_desc() const {
+            return rnn_base::seq_lengths_desc();
+        }
+
         /// @copydoc dnnl::rnn_primitive_desc_base::src_iter_desc()const
         memory::desc src_iter_desc() const { return rnn_base::src_iter_desc(); }
 
@@ -14007,6 +14193,23 @@ inline void primitive::execute(const stream &astream,
             "could not execute a primitive");
 }
 
+inline void stream_capture::begin(stream &astream) {
+    error::wrap_c_api(dnnl_stream_begin_capture(astream.get()),
+            "could not begin capturing a stream");
+}
+
+inline stream_capture stream_capture::end(stream &astream) {
+    dnnl_stream_capture_t c_capture;
+    error::wrap_c_api(dnnl_stream_end_capture(astream.get(), &c_capture),
+            "could not end capturing a stream");
+    return stream_capture(c_capture);
+}
+
+inline void stream_capture::replay(stream &astream) const {
+    error::wrap_c_api(dnnl_stream_capture_replay(get(), astream.get()),
+            "could not replay a stream capture");
+}
+
 /// @endcond
 
 #undef DNNL_DEFINE_BITMASK_OPS
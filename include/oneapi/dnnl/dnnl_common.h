@@ -101,6 +101,38 @@ dnnl_status_t DNNL_API dnnl_stream_get_engine(
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_stream_wait(dnnl_stream_t stream);
 
+/// Restricts the primitives executed on a CPU stream to a team of threads, so
+/// that primitives executed concurrently on several streams do not
+/// oversubscribe the threads of the process.
+///
+/// During an execution on the stream, the library functions querying the
+/// number of threads return at most the team size, and the parallel regions
+/// run in a TBB task arena of the team size.
+///
+/// @note
+///     Thread teams are only supported by the TBB and sequential threading
+///     runtimes. OpenMP and threadpool primitives rely on running with the
+///     number of threads they were created for, so the team could not bound
+///     their execution.
+///
+/// @param stream Execution stream.
+/// @param nthr Number of threads in the team. Zero removes the restriction.
+/// @returns #dnnl_unimplemented for GPU streams, SYCL CPU streams and the
+///     OpenMP and threadpool runtimes, #dnnl_success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_stream_set_thread_team(
+        dnnl_stream_t stream, int nthr);
+
+/// Returns the number of threads in the team of a stream.
+///
+/// @param stream Execution stream.
+/// @param nthr Output number of threads in the team, or zero if the stream is
+///     not restricted to a team.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_get_thread_team(
+        const_dnnl_stream_t stream, int *nthr);
+
 /// Destroys an execution stream.
 ///
 /// @param stream Execution stream to destroy.
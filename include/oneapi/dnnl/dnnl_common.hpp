@@ -369,6 +369,32 @@ struct stream : public handle<dnnl_stream_t> {
                 dnnl_stream_wait(get()), "could not wait on a stream");
         return *this;
     }
+
+    /// Restricts the primitives executed on a CPU stream to a team of
+    /// threads. See #dnnl_stream_set_thread_team for details.
+    ///
+    /// @note
+    ///     With the OpenMP and threadpool runtimes, primitives created as
+    ///     usual are not restricted to the team, only the primitives created
+    ///     with at most @p nthr threads available are.
+    ///
+    /// @param nthr Number of threads in the team. Zero removes the
+    ///     restriction.
+    /// @returns The stream itself.
+    stream &set_thread_team(int nthr) {
+        error::wrap_c_api(dnnl_stream_set_thread_team(get(), nthr),
+                "could not set a thread team of a stream");
+        return *this;
+    }
+
+    /// Returns the number of threads in the team of the stream, or zero if
+    /// the stream is not restricted to a team.
+    int get_thread_team() const {
+        int nthr = 0;
+        error::wrap_c_api(dnnl_stream_get_thread_team(get(), &nthr),
+                "could not get a thread team of a stream");
+        return nthr;
+    }
 };
 
 //NOLINTBEGIN(bugprone-macro-parentheses)
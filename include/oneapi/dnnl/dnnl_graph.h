@@ -50,6 +50,38 @@ dnnl_status_t DNNL_API dnnl_graph_allocator_create(
         dnnl_graph_host_allocate_f host_malloc,
         dnnl_graph_host_deallocate_f host_free);
 
+/// Creates a host allocator serving the temporary buffers from an arena. The
+/// arena keeps the freed buffers and reuses them for the later requests of a
+/// close size instead of returning them to the system. The large buffers are
+/// backed by 2MB huge pages where the system supports it. The memory held by
+/// the arena is released when the allocator and the engines created with it
+/// are destroyed. The other buffers, like the cached constant tensors, are
+/// allocated with the default host allocation functions.
+///
+/// @note
+///     Engines created with the same allocator share its arena.
+///
+/// @param allocator Output allocator.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_allocator_create_with_arena(
+        dnnl_graph_allocator_t *allocator);
+
+/// Returns the statistics of the arena of an allocator created with
+/// #dnnl_graph_allocator_create_with_arena.
+///
+/// @param allocator The allocator.
+/// @param num_requests Output number of the buffers requested from the arena.
+/// @param num_hits Output number of the requests served by reused buffers.
+/// @param resident_size Output size in bytes of the memory held by the arena.
+///     It includes the freed buffers kept for reuse, up to 256 MiB beyond
+///     which the largest of them are returned to the system.
+/// @returns #dnnl_invalid_arguments if the allocator has no arena, and
+///     #dnnl_success on success.
+dnnl_status_t DNNL_API dnnl_graph_allocator_get_arena_stats(
+        const_dnnl_graph_allocator_t allocator, size_t *num_requests,
+        size_t *num_hits, size_t *resident_size);
+
 /// Destroys an allocator.
 ///
 /// @param allocator The allocator to be destroyed.
@@ -510,6 +542,10 @@ dnnl_status_t DNNL_API dnnl_graph_compiled_partition_create(
 
 /// Executes a compiled partition.
 ///
+/// @note
+///     Returns #dnnl_unimplemented if the stream is being captured with
+///     #dnnl_stream_begin_capture().
+///
 /// @param compiled_partition The handle of target compiled partition.
 /// @param stream The stream used for execution.
 /// @param num_inputs The number of input tensors.
@@ -691,6 +727,83 @@ dnnl_status_t DNNL_API dnnl_graph_graph_get_partitions(dnnl_graph_graph_t graph,
 
 /// @} dnnl_graph_api_graph
 
+/// @addtogroup dnnl_graph_api_compiled_graph
+/// @{
+
+/// Creates a compiled graph which compiles all the partitions of a graph and
+/// plans the memory of the tensors passed between them. The graph must have
+/// been partitioned and all its partitions must be supported. The tensors
+/// which are neither inputs nor outputs of the graph are placed in a single
+/// buffer owned by the compiled graph, where tensors which are not alive at
+/// the same time share memory.
+///
+/// @param compiled_graph Output compiled graph.
+/// @param graph The partitioned graph.
+/// @param engine The engine used to compile the partitions.
+/// @param num_inputs The number of input logical tensors.
+/// @param inputs A list of logical tensors for the inputs of the graph. They
+///     must have complete shapes and layouts.
+/// @param num_outputs The number of output logical tensors.
+/// @param outputs A list of logical tensors for the outputs of the graph.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_compiled_graph_create(
+        dnnl_graph_compiled_graph_t *compiled_graph, dnnl_graph_graph_t graph,
+        dnnl_engine_t engine, size_t num_inputs,
+        const dnnl_graph_logical_tensor_t **inputs, size_t num_outputs,
+        const dnnl_graph_logical_tensor_t **outputs);
+
+/// Executes all the partitions of a compiled graph in a topological order.
+/// The same compiled graph must not be executed concurrently since the
+/// executions would share the intermediate buffer.
+///
+/// @param compiled_graph The handle of target compiled graph.
+/// @param stream The stream used for execution.
+/// @param num_inputs The number of input tensors.
+/// @param inputs A list of input tensors.
+/// @param num_outputs The number of output tensors.
+/// @param outputs A non-empty list of output tensors.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_compiled_graph_execute(
+        const_dnnl_graph_compiled_graph_t compiled_graph, dnnl_stream_t stream,
+        size_t num_inputs, const_dnnl_graph_tensor_t *inputs,
+        size_t num_outputs, const_dnnl_graph_tensor_t *outputs);
+
+/// Queries an input or output logical tensor of a compiled graph according to
+/// tensor ID. If the tensor ID doesn't belong to any input or output of the
+/// compiled graph, an error status #dnnl_invalid_arguments will be returned by
+/// the API.
+///
+/// @param compiled_graph The handle of target compiled graph.
+/// @param tid The unique id of required tensor.
+/// @param lt The output logical tensor.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_compiled_graph_query_logical_tensor(
+        const_dnnl_graph_compiled_graph_t compiled_graph, size_t tid,
+        dnnl_graph_logical_tensor_t *lt);
+
+/// Returns the size in bytes of the buffer holding the intermediate tensors
+/// of a compiled graph.
+///
+/// @param compiled_graph The handle of target compiled graph.
+/// @param size Output size of the buffer.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_compiled_graph_get_memory_size(
+        const_dnnl_graph_compiled_graph_t compiled_graph, size_t *size);
+
+/// Destroys a compiled graph.
+///
+/// @param compiled_graph The compiled graph to be destroyed.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_compiled_graph_destroy(
+        dnnl_graph_compiled_graph_t compiled_graph);
+
+/// @} dnnl_graph_api_compiled_graph
+
 /// @addtogroup dnnl_graph_api_compiled_partition_cache
 /// @{
 
@@ -771,6 +884,19 @@ dnnl_status_t DNNL_API dnnl_graph_set_constant_tensor_cache_capacity(
 dnnl_status_t DNNL_API dnnl_graph_get_constant_tensor_cache_capacity(
         dnnl_engine_kind_t eng_kind, size_t *size);
 
+/// Return the size in bytes of the cached constant tensors which are shared
+/// by several compiled partitions. Compiled partitions computing the same
+/// constant tensors from the same input buffers use a single cached copy. The
+/// returned size is the memory that would be used in addition if each
+/// compiled partition cached its own copy.
+///
+/// @param eng_kind The engine kind that the constant tensor cache used for.
+/// @param size The shared size to query.
+/// @returns #dnnl_invalid_arguments if the @p size is nullptr, and
+/// #dnnl_success on success.
+dnnl_status_t DNNL_API dnnl_graph_get_constant_tensor_cache_shared_size(
+        dnnl_engine_kind_t eng_kind, size_t *size);
+
 /// @} dnnl_graph_api_constant_tensor_cache
 
 /// @} dnnl_graph_api
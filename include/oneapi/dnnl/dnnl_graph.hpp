@@ -96,6 +96,13 @@ struct graph_handle_traits<dnnl_graph_compiled_partition_t> {
     }
 };
 
+template <>
+struct graph_handle_traits<dnnl_graph_compiled_graph_t> {
+    static dnnl_status_t destructor(dnnl_graph_compiled_graph_t p) {
+        return dnnl_graph_compiled_graph_destroy(p);
+    }
+};
+
 template <>
 struct graph_handle_traits<dnnl_graph_allocator_t> {
     static dnnl_status_t destructor(dnnl_graph_allocator_t p) {
@@ -113,6 +120,7 @@ DNNL_GRAPH_HANDLE_ALIAS(op);
 DNNL_GRAPH_HANDLE_ALIAS(tensor);
 DNNL_GRAPH_HANDLE_ALIAS(compiled_partition);
 DNNL_GRAPH_HANDLE_ALIAS(partition);
+DNNL_GRAPH_HANDLE_ALIAS(compiled_graph);
 
 #undef DNNL_GRAPH_HANDLE_ALIAS
 
@@ -189,8 +197,44 @@ public:
                 "could not create allocator");
         reset(a);
     }
+
+    /// Statistics of the arena of an allocator
+    struct arena_stats {
+        /// Number of the buffers requested from the arena
+        size_t num_requests;
+        /// Number of the requests served by reused buffers
+        size_t num_hits;
+        /// Size in bytes of the memory held by the arena, including the
+        /// freed buffers kept for reuse up to 256 MiB
+        size_t resident_size;
+    };
+
+    /// Returns the statistics of the arena of an allocator created with
+    /// #dnnl::graph::make_arena_allocator.
+    ///
+    /// @returns The statistics of the arena.
+    arena_stats get_arena_stats() const {
+        arena_stats stats {};
+        error::wrap_c_api(dnnl_graph_allocator_get_arena_stats(get(),
+                                  &stats.num_requests, &stats.num_hits,
+                                  &stats.resident_size),
+                "could not get arena stats of allocator");
+        return stats;
+    }
 };
 
+/// Creates a host allocator serving the temporary buffers from an arena
+/// which reuses the freed buffers and backs the large ones with huge pages.
+/// See #dnnl_graph_allocator_create_with_arena for details.
+///
+/// @returns The created allocator.
+inline allocator make_arena_allocator() {
+    dnnl_graph_allocator_t a = nullptr;
+    error::wrap_c_api(dnnl_graph_allocator_create_with_arena(&a),
+            "could not create allocator with arena");
+    return allocator(a);
+}
+
 /// @} dnnl_graph_api_allocator
 
 /// @addtogroup dnnl_graph_api_engine Engine
@@ -236,6 +280,7 @@ class logical_tensor {
     friend class tensor;
     friend class partition;
     friend class compiled_partition;
+    friend class compiled_graph;
 
     dnnl_graph_logical_tensor_t data;
 
@@ -860,6 +905,8 @@ public:
         Wildcard = dnnl_graph_op_wildcard,
         GenIndex = dnnl_graph_op_gen_index,
         GreaterEqual = dnnl_graph_op_greater_equal,
+        EmbeddingBag = dnnl_graph_op_embedding_bag,
+        TopK = dnnl_graph_op_top_k,
         // Sentinel
         LastSymbol = dnnl_graph_op_last_symbol,
     };
@@ -904,6 +951,8 @@ public:
         begin_norm_axis = dnnl_graph_op_attr_begin_norm_axis,
         /// Specifies a groups attribute to an op.
         groups = dnnl_graph_op_attr_groups,
+        /// Specifies a k attribute to an op.
+        k = dnnl_graph_op_attr_k,
 
         // int64_t vector attributes. The value of these attributes can be a
         // vector of int64 numbers.
@@ -1547,6 +1596,115 @@ private:
 
 /// @} dnnl_graph_api_graph
 
+/// @addtogroup dnnl_graph_api_compiled_graph Compiled Graph
+///
+/// A compiled graph owns the compiled partitions of a whole graph and executes
+/// them in a single call. The tensors passed between the partitions are placed
+/// in a buffer owned by the compiled graph, where the tensors which are not
+/// alive at the same time share memory.
+///
+/// @{
+
+/// A compiled graph object.
+class compiled_graph : public compiled_graph_handle {
+public:
+    /// Default constructor. Constructs an empty object.
+    compiled_graph() = default;
+
+    /// Constructs a compiled graph object
+    compiled_graph(dnnl_graph_compiled_graph_t compiled_graph) {
+        reset(compiled_graph, false);
+    }
+
+    /// Compiles all the partitions of a partitioned graph. All the
+    /// partitions must be supported.
+    ///
+    /// @param agraph The graph. #dnnl::graph::graph::get_partitions() must
+    ///     have been called on it.
+    /// @param aengine The engine used to compile the partitions.
+    /// @param inputs Logical tensors of the graph inputs. They must have
+    ///     complete shapes and layouts.
+    /// @param outputs Logical tensors of the graph outputs.
+    compiled_graph(graph &agraph, const engine &aengine,
+            const std::vector<logical_tensor> &inputs,
+            const std::vector<logical_tensor> &outputs) {
+        std::vector<const dnnl_graph_logical_tensor_t *> c_inputs;
+        std::vector<const dnnl_graph_logical_tensor_t *> c_outputs;
+
+        c_inputs.reserve(inputs.size());
+        for (const auto &in : inputs) {
+            c_inputs.push_back(&(in.data));
+        }
+
+        c_outputs.reserve(outputs.size());
+        for (const auto &out : outputs) {
+            c_outputs.push_back(&(out.data));
+        }
+
+        dnnl_graph_compiled_graph_t cg = nullptr;
+        error::wrap_c_api(
+                dnnl_graph_compiled_graph_create(&cg, agraph.get(),
+                        aengine.get(), c_inputs.size(), c_inputs.data(),
+                        c_outputs.size(), c_outputs.data()),
+                "could not create a compiled graph");
+        reset(cg);
+    }
+
+    /// Queries an input or output logical tensor of the graph according to
+    /// tensor ID. If the tensor ID doesn't belong to any input or output of
+    /// the compiled graph, an exception will be raised by the API.
+    ///
+    /// @param tid The unique id of required tensor.
+    /// @returns The logical tensor.
+    logical_tensor query_logical_tensor(size_t tid) const {
+        dnnl_graph_logical_tensor_t lt;
+        error::wrap_c_api(dnnl_graph_compiled_graph_query_logical_tensor(
+                                  get(), tid, &lt),
+                "query logical tensor from compiled_graph failed");
+        return logical_tensor {lt};
+    }
+
+    /// Returns the size in bytes of the buffer holding the tensors passed
+    /// between the partitions.
+    ///
+    /// @returns The size of the buffer.
+    size_t get_memory_size() const {
+        size_t size = 0;
+        error::wrap_c_api(
+                dnnl_graph_compiled_graph_get_memory_size(get(), &size),
+                "could not get the memory size of a compiled graph");
+        return size;
+    }
+
+    /// Executes all the partitions of the graph. The same compiled graph
+    /// must not be executed concurrently.
+    ///
+    /// @param astream Stream object to run over.
+    /// @param inputs A list of input tensors.
+    /// @param outputs A list of output tensors.
+    void execute(stream &astream, const std::vector<tensor> &inputs,
+            const std::vector<tensor> &outputs) const {
+        std::vector<const_dnnl_graph_tensor_t> c_inputs;
+        c_inputs.reserve(inputs.size());
+        for (auto &in : inputs) {
+            c_inputs.push_back(in.get());
+        }
+        std::vector<const_dnnl_graph_tensor_t> c_outputs;
+        c_outputs.reserve(outputs.size());
+        for (auto &out : outputs) {
+            c_outputs.push_back(out.get());
+        }
+
+        error::wrap_c_api(
+                dnnl_graph_compiled_graph_execute(get(), astream.get(),
+                        c_inputs.size(), c_inputs.data(), c_outputs.size(),
+                        c_outputs.data()),
+                "could not execute the compiled_graph");
+    }
+};
+
+/// @} dnnl_graph_api_compiled_graph
+
 /// @addtogroup dnnl_graph_api_compiled_partition_cache Compiled Partition Cache
 ///
 /// A set of functions that provide compiled partition cache control.
@@ -1630,6 +1788,18 @@ inline size_t get_constant_tensor_cache_capacity(engine::kind kind) {
     return size;
 }
 
+/// Return the size in bytes of the cached constant tensors which are shared
+/// by several compiled partitions instead of being cached for each of them.
+///
+/// @param kind The engine kind that the constant tensor cache used for.
+inline size_t get_constant_tensor_cache_shared_size(engine::kind kind) {
+    size_t size = 0;
+    error::wrap_c_api(dnnl_graph_get_constant_tensor_cache_shared_size(
+                              static_cast<dnnl_engine_kind_t>(kind), &size),
+            "fail to get constant tensor cache shared size");
+    return size;
+}
+
 /// @} dnnl_graph_api_constant_tensor_cache
 
 } // namespace graph
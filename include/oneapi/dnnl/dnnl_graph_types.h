@@ -261,6 +261,8 @@ typedef enum {
     dnnl_graph_op_group_norm,
     dnnl_graph_op_gen_index,
     dnnl_graph_op_greater_equal,
+    dnnl_graph_op_embedding_bag,
+    dnnl_graph_op_top_k,
     dnnl_graph_op_last_symbol,
 } dnnl_graph_op_kind_t;
 
@@ -300,6 +302,8 @@ typedef enum {
     dnnl_graph_op_attr_begin_norm_axis,
     /// Specifies a groups attribute to an op.
     dnnl_graph_op_attr_groups,
+    /// Specifies a k attribute to an op.
+    dnnl_graph_op_attr_k,
 
     // int64_t vector attributes. The value of these attributes can be a vector
     // of int64 numbers.
@@ -455,6 +459,21 @@ typedef const struct dnnl_graph_compiled_partition
 
 /// @} dnnl_graph_api_compiled_partition
 
+/// @addtogroup dnnl_graph_api_compiled_graph
+/// @{
+
+/// An opaque structure to describe a compiled graph.
+struct dnnl_graph_compiled_graph;
+
+/// A compiled graph handle.
+typedef struct dnnl_graph_compiled_graph *dnnl_graph_compiled_graph_t;
+
+/// A constant compiled graph handle.
+typedef const struct dnnl_graph_compiled_graph
+        *const_dnnl_graph_compiled_graph_t;
+
+/// @} dnnl_graph_api_compiled_graph
+
 /// @addtogroup dnnl_graph_api_tensor
 /// @{
 
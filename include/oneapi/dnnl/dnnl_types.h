@@ -2344,6 +2344,9 @@ typedef enum {
     dnnl_rnn_flags_undef = 0x0,
     /// Do not add weights gradient to existing diff_weights memory
     dnnl_rnn_flags_diff_weights_overwrite = 0x1,
+    /// Use per-sample sequence lengths passed as #DNNL_ARG_SEQ_LENGTHS
+    /// (forward inference only)
+    dnnl_rnn_flags_seq_lengths = 0x2,
 } dnnl_rnn_flags_t;
 
 /// A direction of RNN primitive execution.
@@ -2474,6 +2477,15 @@ typedef struct dnnl_primitive *dnnl_primitive_t;
 /// A constant primitive handle.
 typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 
+/// @struct dnnl_stream_capture
+/// An opaque structure to describe a sequence of primitive executions
+/// recorded on a stream.
+struct dnnl_stream_capture;
+/// A stream capture handle.
+typedef struct dnnl_stream_capture *dnnl_stream_capture_t;
+/// A constant stream capture handle.
+typedef const struct dnnl_stream_capture *const_dnnl_stream_capture_t;
+
 /// Undefined argument.
 #define DNNL_ARG_UNDEF 0
 /// Source argument #0.
@@ -2506,6 +2518,12 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// #DNNL_ARG_SRC_3.
 #define DNNL_ARG_AUGRU_ATTENTION DNNL_ARG_SRC_3
 
+/// Source argument #4.
+#define DNNL_ARG_SRC_4 5
+/// A special mnemonic for RNN per-sample sequence lengths (a 1D s32 tensor of
+/// shape [mb]). An alias for #DNNL_ARG_SRC_4.
+#define DNNL_ARG_SEQ_LENGTHS DNNL_ARG_SRC_4
+
 /// Destination argument #0.
 #define DNNL_ARG_DST_0 17
 /// A special mnemonic for destination argument for primitives that have a
@@ -238,6 +238,14 @@ def func_to_str(enum, values):
             '%sif (v == dnnl::impl::primitive_kind::sdpa) return "sdpa";\n'
             % indent
         )
+        func += (
+            '%sif (v == dnnl::impl::primitive_kind::gather) return "gather";\n'
+            % indent
+        )
+        func += (
+            '%sif (v == dnnl::impl::primitive_kind::topk) return "topk";\n'
+            % indent
+        )
     if enum == "dnnl_alg_kind_t":
         func += (
             '%sif (v == dnnl::impl::alg_kind::softmax_accurate_inf_as_zero) return "softmax_accurate_inf_as_zero";\n'
@@ -1927,6 +1927,7 @@ namespace rnn_flags {
 const rnn_flags_t undef = dnnl_rnn_flags_undef;
 const rnn_flags_t diff_weights_overwrite
         = dnnl_rnn_flags_diff_weights_overwrite;
+const rnn_flags_t seq_lengths = dnnl_rnn_flags_seq_lengths;
 } // namespace rnn_flags
 
 using engine_kind_t = dnnl_engine_kind_t;
@@ -1985,6 +1986,8 @@ const primitive_kind_t group_normalization = dnnl_group_normalization;
 const primitive_kind_t internal_only_start = (primitive_kind_t)(1 << 12);
 const primitive_kind_t zero_pad = internal_only_start;
 const primitive_kind_t sdpa = (primitive_kind_t)(internal_only_start + 1);
+const primitive_kind_t gather = (primitive_kind_t)(internal_only_start + 2);
+const primitive_kind_t topk = (primitive_kind_t)(internal_only_start + 3);
 } // namespace primitive_kind
 
 using query_t = dnnl_query_t;
@@ -2093,6 +2096,7 @@ const stream_flags_t profiling = static_cast<stream_flags_t>(1 << 2);
 #endif
 } // namespace stream_flags
 using stream_t = dnnl_stream;
+using stream_capture_t = dnnl_stream_capture;
 
 struct memory_storage_t;
 
@@ -2113,6 +2117,7 @@ struct deconvolution_pd_t;
 struct eltwise_bwd_pd_t;
 struct eltwise_fwd_pd_t;
 struct eltwise_pd_t;
+struct gather_pd_t;
 struct gemm_pd_t;
 struct group_normalization_bwd_pd_t;
 struct group_normalization_fwd_pd_t;
@@ -2143,6 +2148,7 @@ struct softmax_bwd_pd_t;
 struct softmax_fwd_pd_t;
 struct softmax_pd_t;
 struct sum_pd_t;
+struct topk_pd_t;
 
 } // namespace impl
 } // namespace dnnl
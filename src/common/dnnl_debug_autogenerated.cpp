@@ -1786,6 +1786,8 @@ const char *dnnl_prim_kind2str(dnnl_primitive_kind_t v) {
     if (v == dnnl_group_normalization) return "group_normalization";
     if (v == dnnl_primitive_kind_max) return "primitive_kind_max";
     if (v == dnnl::impl::primitive_kind::sdpa) return "sdpa";
+    if (v == dnnl::impl::primitive_kind::gather) return "gather";
+    if (v == dnnl::impl::primitive_kind::topk) return "topk";
     assert(!"unknown prim_kind");
     return "unknown prim_kind";
 }
@@ -1870,6 +1872,7 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
 const char *dnnl_rnn_flags2str(dnnl_rnn_flags_t v) {
     if (v == dnnl_rnn_flags_undef) return "undef";
     if (v == dnnl_rnn_flags_diff_weights_overwrite) return "rnn_flags_diff_weights_overwrite";
+    if (v == dnnl_rnn_flags_seq_lengths) return "rnn_flags_seq_lengths";
     assert(!"unknown rnn_flags");
     return "unknown rnn_flags";
 }
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <memory>
 #include <mutex>
 
 #include "utils.hpp"
@@ -52,6 +53,20 @@
 #include "common/ittnotify.hpp"
 #endif
 
+// The size of the thread team of the calling thread, which restricts the
+// number of threads used by the primitives it executes. It is set by a CPU
+// stream with a thread team for the duration of each execution on the stream.
+// Zero means no restriction.
+inline int &dnnl_thr_team_size() {
+    static thread_local int team_size = 0;
+    return team_size;
+}
+
+inline int dnnl_thr_apply_team(int nthr) {
+    const int team_size = dnnl_thr_team_size();
+    return team_size > 0 && team_size < nthr ? team_size : nthr;
+}
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ
 #define DNNL_THR_SYNC 1
 inline int dnnl_get_max_threads() {
@@ -81,7 +96,7 @@ inline void dnnl_thr_barrier() {
 
 #define DNNL_THR_SYNC 0
 inline int dnnl_get_max_threads() {
-    return tbb::this_task_arena::max_concurrency();
+    return dnnl_thr_apply_team(tbb::this_task_arena::max_concurrency());
 }
 inline int dnnl_in_parallel() {
     return 0;
@@ -90,6 +105,18 @@ inline void dnnl_thr_barrier() {
     assert(!"no barrier in TBB");
 }
 
+// Returns the arena running the parallel regions of the thread team of the
+// calling thread. The arena is reused while the team size does not change.
+inline tbb::task_arena &dnnl_thr_team_arena(int team_size) {
+    static thread_local std::unique_ptr<tbb::task_arena> arena;
+    static thread_local int arena_size = 0;
+    if (!arena || arena_size != team_size) {
+        arena.reset(new tbb::task_arena(team_size));
+        arena_size = team_size;
+    }
+    return *arena;
+}
+
 #elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 #include <thread>
 #include "oneapi/dnnl/dnnl_threadpool_iface.hpp"
@@ -165,7 +192,7 @@ inline int dnnl_get_current_num_threads() {
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
     return omp_get_max_threads();
 #elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
-    return tbb::this_task_arena::max_concurrency();
+    return dnnl_thr_apply_team(tbb::this_task_arena::max_concurrency());
 #elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
     using namespace dnnl::impl::threadpool_utils;
     dnnl::threadpool_interop::threadpool_iface *tp = get_active_threadpool();
@@ -301,21 +328,31 @@ static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
 #endif
     }
 #elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
-    tbb::parallel_for(
-            0, nthr,
-            [&](int ithr) {
+    auto tbb_parallel = [&]() {
+        tbb::parallel_for(
+                0, nthr,
+                [&](int ithr) {
 #if defined(DNNL_ENABLE_ITT_TASKS)
-                bool mark_task = itt::primitive_task_get_current_kind()
-                        == primitive_kind::undefined;
-                if (mark_task && itt_enable)
-                    itt::primitive_task_start(task_primitive_kind);
+                    bool mark_task = itt::primitive_task_get_current_kind()
+                            == primitive_kind::undefined;
+                    if (mark_task && itt_enable)
+                        itt::primitive_task_start(task_primitive_kind);
 #endif
-                f(ithr, nthr);
+                    f(ithr, nthr);
 #if defined(DNNL_ENABLE_ITT_TASKS)
-                if (mark_task && itt_enable) itt::primitive_task_end();
+                    if (mark_task && itt_enable) itt::primitive_task_end();
 #endif
-            },
-            tbb::static_partitioner());
+                },
+                tbb::static_partitioner());
+    };
+    // The work of a thread team runs in an arena of the team size, so that
+    // neither the primitives created for more threads nor the nested parallel
+    // regions use threads outside of the team
+    const int team_size = dnnl_thr_team_size();
+    if (team_size > 0 && team_size < tbb::this_task_arena::max_concurrency())
+        dnnl_thr_team_arena(team_size).execute(tbb_parallel);
+    else
+        tbb_parallel();
 #elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
     using namespace dnnl::impl::threadpool_utils;
     dnnl::threadpool_interop::threadpool_iface *tp = get_active_threadpool();
@@ -0,0 +1,161 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_GATHER_PD_HPP
+#define COMMON_GATHER_PD_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/gather_utils.hpp"
+#include "common/primitive_desc.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define VDISPATCH_GATHER(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, gather, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+#define VDISPATCH_GATHER_SC(f, msg, ...) \
+    VCHECK(primitive, create, dispatch, gather, (f), "%s," msg, \
+            this->info(engine), ##__VA_ARGS__)
+
+// NOLINTBEGIN(google-default-arguments)
+struct gather_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::gather;
+
+    using base_class = gather_pd_t;
+    using hint_class = gather_pd_t;
+
+    const gather_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::alg_kind:
+                *(alg_kind_t *)result = desc()->alg_kind;
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (utils::one_of(arg, DNNL_ARG_TABLE, DNNL_ARG_INDICES))
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_OFFSETS)
+            return with_offsets() ? arg_usage_t::input : arg_usage_t::unused;
+
+        if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_TABLE: return src_md(0);
+            case DNNL_ARG_INDICES: return src_md(1);
+            case DNNL_ARG_OFFSETS: return src_md(2);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        switch (index) {
+            case 0: return &desc_.src_desc;
+            case 1: return &desc_.indices_desc;
+            case 2: return &desc_.offsets_desc;
+            default: return &glob_zero_md;
+        }
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        return index == 0 ? &desc_.dst_desc : &glob_zero_md;
+    }
+
+    const memory_desc_t *table_md() const { return &desc_.src_desc; }
+    const memory_desc_t *indices_md() const { return &desc_.indices_desc; }
+    const memory_desc_t *offsets_md() const { return &desc_.offsets_desc; }
+
+    int n_inputs() const override {
+        return 2 + int(with_offsets()) + n_binary_po_inputs();
+    }
+    int n_outputs() const override { return 1; }
+
+    /// If true, indices are grouped into bags and reduced (embedding bag)
+    bool with_offsets() const {
+        return offsets_md()->data_type != data_type::undef;
+    }
+
+    /// If true, the table is dequantized with per-row or common scales
+    bool with_scales() const {
+        return !attr()->scales_.has_default_values(DNNL_ARG_TABLE);
+    }
+
+    /// If true, the table is dequantized with per-row or common zero points
+    bool with_zero_points() const {
+        return !attr()->zero_points_.has_default_values(DNNL_ARG_TABLE);
+    }
+
+    dim_t rows() const { return desc_.rows(); }
+    dim_t cols() const { return desc_.cols(); }
+    dim_t n_indices() const { return desc_.n_indices(); }
+    dim_t n_bags() const { return desc_.n_bags(); }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(dst_md()).has_zero_dim();
+    }
+
+protected:
+    gather_desc_t desc_;
+
+    gather_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd_pd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*op_desc_t::to_desc<gather_desc_t>(adesc)) {}
+
+    bool set_default_formats() {
+        bool ok = true;
+
+        for (auto md : {&desc_.src_desc, &desc_.indices_desc, &desc_.dst_desc,
+                     &desc_.offsets_desc}) {
+            memory_desc_wrapper mdw(md);
+            if (mdw.format_any())
+                ok = ok && memory_desc_init_by_strides(*md, nullptr)
+                                == status::success;
+        }
+
+        auto status = attr_.post_ops_.set_default_formats(&desc_.dst_desc);
+        ok = ok && (status == status::success);
+
+        return ok;
+    }
+};
+// NOLINTEND(google-default-arguments)
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
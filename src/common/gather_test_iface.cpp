@@ -0,0 +1,42 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/gather_pd.hpp"
+#include "common/gather_types.hpp"
+#include "common/gather_utils.hpp"
+#include "common/primitive_desc_iface.hpp"
+#include "opdesc.hpp"
+
+using dnnl::impl::status_t;
+using namespace dnnl::impl;
+
+dnnl_status_t DNNL_API gather_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t table_desc,
+        const_dnnl_memory_desc_t indices_desc,
+        const_dnnl_memory_desc_t offsets_desc,
+        const_dnnl_memory_desc_t dst_desc, dnnl_alg_kind_t alg_kind,
+        const_dnnl_primitive_attr_t attr) {
+    CHECK(gather_desc_check(
+            table_desc, indices_desc, offsets_desc, dst_desc, alg_kind));
+    CHECK(gather_attr_check(table_desc, engine, attr));
+
+    dnnl::impl::gather_desc_t gather_desc = dnnl::impl::create_gather_desc(
+            table_desc, indices_desc, offsets_desc, dst_desc, alg_kind);
+    return dnnl::impl::primitive_desc_create(primitive_desc_iface, engine,
+            (const dnnl::impl::op_desc_t *)&gather_desc, nullptr, attr);
+}
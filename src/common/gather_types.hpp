@@ -0,0 +1,75 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_GATHER_TYPES_HPP
+#define COMMON_GATHER_TYPES_HPP
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc.hpp"
+#include "common/opdesc.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// The lookup table is passed as DNNL_ARG_SRC so that regular attribute
+// arguments (DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, ...) apply to it.
+#define DNNL_ARG_TABLE DNNL_ARG_SRC_0
+#define DNNL_ARG_INDICES DNNL_ARG_SRC_1
+#define DNNL_ARG_OFFSETS DNNL_ARG_SRC_2
+
+// A descriptor for a gather (embedding lookup) operation.
+//
+// The table is a 2D tensor of shape [rows, cols]. Each entry of the 1D
+// indices tensor selects a row of the table.
+// - Without offsets, selected rows are copied to the destination of shape
+//   [n_indices, cols] (plain gather).
+// - With offsets (a 1D tensor of shape [n_bags]), indices are split into
+//   bags: bag `b` covers indices [offsets[b], offsets[b + 1]) and the last bag
+//   ends at n_indices. Rows of each bag are reduced with `alg_kind` into the
+//   destination of shape [n_bags, cols] (embedding bag). Offsets are clamped
+//   to [0, n_indices] and a bag ending before its beginning is empty.
+struct gather_desc_t : public op_desc_t {
+    gather_desc_t() : op_desc_t(primitive_kind::gather) {}
+
+    std::unique_ptr<op_desc_t> clone() const override {
+        return utils::make_unique<gather_desc_t>(*this);
+    }
+
+    memory_desc_t src_desc; /* table */
+    memory_desc_t indices_desc;
+    memory_desc_t offsets_desc;
+    memory_desc_t dst_desc;
+
+    // One of reduction_sum, reduction_mean or reduction_max. Ignored when
+    // offsets are not provided.
+    alg_kind_t alg_kind = alg_kind::undef;
+
+    // Number of rows in the table.
+    dim_t rows() const { return src_desc.dims[0]; }
+    // Number of elements in a row of the table.
+    dim_t cols() const { return src_desc.dims[1]; }
+    // Total number of indices.
+    dim_t n_indices() const { return indices_desc.dims[0]; }
+    // Number of output rows.
+    dim_t n_bags() const { return dst_desc.dims[0]; }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif // COMMON_GATHER_TYPES_HPP
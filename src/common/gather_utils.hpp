@@ -0,0 +1,169 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_GATHER_UTILS_HPP
+#define COMMON_GATHER_UTILS_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/gather_types.hpp"
+#include "common/primitive_attr.hpp"
+#include "common/primitive_desc_iterator.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define VCHECK_GATHER(f, msg, ...) \
+    VCHECK(primitive, create, check, gather, (f), msg, ##__VA_ARGS__);
+
+#define VCHECK_GATHER_COND(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, gather, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+#define VCHECK_GATHER_UNIMPL(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, gather, (cond), \
+            status::unimplemented, msg, ##__VA_ARGS__);
+
+static inline status_t gather_desc_check(const memory_desc_t *table_desc,
+        const memory_desc_t *indices_desc, const memory_desc_t *offsets_desc,
+        const memory_desc_t *dst_desc, alg_kind_t alg_kind) {
+    using namespace data_type;
+
+    VCHECK_GATHER_COND(
+            !memory_desc_wrapper(table_desc).has_runtime_dims_or_strides()
+                    && !memory_desc_wrapper(indices_desc)
+                                .has_runtime_dims_or_strides()
+                    && !memory_desc_wrapper(dst_desc)
+                                .has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VCHECK_GATHER_COND(table_desc->ndims == 2, VERBOSE_BAD_NDIMS, "table",
+            table_desc->ndims);
+    VCHECK_GATHER_COND(indices_desc->ndims == 1, VERBOSE_BAD_NDIMS, "indices",
+            indices_desc->ndims);
+    VCHECK_GATHER_COND(
+            dst_desc->ndims == 2, VERBOSE_BAD_NDIMS, "dst", dst_desc->ndims);
+    VCHECK_GATHER_COND(indices_desc->data_type == s32,
+            VERBOSE_INVALID_DATATYPE, "indices");
+    VCHECK_GATHER_COND(dst_desc->dims[1] == table_desc->dims[1],
+            VERBOSE_INCONSISTENT_DIM, "dst", 1, "table", 1);
+
+    const bool with_offsets
+            = offsets_desc && offsets_desc->data_type != data_type::undef;
+    if (with_offsets) {
+        VCHECK_GATHER_COND(offsets_desc->ndims == 1, VERBOSE_BAD_NDIMS,
+                "offsets", offsets_desc->ndims);
+        VCHECK_GATHER_COND(offsets_desc->data_type == s32,
+                VERBOSE_INVALID_DATATYPE, "offsets");
+        VCHECK_GATHER_COND(dst_desc->dims[0] == offsets_desc->dims[0],
+                VERBOSE_INCONSISTENT_DIM, "dst", 0, "offsets", 0);
+        VCHECK_GATHER_COND(utils::one_of(alg_kind, alg_kind::reduction_sum,
+                                   alg_kind::reduction_mean,
+                                   alg_kind::reduction_max),
+                VERBOSE_BAD_ALGORITHM);
+    } else {
+        VCHECK_GATHER_COND(dst_desc->dims[0] == indices_desc->dims[0],
+                VERBOSE_INCONSISTENT_DIM, "dst", 0, "indices", 0);
+    }
+
+    return status::success;
+}
+
+static inline status_t gather_attr_check(const memory_desc_t *table_desc,
+        const engine_t *engine, const primitive_attr_t *attr) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+    using namespace data_type;
+
+    if (attr == nullptr) return status::success;
+
+    VCHECK_GATHER_UNIMPL(attr->has_default_values(smask_t::scales_data_type
+                                 | smask_t::zero_points_data_type
+                                 | smask_t::post_ops),
+            VERBOSE_UNSUPPORTED_ATTR);
+
+    // Only the table may be dequantized, either with a single value or with
+    // one value per row.
+    const auto &sc = attr->scales_;
+    VCHECK_GATHER_UNIMPL(sc.has_default_values({DNNL_ARG_TABLE}),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    if (!sc.has_default_values(DNNL_ARG_TABLE)) {
+        VCHECK_GATHER_UNIMPL(utils::one_of(sc.get_mask(DNNL_ARG_TABLE), 0, 1)
+                        && sc.has_default_groups(DNNL_ARG_TABLE)
+                        && utils::one_of(sc.get_data_type(DNNL_ARG_TABLE), f32,
+                                bf16, f16),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+    }
+
+    const auto &zp = attr->zero_points_;
+    VCHECK_GATHER_UNIMPL(zp.has_default_values({DNNL_ARG_TABLE}),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+    if (!zp.has_default_values(DNNL_ARG_TABLE)) {
+        VCHECK_GATHER_UNIMPL(utils::one_of(zp.get_mask(DNNL_ARG_TABLE), 0, 1)
+                        && zp.has_default_groups(DNNL_ARG_TABLE)
+                        && utils::one_of(zp.get_data_type(DNNL_ARG_TABLE), s32,
+                                s8, u8, s4, u4)
+                        && utils::one_of(
+                                table_desc->data_type, s8, u8, s4, u4),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+    }
+
+    return status::success;
+}
+
+static inline gather_desc_t create_gather_desc(const memory_desc_t *table_md,
+        const memory_desc_t *indices_md, const memory_desc_t *offsets_md,
+        const memory_desc_t *dst_md, alg_kind_t alg_kind) {
+    auto gather_desc = gather_desc_t();
+    gather_desc.primitive_kind = primitive_kind::gather;
+    gather_desc.src_desc = *table_md;
+    gather_desc.indices_desc = *indices_md;
+    if (offsets_md) gather_desc.offsets_desc = *offsets_md;
+    gather_desc.dst_desc = *dst_md;
+    gather_desc.alg_kind
+            = gather_desc.offsets_desc.data_type == data_type::undef
+            ? alg_kind::undef
+            : alg_kind;
+    return gather_desc;
+}
+
+static inline status_t create_gather_pd(
+        std::shared_ptr<primitive_desc_t> &gather_pd_, engine_t *engine,
+        const memory_desc_t *table_md, const memory_desc_t *indices_md,
+        const memory_desc_t *offsets_md, const memory_desc_t *dst_md,
+        alg_kind_t alg_kind, const primitive_attr_t *attr) {
+    CHECK(gather_desc_check(
+            table_md, indices_md, offsets_md, dst_md, alg_kind));
+    CHECK(gather_attr_check(table_md, engine, attr));
+
+    auto gather_desc = create_gather_desc(
+            table_md, indices_md, offsets_md, dst_md, alg_kind);
+
+    primitive_attr_t gather_attr = attr ? *attr : default_attr();
+
+    primitive_desc_iterator_t it(
+            engine, (op_desc_t *)&gather_desc, &gather_attr, nullptr);
+
+    gather_pd_ = *(++it);
+    VCHECK_GATHER_COND(gather_pd_, "failed to create the gather primitive");
+
+    return status::success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -233,6 +233,7 @@ enum {
     key_eltwise_src,
     key_fusion_forward_scratchpad,
     key_fusion_inout_buffer,
+    key_gather_acc,
     key_gemm_asm_tmp_buffer,
     key_gemm_tmp_buffer,
     key_gemm_blocked_a,
@@ -248,6 +249,7 @@ enum {
     key_gemm_pretransposed_rhs,
     key_gemm_transposed_1xwrhs,
     key_generic_acc,
+    key_gnorm_channel_stats,
     key_gnorm_cvt,
     key_gnorm_reduction,
     key_gnorm_tmp_mean,
@@ -321,6 +323,8 @@ enum {
     key_softmax_interim_store,
     key_sum_reduction,
     key_sum_srcs_cvt,
+    key_topk_idx,
+    key_topk_val,
     key_wino_U,
     key_wino_V,
     key_wino_M,
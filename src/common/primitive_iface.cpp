@@ -199,6 +199,10 @@ status_t dnnl_primitive_execute(const primitive_iface_t *primitive_iface,
             primitive_iface->pd()->impl().get(), nargs, c_args, args);
     if (status != status::success) return status;
 
+    // the execution is only recorded while the stream is captured
+    if (stream->capture())
+        return stream->capture()->record(primitive_iface, std::move(args));
+
     stream->before_exec_hook();
 
     exec_ctx_t ctx(stream, std::move(args));
@@ -328,9 +332,13 @@ status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
     } else if (scratchpad_) {
         mem_storage = scratchpad_->get_memory_storage();
     }
+    return execute(ctx, mem_storage);
+}
 
+status_t dnnl_primitive::execute(
+        exec_ctx_t &ctx, const memory_storage_t *scratchpad) const {
     auto scratchpad_grantor
-            = primitive_->pd()->scratchpad_registry().grantor(mem_storage, ctx);
+            = primitive_->pd()->scratchpad_registry().grantor(scratchpad, ctx);
     ctx.set_scratchpad_grantor(&scratchpad_grantor);
     ctx.set_resource_mapper(&resource_mapper_);
 
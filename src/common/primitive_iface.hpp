@@ -65,6 +65,10 @@ struct dnnl_primitive : public dnnl::impl::c_compatible {
     dnnl::impl::status_t get_cache_blob(
             dnnl::impl::cache_blob_t cache_blob) const;
     dnnl::impl::status_t execute(dnnl::impl::exec_ctx_t &ctx) const;
+    // Executes with a scratchpad provided by the caller instead of the one
+    // owned by the primitive (see stream capture).
+    dnnl::impl::status_t execute(dnnl::impl::exec_ctx_t &ctx,
+            const dnnl::impl::memory_storage_t *scratchpad) const;
 
     void retain() { counter_++; }
 
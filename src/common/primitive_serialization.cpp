@@ -35,6 +35,7 @@ status_t serialize_desc(
         CASE(convolution)
         CASE(deconvolution)
         CASE(eltwise)
+        CASE(gather)
         CASE(gemm)
         CASE(group_normalization)
         CASE(inner_product)
@@ -51,6 +52,7 @@ status_t serialize_desc(
         CASE(shuffle)
         CASE(softmax)
         CASE(sum)
+        CASE(topk)
         default: return status::invalid_arguments;
     }
 #undef CASE
@@ -246,6 +248,20 @@ void serialize(serialization_stream_t &sstream, const concat_desc_t &desc) {
         serialize(sstream, *desc.src_mds[i]);
 }
 
+void serialize(serialization_stream_t &sstream, const topk_desc_t &desc) {
+    // Kinds
+    sstream.append(desc.primitive_kind);
+    sstream.append(desc.alg_kind);
+    // Memory descriptors
+    serialize(sstream, desc.src_desc);
+    serialize(sstream, desc.dst_desc);
+    serialize(sstream, desc.dst_indices_desc);
+    // Selection
+    sstream.append(desc.axis);
+    sstream.append(desc.k);
+    sstream.append(desc.with_softmax);
+}
+
 void serialize(serialization_stream_t &sstream,
         const batch_normalization_desc_t &desc) {
     // Kinds
@@ -571,6 +587,17 @@ void serialize(serialization_stream_t &sstream, const sum_desc_t &desc) {
         serialize(sstream, *desc.src_mds[i]);
 }
 
+void serialize(serialization_stream_t &sstream, const gather_desc_t &desc) {
+    // Kinds
+    sstream.append(desc.primitive_kind);
+    sstream.append(desc.alg_kind);
+    // Memory descriptors
+    serialize(sstream, desc.src_desc);
+    serialize(sstream, desc.indices_desc);
+    serialize(sstream, desc.offsets_desc);
+    serialize(sstream, desc.dst_desc);
+}
+
 void serialize(serialization_stream_t &sstream, const sdpa_desc_t &desc) {
     // Kind
     sstream.append(desc.primitive_kind);
@@ -49,9 +49,11 @@ void serialize(serialization_stream_t &sstream, const reduction_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const reorder_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const resampling_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const rnn_desc_t &desc);
+void serialize(serialization_stream_t &sstream, const gather_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const sdpa_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const shuffle_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const softmax_desc_t &desc);
+void serialize(serialization_stream_t &sstream, const topk_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const sum_desc_t &desc);
 
 status_t serialize_desc(
@@ -330,6 +330,13 @@ status_t rnn_common_fwd_desc_init(rnn_desc_t *rnn_desc, prop_kind_t prop_kind,
                 "num_layers != 1");
     }
 
+    // Per-sample sequence lengths are only supported for inference: the
+    // workspace layout of training does not account for inactive samples.
+    if (flags & rnn_flags::seq_lengths) {
+        VCONDCHECK_RNN(prop_kind == prop_kind::forward_inference,
+                VERBOSE_BAD_PROPKIND);
+    }
+
     VCHECK_RNN(
             check_runtime_dims_or_strides({src_layer_desc, src_iter_desc,
                     src_iter_c_desc, weights_layer_desc, weights_iter_desc,
@@ -450,6 +457,8 @@ status_t rnn_common_bwd_desc_init(rnn_desc_t *rnn_desc, prop_kind_t prop_kind,
     VCONDCHECK_RNN(
             xnor_md(dst_iter_c_desc, diff_dst_iter_c_desc), VERBOSE_NULL_ARG);
 
+    VCONDCHECK_RNN(!(flags & rnn_flags::seq_lengths), VERBOSE_BAD_FLAGS);
+
     VCHECK_RNN(check_runtime_dims_or_strides({src_layer_desc, src_iter_desc,
                        src_iter_c_desc, attention_desc, weights_layer_desc,
                        weights_iter_desc, weights_peephole_desc,
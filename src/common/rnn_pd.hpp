@@ -211,6 +211,10 @@ struct rnn_pd_t : public primitive_desc_t {
         return desc_.flags & rnn_flags::diff_weights_overwrite;
     }
 
+    bool with_seq_lengths() const {
+        return desc_.flags & rnn_flags::seq_lengths;
+    }
+
     dnnl_rnn_direction_t direction() const { return desc_.direction; }
 
 protected:
@@ -268,6 +272,10 @@ struct rnn_fwd_pd_t : public rnn_pd_t {
         if (arg == DNNL_ARG_SRC_ITER_C)
             return with_src_iter_c() ? arg_usage_t::input : arg_usage_t::unused;
 
+        if (arg == DNNL_ARG_SEQ_LENGTHS)
+            return with_seq_lengths() ? arg_usage_t::input
+                                      : arg_usage_t::unused;
+
         if (utils::one_of(arg, DNNL_ARG_WEIGHTS_LAYER, DNNL_ARG_WEIGHTS_ITER))
             return arg_usage_t::input;
 
@@ -304,6 +312,7 @@ struct rnn_fwd_pd_t : public rnn_pd_t {
             case DNNL_ARG_AUGRU_ATTENTION: return &const_augru_attention_md();
             case DNNL_ARG_SRC_ITER: return src_md(1);
             case DNNL_ARG_SRC_ITER_C: return src_md(2);
+            case DNNL_ARG_SEQ_LENGTHS: return &seq_lengths_md_;
             case DNNL_ARG_WEIGHTS_LAYER: return weights_md(0);
             case DNNL_ARG_WEIGHTS_ITER: return weights_md(1);
             case DNNL_ARG_WEIGHTS_PEEPHOLE:
@@ -323,16 +332,26 @@ struct rnn_fwd_pd_t : public rnn_pd_t {
 
     int n_inputs() const override {
         return 3 + is_lstm_peephole() + is_lstm_projection() + with_bias()
-                + with_src_iter() + with_src_iter_c() + is_augru();
+                + with_src_iter() + with_src_iter_c() + is_augru()
+                + with_seq_lengths();
     }
     int n_outputs() const override {
         return 1 + with_dst_iter() + with_dst_iter_c() + is_training();
     }
 
 protected:
+    // Per-sample sequence lengths: a plain s32 vector of shape [MB].
+    memory_desc_t seq_lengths_md_ = types::zero_md();
+
     rnn_fwd_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
             const rnn_fwd_pd_t *hint_fwd_pd)
-        : rnn_pd_t(adesc, attr, hint_fwd_pd) {}
+        : rnn_pd_t(adesc, attr, hint_fwd_pd) {
+        if (with_seq_lengths()) {
+            const dims_t dims = {MB()};
+            memory_desc_init_by_tag(
+                    seq_lengths_md_, 1, dims, data_type::s32, format_tag::a);
+        }
+    }
 };
 // NOLINTEND(google-default-arguments)
 
@@ -37,6 +37,41 @@ status_t stream_t::enqueue_primitive(
     return primitive_iface->execute(ctx);
 }
 
+status_t stream_t::begin_capture() {
+    // replaying executes primitives synchronously, bypassing the queue of
+    // SYCL streams
+    if (engine()->kind() != engine_kind::cpu
+            || engine()->runtime_kind() == runtime_kind::sycl)
+        return unimplemented;
+    if (capture_) return invalid_arguments;
+    capture_.reset(new stream_capture_t(this));
+    return success;
+}
+
+status_t stream_t::end_capture(stream_capture_t **capture) {
+    if (!capture_) return invalid_arguments;
+    std::unique_ptr<stream_capture_t> c(capture_.release());
+    CHECK(c->finalize());
+    *capture = c.release();
+    return success;
+}
+
+status_t stream_t::set_thread_team(int nthr) {
+    if (nthr < 0) return invalid_arguments;
+    // the team is applied by the execution hooks of the CPU streams, which
+    // run the primitives on the calling thread
+    if (engine()->kind() != engine_kind::cpu
+            || engine()->runtime_kind() == runtime_kind::sycl)
+        return unimplemented;
+    // OpenMP and threadpool kernels rely on getting the number of threads
+    // they were created for, so only TBB arenas can bound their execution
+    if (utils::one_of(DNNL_CPU_THREADING_RUNTIME, DNNL_RUNTIME_OMP,
+                DNNL_RUNTIME_THREADPOOL))
+        return unimplemented;
+    thread_team_ = nthr;
+    return success;
+}
+
 /* API */
 
 status_t dnnl_stream_create(
@@ -65,6 +100,17 @@ status_t dnnl_stream_wait(stream_t *stream) {
     return stream->wait();
 }
 
+status_t dnnl_stream_set_thread_team(stream_t *stream, int nthr) {
+    if (any_null(stream)) return invalid_arguments;
+    return stream->set_thread_team(nthr);
+}
+
+status_t dnnl_stream_get_thread_team(const stream_t *stream, int *nthr) {
+    if (any_null(stream, nthr)) return invalid_arguments;
+    *nthr = stream->thread_team();
+    return success;
+}
+
 status_t dnnl_stream_destroy(stream_t *stream) {
     delete stream;
     return success;
@@ -23,6 +23,7 @@
 
 #include "common/c_types_map.hpp"
 #include "common/engine.hpp"
+#include "common/stream_capture.hpp"
 #include "common/stream_impl.hpp"
 #include "common/utils.hpp"
 
@@ -41,6 +42,12 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
     /** returns stream's kind */
     unsigned flags() const { return impl_->flags(); }
 
+    /** returns the size of the thread team executing the primitives, or 0
+     * when all the threads can be used */
+    int thread_team() const { return thread_team_; }
+    /** restricts the primitives executed on the stream to nthr threads */
+    dnnl::impl::status_t set_thread_team(int nthr);
+
     virtual dnnl::impl::status_t enqueue_primitive(
             const primitive_iface_t *primitive_iface,
             dnnl::impl::exec_ctx_t &ctx);
@@ -51,6 +58,13 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
     virtual void before_exec_hook() {}
     virtual void after_exec_hook() {}
 
+    /** starts recording primitive executions instead of running them */
+    dnnl::impl::status_t begin_capture();
+    /** stops recording and returns the recorded primitive executions */
+    dnnl::impl::status_t end_capture(dnnl::impl::stream_capture_t **capture);
+    /** returns the capture being recorded, if any */
+    dnnl::impl::stream_capture_t *capture() const { return capture_.get(); }
+
     virtual dnnl::impl::status_t reset_profiling() {
         if (!is_profiling_enabled())
             return dnnl::impl::status::invalid_arguments;
@@ -91,6 +105,8 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
 protected:
     dnnl::impl::engine_t *engine_;
     std::unique_ptr<dnnl::impl::stream_impl_t> impl_;
+    std::unique_ptr<dnnl::impl::stream_capture_t> capture_;
+    int thread_team_ = 0;
 };
 
 #endif
@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/engine.hpp"
+#include "common/primitive_desc_iface.hpp"
+#include "common/primitive_iface.hpp"
+#include "common/stream.hpp"
+#include "common/stream_capture.hpp"
+#include "common/utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+
+dnnl_stream_capture::~dnnl_stream_capture() {
+    for (auto &e : entries_)
+        const_cast<primitive_iface_t *>(e->primitive_iface_)->release();
+}
+
+status_t dnnl_stream_capture::record(
+        const primitive_iface_t *primitive_iface, exec_args_t &&args) {
+    entries_.emplace_back(utils::make_unique<entry_t>(
+            primitive_iface, stream_, std::move(args)));
+    const_cast<primitive_iface_t *>(primitive_iface)->retain();
+    return success;
+}
+
+status_t dnnl_stream_capture::finalize() {
+    size_t scratchpad_size = 0;
+    for (const auto &e : entries_) {
+        const auto *pd = e->primitive_iface_->pd()->impl().get();
+        scratchpad_size = nstl::max(scratchpad_size,
+                static_cast<size_t>(
+                        pd->scratchpad_size(scratchpad_mode::library)));
+    }
+
+    if (scratchpad_size) {
+        scratchpad_.reset(create_scratchpad(stream_->engine(), scratchpad_size,
+                /* use_global_scratchpad = */ false));
+        if (!scratchpad_ || !scratchpad_->get_memory_storage())
+            return out_of_memory;
+    }
+
+    for (auto &e : entries_) {
+        const auto *pd = e->primitive_iface_->pd()->impl().get();
+        if (pd->attr()->scratchpad_mode_ == scratchpad_mode::user) {
+            const memory_t *mem = e->ctx_.output(DNNL_ARG_SCRATCHPAD);
+            e->scratchpad_ = mem ? mem->memory_storage() : nullptr;
+        } else if (pd->scratchpad_size(scratchpad_mode::library)) {
+            e->scratchpad_ = scratchpad_->get_memory_storage();
+        }
+    }
+    return success;
+}
+
+status_t dnnl_stream_capture::replay() const {
+    stream_->before_exec_hook();
+    status_t status = success;
+    for (const auto &e : entries_) {
+        status = e->primitive_iface_->execute(e->ctx_, e->scratchpad_);
+        if (status != success) break;
+        if (msan_enabled) {
+            for (const auto &arg : e->ctx_.args()) {
+                if (arg.second.is_const) continue;
+                void *p;
+                arg.second.mem->get_data_handle(&p);
+                msan_unpoison(
+                        p, memory_desc_wrapper(*arg.second.mem->md()).size());
+            }
+        }
+    }
+    stream_->after_exec_hook();
+    return status;
+}
+
+// API
+status_t dnnl_stream_begin_capture(stream_t *stream) {
+    if (stream == nullptr) return invalid_arguments;
+    return stream->begin_capture();
+}
+
+status_t dnnl_stream_end_capture(
+        stream_t *stream, stream_capture_t **capture) {
+    if (utils::any_null(stream, capture)) return invalid_arguments;
+    return stream->end_capture(capture);
+}
+
+status_t dnnl_stream_capture_replay(
+        const stream_capture_t *capture, stream_t *stream) {
+    bool ok = !utils::any_null(capture, stream) && capture->stream() == stream
+            && stream->capture() == nullptr;
+    if (!ok) return invalid_arguments;
+    return capture->replay();
+}
+
+status_t dnnl_stream_capture_destroy(stream_capture_t *capture) {
+    delete capture;
+    return success;
+}
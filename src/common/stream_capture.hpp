@@ -0,0 +1,76 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_STREAM_CAPTURE_HPP
+#define COMMON_STREAM_CAPTURE_HPP
+
+#include <memory>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_exec_types.hpp"
+#include "common/scratchpad.hpp"
+#include "common/utils.hpp"
+
+// A sequence of primitive executions recorded on a stream.
+//
+// Everything which doesn't depend on the data is resolved once at recording
+// time: the execution context with its arguments is built for every
+// primitive, and all the primitives share a scratchpad owned by the capture
+// since they are executed one after another. Replaying only sets the
+// scratchpad and calls the primitives. Replays reuse the same contexts and
+// scratchpad, so they must not run concurrently.
+struct dnnl_stream_capture : public dnnl::impl::c_compatible {
+    dnnl_stream_capture(dnnl::impl::stream_t *stream) : stream_(stream) {}
+    ~dnnl_stream_capture();
+
+    dnnl::impl::stream_t *stream() const { return stream_; }
+
+    // Records an execution of the primitive with the given arguments.
+    dnnl::impl::status_t record(const primitive_iface_t *primitive_iface,
+            dnnl::impl::exec_args_t &&args);
+
+    // Allocates the scratchpad, called once recording is over.
+    dnnl::impl::status_t finalize();
+
+    dnnl::impl::status_t replay() const;
+
+private:
+    struct entry_t {
+        entry_t(const primitive_iface_t *primitive_iface,
+                dnnl::impl::stream_t *stream, dnnl::impl::exec_args_t &&args)
+            : primitive_iface_(primitive_iface)
+            , ctx_(stream, std::move(args)) {}
+
+        const primitive_iface_t *primitive_iface_;
+        dnnl::impl::exec_ctx_t ctx_;
+        const dnnl::impl::memory_storage_t *scratchpad_ = nullptr;
+    };
+
+    dnnl::impl::stream_t *stream_;
+    // Contexts are referenced by scratchpad grantors, so their addresses must
+    // not change.
+    std::vector<std::unique_ptr<entry_t>> entries_;
+    std::unique_ptr<dnnl::impl::scratchpad_t> scratchpad_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_stream_capture);
+};
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,148 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_TOPK_PD_HPP
+#define COMMON_TOPK_PD_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_desc.hpp"
+#include "common/topk_utils.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define VDISPATCH_TOPK(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, topk, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+// NOLINTBEGIN(google-default-arguments)
+struct topk_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::topk;
+
+    using base_class = topk_pd_t;
+    using hint_class = topk_pd_t;
+
+    const topk_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::alg_kind:
+                *(alg_kind_t *)result = desc()->alg_kind;
+                break;
+            case query::axis_s32: *(int *)result = desc()->axis; break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (arg == DNNL_ARG_SRC) return arg_usage_t::input;
+
+        if (utils::one_of(arg, DNNL_ARG_DST, DNNL_ARG_DST_INDICES))
+            return arg_usage_t::output;
+
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            case DNNL_ARG_DST_INDICES: return dst_md(1, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        return index == 0 ? &desc_.src_desc : &glob_zero_md;
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        switch (index) {
+            case 0: return &desc_.dst_desc;
+            case 1: return &desc_.dst_indices_desc;
+            default: return &glob_zero_md;
+        }
+    }
+
+    const memory_desc_t *dst_indices_md() const {
+        return &desc_.dst_indices_desc;
+    }
+
+    int n_inputs() const override { return 1; }
+    int n_outputs() const override { return 2; }
+
+    int axis() const { return desc_.axis; }
+    dim_t k() const { return desc_.k; }
+    dim_t axis_size() const { return desc_.axis_size(); }
+    bool is_max() const { return desc_.alg_kind == alg_kind::reduction_max; }
+    bool with_softmax() const { return desc_.with_softmax; }
+
+    /// If true, the source is multiplied by a common scale before selection
+    bool with_scales() const {
+        return !attr()->scales_.has_default_values(DNNL_ARG_SRC);
+    }
+
+    /// Number of independent selections made by the primitive
+    dim_t outer_size() const {
+        return utils::array_product(src_md()->dims, axis());
+    }
+    dim_t inner_size() const {
+        return utils::array_product(
+                src_md()->dims + axis() + 1, src_md()->ndims - axis() - 1);
+    }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(src_md()).has_zero_dim();
+    }
+
+protected:
+    topk_desc_t desc_;
+
+    topk_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd_pd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*op_desc_t::to_desc<topk_desc_t>(adesc)) {}
+
+    bool set_default_formats() {
+        bool ok = true;
+
+        for (auto md : {&desc_.src_desc, &desc_.dst_desc,
+                     &desc_.dst_indices_desc}) {
+            memory_desc_wrapper mdw(md);
+            if (mdw.format_any())
+                ok = ok && memory_desc_init_by_strides(*md, nullptr)
+                                == status::success;
+        }
+
+        return ok;
+    }
+};
+// NOLINTEND(google-default-arguments)
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,41 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_desc_iface.hpp"
+#include "common/topk_pd.hpp"
+#include "common/topk_types.hpp"
+#include "common/topk_utils.hpp"
+#include "opdesc.hpp"
+
+using dnnl::impl::status_t;
+using namespace dnnl::impl;
+
+dnnl_status_t DNNL_API topk_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_memory_desc_t dst_indices_desc, int axis, dnnl_dim_t k,
+        bool with_softmax, const_dnnl_primitive_attr_t attr) {
+    CHECK(topk_desc_check(src_desc, dst_desc, dst_indices_desc, alg_kind, axis,
+            k, with_softmax));
+    CHECK(topk_attr_check(attr));
+
+    dnnl::impl::topk_desc_t topk_desc = dnnl::impl::create_topk_desc(src_desc,
+            dst_desc, dst_indices_desc, alg_kind, axis, k, with_softmax);
+    return dnnl::impl::primitive_desc_create(primitive_desc_iface, engine,
+            (const dnnl::impl::op_desc_t *)&topk_desc, nullptr, attr);
+}
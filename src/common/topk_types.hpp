@@ -0,0 +1,69 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_TOPK_TYPES_HPP
+#define COMMON_TOPK_TYPES_HPP
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc.hpp"
+#include "common/opdesc.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// The selected values are written to DNNL_ARG_DST and their positions along
+// the axis to a second destination.
+#define DNNL_ARG_DST_INDICES DNNL_ARG_DST_1
+
+// A descriptor for a top-k operation.
+//
+// Selects the `k` largest (reduction_max) or smallest (reduction_min) elements
+// of `src` along `axis`. Values and their s32 positions along the axis are
+// written in order, best first; ties are resolved in favor of the lower
+// position. NaN is greater than any number, so it comes first for
+// reduction_max and last for reduction_min. Argmax is a top-k with `k == 1`.
+//
+// When `with_softmax` is set, the values destination receives the softmax of
+// the selected values instead of the values themselves, which, together with
+// a scale on the source used as an inverse temperature, gives the sampling
+// distribution of top-k sampling.
+struct topk_desc_t : public op_desc_t {
+    topk_desc_t() : op_desc_t(primitive_kind::topk) {}
+
+    std::unique_ptr<op_desc_t> clone() const override {
+        return utils::make_unique<topk_desc_t>(*this);
+    }
+
+    memory_desc_t src_desc;
+    memory_desc_t dst_desc;
+    memory_desc_t dst_indices_desc;
+
+    // One of reduction_max or reduction_min.
+    alg_kind_t alg_kind = alg_kind::undef;
+    int axis = 0;
+    dim_t k = 0;
+    bool with_softmax = false;
+
+    // Number of elements the selection is made from.
+    dim_t axis_size() const { return src_desc.dims[axis]; }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif // COMMON_TOPK_TYPES_HPP
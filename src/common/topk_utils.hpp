@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_TOPK_UTILS_HPP
+#define COMMON_TOPK_UTILS_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_attr.hpp"
+#include "common/topk_types.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define VCHECK_TOPK_COND(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, topk, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+#define VCHECK_TOPK_UNIMPL(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, topk, (cond), status::unimplemented, \
+            msg, ##__VA_ARGS__);
+
+static inline status_t topk_desc_check(const memory_desc_t *src_desc,
+        const memory_desc_t *dst_desc, const memory_desc_t *dst_indices_desc,
+        alg_kind_t alg_kind, int axis, dim_t k, bool with_softmax) {
+    using namespace data_type;
+
+    const int ndims = src_desc->ndims;
+    VCHECK_TOPK_COND(
+            !memory_desc_wrapper(src_desc).has_runtime_dims_or_strides()
+                    && !memory_desc_wrapper(dst_desc)
+                                .has_runtime_dims_or_strides()
+                    && !memory_desc_wrapper(dst_indices_desc)
+                                .has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VCHECK_TOPK_COND(ndims > 0, VERBOSE_BAD_NDIMS, "src", ndims);
+    VCHECK_TOPK_COND(dst_desc->ndims == ndims, VERBOSE_INCONSISTENT_NDIMS,
+            "src", "dst");
+    VCHECK_TOPK_COND(dst_indices_desc->ndims == ndims,
+            VERBOSE_INCONSISTENT_NDIMS, "src", "dst_indices");
+    VCHECK_TOPK_COND(dst_indices_desc->data_type == s32,
+            VERBOSE_INVALID_DATATYPE, "dst_indices");
+    VCHECK_TOPK_COND(0 <= axis && axis < ndims, VERBOSE_BAD_AXIS);
+    VCHECK_TOPK_COND(
+            utils::one_of(alg_kind, alg_kind::reduction_max,
+                    alg_kind::reduction_min),
+            VERBOSE_BAD_ALGORITHM);
+    // The softmax of the smallest values is not a meaningful distribution.
+    VCHECK_TOPK_COND(IMPLICATION(with_softmax,
+                             alg_kind == alg_kind::reduction_max),
+            VERBOSE_BAD_ALGORITHM);
+    VCHECK_TOPK_COND(0 < k && k <= src_desc->dims[axis], VERBOSE_BAD_PARAM,
+            "k");
+
+    for (int d = 0; d < ndims; d++) {
+        const dim_t expected = d == axis ? k : src_desc->dims[d];
+        VCHECK_TOPK_COND(dst_desc->dims[d] == expected,
+                VERBOSE_INCONSISTENT_DIM, "dst", d, "src", d);
+        VCHECK_TOPK_COND(dst_indices_desc->dims[d] == expected,
+                VERBOSE_INCONSISTENT_DIM, "dst_indices", d, "src", d);
+    }
+
+    return status::success;
+}
+
+static inline status_t topk_attr_check(const primitive_attr_t *attr) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+    using namespace data_type;
+
+    if (attr == nullptr) return status::success;
+
+    VCHECK_TOPK_UNIMPL(attr->has_default_values(smask_t::scales_data_type),
+            VERBOSE_UNSUPPORTED_ATTR);
+
+    // A single source scale, e.g. an inverse sampling temperature.
+    const auto &sc = attr->scales_;
+    VCHECK_TOPK_UNIMPL(sc.has_default_values({DNNL_ARG_SRC}),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VCHECK_TOPK_UNIMPL(IMPLICATION(!sc.has_default_values(DNNL_ARG_SRC),
+                               sc.get_mask(DNNL_ARG_SRC) == 0
+                                       && sc.get_data_type(DNNL_ARG_SRC)
+                                               == f32),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+
+    return status::success;
+}
+
+static inline topk_desc_t create_topk_desc(const memory_desc_t *src_md,
+        const memory_desc_t *dst_md, const memory_desc_t *dst_indices_md,
+        alg_kind_t alg_kind, int axis, dim_t k, bool with_softmax) {
+    auto topk_desc = topk_desc_t();
+    topk_desc.primitive_kind = primitive_kind::topk;
+    topk_desc.src_desc = *src_md;
+    topk_desc.dst_desc = *dst_md;
+    topk_desc.dst_indices_desc = *dst_indices_md;
+    topk_desc.alg_kind = alg_kind;
+    topk_desc.axis = axis;
+    topk_desc.k = k;
+    topk_desc.with_softmax = with_softmax;
+    return topk_desc;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
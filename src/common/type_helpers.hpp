@@ -26,11 +26,13 @@
 #include "bit_cast.hpp"
 #include "c_types_map.hpp"
 #include "dnnl_traits.hpp"
+#include "gather_types.hpp"
 #include "gemm_types.hpp"
 #include "memory_desc.hpp"
 #include "nstl.hpp"
 #include "opdesc.hpp"
 #include "sdpa_types.hpp"
+#include "topk_types.hpp"
 #include "utils.hpp"
 
 namespace dnnl {
@@ -969,11 +971,32 @@ inline bool operator==(const sum_desc_t &lhs, const sum_desc_t &rhs) {
     return ret;
 }
 
+inline bool operator==(const topk_desc_t &lhs, const topk_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(alg_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(dst_indices_desc)
+            && COMPARE_DESC_MEMBERS(axis) && COMPARE_DESC_MEMBERS(k)
+            && COMPARE_DESC_MEMBERS(with_softmax);
+    return ret;
+}
+
 inline bool operator==(const zero_pad_desc_t &lhs, const zero_pad_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind);
     return ret;
 }
 
+inline bool operator==(const gather_desc_t &lhs, const gather_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(indices_desc)
+            && COMPARE_DESC_MEMBERS(offsets_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(alg_kind);
+    return ret;
+}
+
 inline bool operator==(const sdpa_desc_t &lhs, const sdpa_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
             && COMPARE_DESC_MEMBERS(q_desc)
@@ -41,6 +41,7 @@
 #include "convolution_pd.hpp"
 #include "deconvolution_pd.hpp"
 #include "eltwise_pd.hpp"
+#include "gather_pd.hpp"
 #include "gemm_pd.hpp"
 #include "group_normalization_pd.hpp"
 #include "inner_product_pd.hpp"
@@ -57,6 +58,7 @@
 #include "shuffle_pd.hpp"
 #include "softmax_pd.hpp"
 #include "sum_pd.hpp"
+#include "topk_pd.hpp"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "common/dnnl_thread.hpp"
@@ -366,6 +368,7 @@ std::string normalization_flags2str(unsigned flags) {
 std::string rnn_flags2str(unsigned flags) {
     std::string s;
     if (flags & rnn_flags::diff_weights_overwrite) s += "O";
+    if (flags & rnn_flags::seq_lengths) s += "S";
     return s;
 }
 
@@ -1558,6 +1561,55 @@ std::string init_info_sum(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+std::string init_info_gather(const engine_t *e, const pd_t *pd) {
+    stringstream_t ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    ss << md2fmt_str(
+            "src", pd->table_md(), pd->invariant_src_user_format_kind(0))
+       << " ";
+    ss << md2fmt_str(
+            "idx", pd->indices_md(), pd->invariant_src_user_format_kind(1))
+       << " ";
+    if (pd->with_offsets())
+        ss << md2fmt_str("off", pd->offsets_md(),
+                pd->invariant_src_user_format_kind(2))
+           << " ";
+    ss << md2fmt_str("dst", pd->dst_md(), pd->invariant_dst_user_format_kind());
+
+    ss << "," << pd->attr() << ",";
+    if (pd->with_offsets()) ss << "alg:" << pd->desc()->alg_kind;
+    ss << "," << md2dim_str(pd->table_md()) << ":"
+       << md2dim_str(pd->indices_md()) << ":" << md2dim_str(pd->dst_md());
+
+    return ss.str();
+}
+
+template <typename pd_t>
+std::string init_info_topk(const engine_t *e, const pd_t *pd) {
+    stringstream_t ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    ss << md2fmt_str("src", pd->src_md(), pd->invariant_src_user_format_kind())
+       << " ";
+    ss << md2fmt_str("dst", pd->dst_md(),
+            pd->invariant_dst_user_format_kind(DNNL_ARG_DST))
+       << " ";
+    ss << md2fmt_str("idx", pd->dst_indices_md(),
+            pd->invariant_dst_user_format_kind(DNNL_ARG_DST_INDICES));
+
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << pd->desc()->alg_kind << " axis:" << pd->axis()
+       << " k:" << pd->k();
+    if (pd->with_softmax()) ss << " softmax";
+    ss << "," << md2dim_str(pd->src_md());
+
+    return ss.str();
+}
+
 template <typename pd_t>
 std::string init_info_sdpa(const engine_t *e, const pd_t *pd) {
     stringstream_t ss;
@@ -1754,6 +1806,7 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(gather);
             CASE(gemm);
             CASE(group_normalization);
             CASE(inner_product);
@@ -1770,6 +1823,7 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(softmax);
             CASE(sum);
             CASE(sdpa);
+            CASE(topk);
             case primitive_kind::zero_pad:
               str_ = "zero_pad, unknown info";
               break;
@@ -17,6 +17,8 @@
 #ifndef CPU_CPU_STREAM_HPP
 #define CPU_CPU_STREAM_HPP
 
+#include <vector>
+
 #include "oneapi/dnnl/dnnl_config.h"
 
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
@@ -45,17 +47,37 @@ struct cpu_stream_t : public stream_t {
     cpu_stream_t(engine_t *engine,
             dnnl::threadpool_interop::threadpool_iface *threadpool)
         : stream_t(engine, new impl::stream_impl_t(threadpool)) {}
+#endif
 
     void before_exec_hook() override {
+        saved_team_sizes().push_back(dnnl_thr_team_size());
+        if (thread_team() > 0) dnnl_thr_team_size() = thread_team();
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
         dnnl::threadpool_interop::threadpool_iface *tp;
         auto rc = this->get_threadpool(&tp);
         if (rc == status::success) threadpool_utils::activate_threadpool(tp);
+#endif
     }
 
     void after_exec_hook() override {
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
         threadpool_utils::deactivate_threadpool();
-    }
 #endif
+        auto &saved = saved_team_sizes();
+        if (saved.empty()) return;
+        dnnl_thr_team_size() = saved.back();
+        saved.pop_back();
+    }
+
+private:
+    // The team sizes of the calling thread before the executions in
+    // progress. The hooks may be called concurrently on the same stream, and
+    // nested when a kernel executes primitives on the stream it runs on, so
+    // the sizes are saved per thread in the order of the calls.
+    static std::vector<int> &saved_team_sizes() {
+        static thread_local std::vector<int> sizes;
+        return sizes;
+    }
 };
 
 } // namespace cpu
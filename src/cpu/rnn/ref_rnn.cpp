@@ -29,12 +29,16 @@
 
  */
 
+#include <cstring>
+#include <vector>
+
 #include "common/dnnl_thread.hpp"
 #include "common/matmul_pd.hpp"
 #include "common/primitive.hpp"
 #include "common/primitive_desc_iterator.hpp"
 #include "common/stream.hpp"
 
+#include "cpu/ref_io_helper.hpp"
 #include "cpu/simple_q10n.hpp"
 
 #include "cpu/gemm/gemm.hpp"
@@ -100,6 +104,11 @@ status_t dnnl::impl::cpu::ref_rnn_common_t<aprop, src_type, weights_type,
     VDISPATCH_RNN(IMPLICATION(rnn_.is_f16_conf(), !rnn_.is_training),
             VERBOSE_UNSUPPORTED_FEATURE, "f16 training not supported");
 
+    VDISPATCH_RNN(IMPLICATION(rnn_.with_seq_lengths,
+                          !rnn_.is_int8_conf() && !rnn_.is_lstm_projection),
+            VERBOSE_UNSUPPORTED_FEATURE,
+            "sequence lengths with int8 or lstm projection");
+
     if (rnn_.is_xf16_conf()) {
         VDISPATCH_RNN(
                 !(!utils::one_of(rnn_.bias_dt, src_type, data_type::f32)
@@ -362,6 +371,13 @@ ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::pd_t::init_brgemm(
                           this->arg_md(DNNL_ARG_BIAS)),
             VERBOSE_PRIMITIVE_CREATION_FAIL, "rnn");
 
+    // A wavefront of reference gemm cells is only selected over brgemm when
+    // it is forced
+    VDISPATCH_RNN(!(rnn_utils::get_wavefront_mode() > 0
+                          && rnn_utils::is_wavefront_applicable(rnn_)),
+            VERBOSE_UNSUPPORTED_FEATURE,
+            "f32 cells executed as a wavefront");
+
     VDISPATCH_RNN(IMPLICATION(one_of(this->desc()->prop_kind, forward_training,
                                       backward),
                           (rnn_.is_xf16_conf() || rnn_.is_f32_conf())),
@@ -388,6 +404,11 @@ ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::pd_t::init_brgemm(
                           this->desc()->prop_kind == forward_inference)),
             "bad algorithm for lstm projection for forward inference");
 
+    VDISPATCH_RNN(IMPLICATION(rnn_.with_seq_lengths,
+                          !rnn_.is_int8_conf() && !rnn_.is_lstm_projection),
+            VERBOSE_UNSUPPORTED_FEATURE,
+            "sequence lengths with int8 or lstm projection");
+
     if (rnn_.is_bf16_conf()) {
         const bool isa_dt_not_ok = (!mayiuse(avx512_core_bf16)
                 || !utils::one_of(rnn_.bias_dt, data_type::bf16, data_type::f32)
@@ -1046,6 +1067,263 @@ rnn_grid_execution_sig((ref_rnn_common_t<aprop, src_type, weights_type,
                   return dnnl_success;
               };
 
+    // With per-sample sequence lengths, sample `b` is active at iteration
+    // `iter` of direction `dir` if the corresponding time step is within its
+    // length. The reversed direction walks time steps backwards, so there the
+    // last `len` iterations are active.
+    const auto seq_lengths = rnn.with_seq_lengths
+            ? CTX_IN_MEM(const int32_t *, DNNL_ARG_SEQ_LENGTHS)
+            : nullptr;
+    const auto is_active = [&](int dir, int iter, dim_t b) {
+        const int len = nstl::min(nstl::max(seq_lengths[b], 0), rnn.n_iter);
+        const bool is_reversed = rnn.exec_dir != l2r && dir == rnn.n_dir - 1;
+        return is_reversed ? iter >= rnn.n_iter - len : iter < len;
+    };
+    // Inactive samples keep the states of their last valid time step: the
+    // input states of the cell are forwarded to its outputs.
+    const auto carry_inactive_states = [&](int dir, int iter,
+                                               cell_position_t cell_position,
+                                               const src_iter_t *src_iter,
+                                               const void *src_iter_c,
+                                               dst_layer_t *dst_layer,
+                                               dst_iter_t *dst_iter,
+                                               void *dst_iter_c) {
+        const dim_t src_iter_ld = rnn.src_iter_ld(cell_position);
+        const dim_t dst_layer_ld = rnn.dst_layer_ld(cell_position);
+        const dim_t dst_iter_ld = rnn.dst_iter_ld(cell_position);
+        const dim_t src_iter_c_ld = rnn.src_iter_c_ld(cell_position);
+        const dim_t dst_iter_c_ld = rnn.dst_iter_c_ld(cell_position);
+        const size_t c_size = types::data_type_size(rnn.src_iter_c_dt);
+        parallel_nd(rnn.mb, [&](dim_t b) {
+            if (is_active(dir, iter, b)) return;
+            const src_iter_t *h = src_iter + b * src_iter_ld;
+            array_copy(dst_layer + b * dst_layer_ld, h, rnn.dhc);
+            if (dst_iter) array_copy(dst_iter + b * dst_iter_ld, h, rnn.dhc);
+            if (rnn.n_states == 2)
+                std::memcpy(inc_ptr(dst_iter_c, rnn.dst_iter_c_dt,
+                                    b * dst_iter_c_ld),
+                        inc_ptr(src_iter_c, rnn.src_iter_c_dt,
+                                b * src_iter_c_ld),
+                        rnn.dhc * c_size);
+        });
+    };
+    // Cells only compute the rows up to the last active sample, so with
+    // samples sorted by decreasing length the minibatch of every cell shrinks
+    // to the number of samples still active at its time step.
+    std::unique_ptr<rnn_conf_t> varlen_rnn;
+    if (rnn.with_seq_lengths) varlen_rnn = utils::make_unique<rnn_conf_t>(rnn);
+    const rnn_conf_t &cell_rnn = rnn.with_seq_lengths ? *varlen_rnn : rnn;
+
+    // Executes the cell (lay, iter) of direction dir. `lane` selects the
+    // scratch buffers of the cell when several cells run concurrently.
+    const auto execute_cell
+            = [&](int dir, int j, int lay, int iter, int lane) -> status_t {
+        // We set parameters to the cell execution call
+
+        // dst_layer is equal to dst_iter. To avoid
+        // duplication of memory access we hence use only
+        // dst_layer and set dst_iter to nullptr, unless we
+        // cannot for one of the following condition:
+        // - in the last layer and last iteration, we need to
+        //   copy ht in two tensors (dst_layer and dst_iter)
+        dst_layer_t *cell_dst_layer
+                = &(ws_states_layer(lay + 1, dir, iter + 1, 0));
+        dst_iter_t *cell_dst_iter = nullptr;
+        const src_layer_t *cell_src_layer
+                = &(ws_states_layer(lay, dir, iter + 1, 0));
+        const src_iter_t *cell_src_iter
+                = &(ws_states_iter(lay + 1, dir, iter, 0));
+
+        void *cell_dst_iter_c = const_cast<void *>(
+                ws_states_iter_c(lay + 1, dir, iter + 1, 0));
+        const void *cell_src_iter_c
+                = ws_states_iter_c(lay + 1, dir, iter, 0);
+
+        // the cell_position is used only when skip_data_copy is
+        // supported currently supported only for forward
+        cell_position_t cell_position = middle_cell;
+        if (iter == 0) cell_position |= first_iter;
+        if (lay == 0) cell_position |= first_layer;
+        if (iter == rnn.n_iter - 1) cell_position |= last_iter;
+        if (lay == rnn.n_layer - 1) cell_position |= last_layer;
+
+        // The dst_* paths should be before the src_* paths as
+        // the later will override cell_src_layer and
+        // cell_src_iter appropriately for 1st layer and 1st
+        // iter.
+        const bool last_iter_skip_copy
+                = rnn.skip_dst_iter_copy() && (cell_position & last_iter);
+        if (last_iter_skip_copy) {
+            cell_dst_layer = dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0);
+            cell_src_layer
+                    = dst_iter_ + dst_iter_mdw.off(lay - 1, dir, 0, 0);
+        }
+
+        if (rnn.skip_dst_layer_copy() && (cell_position & last_layer)) {
+            // Note: for last layer and last iter, the output is in dst_layer
+            // and still need to be copied to dst_iter
+            cell_dst_layer = dst_layer_ + dst_layer_mdw.off(iter, 0, 0);
+            cell_dst_iter = last_iter_skip_copy
+                    ? dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0)
+                    : nullptr;
+            cell_src_iter = (iter != 0)
+                    ? dst_layer_ + dst_layer_mdw.off(iter - 1, 0, 0)
+                    : cell_src_iter;
+        }
+        if (rnn.skip_src_iter_copy() && (cell_position & first_iter))
+            cell_src_iter = src_iter_ + src_iter_mdw.off(lay, dir, 0, 0);
+
+        if (rnn.skip_src_layer_copy() && (cell_position & first_layer))
+            cell_src_layer = src_layer_ + src_layer_mdw.off(iter, 0, 0);
+
+        // because the c state is always f32 and require no
+        // conversion, we can always skip to copy for the 1st
+        // and last iteration
+        if (iter == 0 && src_iter_c_) {
+            cell_src_iter_c = inc_ptr(src_iter_c_, rnn.src_iter_c_dt,
+                    src_iter_c_mdw.off(lay, dir, 0, 0));
+            cell_position |= c_state_first_iter;
+        }
+        if (iter == rnn.n_iter - 1 && dst_iter_c_) {
+            cell_dst_iter_c = inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
+                    dst_iter_c_mdw.off(lay, dir, 0, 0));
+            cell_position |= c_state_last_iter;
+        }
+        const size_t lane_scratch_size = static_cast<size_t>(lane)
+                * rnn.scratch_gates_nld * rnn.scratch_gates_ld;
+        const size_t sg_start_idx = rnn.n_iter_scratch_gates == 1
+                ? lane_scratch_size
+                : static_cast<size_t>(iter) * rnn.scratch_gates_nld
+                        * rnn.scratch_gates_ld;
+        const auto cell_scratch_gates = &scratch_gates_[sg_start_idx];
+        const auto cell_scratch_cell
+                = scratch_cell_ ? scratch_cell_ + lane_scratch_size : nullptr;
+
+        bool all_active = true;
+        if (rnn.with_seq_lengths) {
+            dim_t active_mb = 0;
+            for (dim_t b = 0; b < rnn.mb; b++) {
+                if (is_active(dir, iter, b))
+                    active_mb = b + 1;
+                else
+                    all_active = false;
+            }
+            varlen_rnn->mb = active_mb;
+            if (rnn.is_brgemm)
+                varlen_rnn->M_blocks = div_up(active_mb, rnn.m_block);
+            if (active_mb == 0) {
+                carry_inactive_states(dir, iter, cell_position,
+                        cell_src_iter, cell_src_iter_c, cell_dst_layer,
+                        cell_dst_iter, cell_dst_iter_c);
+                return status::success;
+            }
+        }
+
+        dst_iter_t *proj_ht = nullptr;
+        if (rnn.is_lstm_projection) {
+            if (rnn.is_training)
+                proj_ht = &(ws_ht(lay, dir, iter, 0));
+            else
+                proj_ht = scratch_ht_;
+        }
+
+#if DNNL_X64
+        CHECK((this->*cell_func)(ctx, cell_rnn, cell_position,
+                cell_dst_layer,
+                cell_dst_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
+                SAFE_PTR(diff_augru_attention, iter, 0, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
+                SAFE_PTR(weights_layer, lay, dir, 0),
+                SAFE_PTR(weights_iter, lay, dir, 0),
+                SAFE_PTR(weights_projection, lay, dir),
+                SAFE_PTR(weights_peephole, lay, dir, 0),
+                w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
+                            : nullptr,
+                bias(lay, dir), cell_src_layer,
+                SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
+                cell_src_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
+                SAFE_PTR(diff_weights_layer, lay, dir, 0),
+                SAFE_PTR(diff_weights_iter, lay, dir, 0),
+                SAFE_PTR(diff_weights_projection, lay, dir, 0),
+                SAFE_PTR(diff_weights_peephole, lay, dir, 0),
+                SAFE_PTR(diff_bias, lay, dir, 0),
+                SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
+                proj_ht, scratch_diff_ht_,
+                SAFE_PTR(ws_grid, lay, dir, iter, 0), cell_scratch_cell,
+                scratch_gates_blocked_, scratch_src_layer_,
+                scratch_src_iter_, cell_dst_iter, amx_scratchpad,
+                addr_batch_global));
+#else
+        CHECK((this->*cell_func)(ctx, cell_rnn, cell_position,
+                cell_dst_layer,
+                cell_dst_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
+                SAFE_PTR(diff_augru_attention, iter, 0, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
+                SAFE_PTR(weights_layer, lay, dir, 0),
+                SAFE_PTR(weights_iter, lay, dir, 0),
+                SAFE_PTR(weights_projection, lay, dir),
+                SAFE_PTR(weights_peephole, lay, dir, 0),
+                w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
+                            : nullptr,
+                bias(lay, dir), cell_src_layer,
+                SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
+                cell_src_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
+                SAFE_PTR(diff_weights_layer, lay, dir, 0),
+                SAFE_PTR(diff_weights_iter, lay, dir, 0),
+                SAFE_PTR(diff_weights_projection, lay, dir, 0),
+                SAFE_PTR(diff_weights_peephole, lay, dir, 0),
+                SAFE_PTR(diff_bias, lay, dir, 0),
+                SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
+                proj_ht, scratch_diff_ht_,
+                SAFE_PTR(ws_grid, lay, dir, iter, 0), cell_scratch_cell,
+                cell_dst_iter, amx_scratchpad));
+#endif
+        if (!all_active)
+            carry_inactive_states(dir, iter, cell_position, cell_src_iter,
+                    cell_src_iter_c, cell_dst_layer, cell_dst_iter,
+                    cell_dst_iter_c);
+        return status::success;
+    };
+
+    if (aprop == prop_kind::forward && rnn.use_wavefront) {
+        // Cells (lay, iter) with the same lay + iter only depend on cells of
+        // the previous anti-diagonal, so the cells of each anti-diagonal of
+        // every direction are spread across threads, each using its own lane
+        // of the scratch buffers.
+        const int n_diags = rnn.n_layer + rnn.n_iter - 1;
+        for (int d = 0; d < n_diags; d++) {
+            const int lay_start = nstl::max(0, d - rnn.n_iter + 1);
+            const int lay_end = nstl::min(rnn.n_layer, d + 1);
+            const int n_diag_cells = lay_end - lay_start;
+            const int n_cells = rnn.n_dir * n_diag_cells;
+            const int nthr = nstl::min(n_cells, rnn.n_wavefront_lanes);
+
+            std::vector<status_t> st(nthr, status::success);
+            parallel(nthr, [&](const int ithr, const int nthr) {
+                for (int k = ithr; k < n_cells; k += nthr) {
+                    const int dir = k / n_diag_cells;
+                    const int lay = lay_start + k % n_diag_cells;
+                    const status_t cell_st
+                            = execute_cell(dir, lay, lay, d - lay, ithr);
+                    if (cell_st != status::success) st[ithr] = cell_st;
+                }
+            });
+            for (const auto &cell_st : st)
+                CHECK(cell_st);
+        }
+        return dnnl_success;
+    }
+
     // We run the grid of computation
     for_(int dir = 0; dir < rnn.n_dir; dir++)
     for (int j = 0; j < rnn.n_layer; j++) {
@@ -1059,151 +1337,7 @@ rnn_grid_execution_sig((ref_rnn_common_t<aprop, src_type, weights_type,
         for (int i = 0; i < rnn.n_iter; i++) {
             const int iter
                     = (aprop == prop_kind::forward) ? i : rnn.n_iter - i - 1;
-
-            // We set parameters to the cell execution call
-
-            // dst_layer is equal to dst_iter. To avoid
-            // duplication of memory access we hence use only
-            // dst_layer and set dst_iter to nullptr, unless we
-            // cannot for one of the following condition:
-            // - in the last layer and last iteration, we need to
-            //   copy ht in two tensors (dst_layer and dst_iter)
-            dst_layer_t *cell_dst_layer
-                    = &(ws_states_layer(lay + 1, dir, iter + 1, 0));
-            dst_iter_t *cell_dst_iter = nullptr;
-            const src_layer_t *cell_src_layer
-                    = &(ws_states_layer(lay, dir, iter + 1, 0));
-            const src_iter_t *cell_src_iter
-                    = &(ws_states_iter(lay + 1, dir, iter, 0));
-
-            void *cell_dst_iter_c = const_cast<void *>(
-                    ws_states_iter_c(lay + 1, dir, iter + 1, 0));
-            const void *cell_src_iter_c
-                    = ws_states_iter_c(lay + 1, dir, iter, 0);
-
-            // the cell_position is used only when skip_data_copy is
-            // supported currently supported only for forward
-            cell_position_t cell_position = middle_cell;
-            if (iter == 0) cell_position |= first_iter;
-            if (lay == 0) cell_position |= first_layer;
-            if (iter == rnn.n_iter - 1) cell_position |= last_iter;
-            if (lay == rnn.n_layer - 1) cell_position |= last_layer;
-
-            // The dst_* paths should be before the src_* paths as
-            // the later will override cell_src_layer and
-            // cell_src_iter appropriately for 1st layer and 1st
-            // iter.
-            const bool last_iter_skip_copy
-                    = rnn.skip_dst_iter_copy() && (cell_position & last_iter);
-            if (last_iter_skip_copy) {
-                cell_dst_layer = dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0);
-                cell_src_layer
-                        = dst_iter_ + dst_iter_mdw.off(lay - 1, dir, 0, 0);
-            }
-
-            if (rnn.skip_dst_layer_copy() && (cell_position & last_layer)) {
-                // Note: for last layer and last iter, the output is in dst_layer
-                // and still need to be copied to dst_iter
-                cell_dst_layer = dst_layer_ + dst_layer_mdw.off(iter, 0, 0);
-                cell_dst_iter = last_iter_skip_copy
-                        ? dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0)
-                        : nullptr;
-                cell_src_iter = (iter != 0)
-                        ? dst_layer_ + dst_layer_mdw.off(iter - 1, 0, 0)
-                        : cell_src_iter;
-            }
-            if (rnn.skip_src_iter_copy() && (cell_position & first_iter))
-                cell_src_iter = src_iter_ + src_iter_mdw.off(lay, dir, 0, 0);
-
-            if (rnn.skip_src_layer_copy() && (cell_position & first_layer))
-                cell_src_layer = src_layer_ + src_layer_mdw.off(iter, 0, 0);
-
-            // because the c state is always f32 and require no
-            // conversion, we can always skip to copy for the 1st
-            // and last iteration
-            if (iter == 0 && src_iter_c_) {
-                cell_src_iter_c = inc_ptr(src_iter_c_, rnn.src_iter_c_dt,
-                        src_iter_c_mdw.off(lay, dir, 0, 0));
-                cell_position |= c_state_first_iter;
-            }
-            if (iter == rnn.n_iter - 1 && dst_iter_c_) {
-                cell_dst_iter_c = inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
-                        dst_iter_c_mdw.off(lay, dir, 0, 0));
-                cell_position |= c_state_last_iter;
-            }
-            const size_t sg_start_idx = rnn.n_iter_scratch_gates == 1
-                    ? static_cast<size_t>(0)
-                    : static_cast<size_t>(iter) * rnn.scratch_gates_nld
-                            * rnn.scratch_gates_ld;
-            const auto cell_scratch_gates = &scratch_gates_[sg_start_idx];
-
-            dst_iter_t *proj_ht = nullptr;
-            if (rnn.is_lstm_projection) {
-                if (rnn.is_training)
-                    proj_ht = &(ws_ht(lay, dir, iter, 0));
-                else
-                    proj_ht = scratch_ht_;
-            }
-
-#if DNNL_X64
-            CHECK((this->*cell_func)(ctx, rnn, cell_position, cell_dst_layer,
-                    cell_dst_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
-                    SAFE_PTR(diff_augru_attention, iter, 0, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
-                    SAFE_PTR(weights_layer, lay, dir, 0),
-                    SAFE_PTR(weights_iter, lay, dir, 0),
-                    SAFE_PTR(weights_projection, lay, dir),
-                    SAFE_PTR(weights_peephole, lay, dir, 0),
-                    w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
-                                : nullptr,
-                    bias(lay, dir), cell_src_layer,
-                    SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
-                    cell_src_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
-                    SAFE_PTR(diff_weights_layer, lay, dir, 0),
-                    SAFE_PTR(diff_weights_iter, lay, dir, 0),
-                    SAFE_PTR(diff_weights_projection, lay, dir, 0),
-                    SAFE_PTR(diff_weights_peephole, lay, dir, 0),
-                    SAFE_PTR(diff_bias, lay, dir, 0),
-                    SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
-                    proj_ht, scratch_diff_ht_,
-                    SAFE_PTR(ws_grid, lay, dir, iter, 0), scratch_cell_,
-                    scratch_gates_blocked_, scratch_src_layer_,
-                    scratch_src_iter_, cell_dst_iter, amx_scratchpad,
-                    addr_batch_global));
-#else
-            CHECK((this->*cell_func)(ctx, rnn, cell_position, cell_dst_layer,
-                    cell_dst_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
-                    SAFE_PTR(diff_augru_attention, iter, 0, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
-                    SAFE_PTR(weights_layer, lay, dir, 0),
-                    SAFE_PTR(weights_iter, lay, dir, 0),
-                    SAFE_PTR(weights_projection, lay, dir),
-                    SAFE_PTR(weights_peephole, lay, dir, 0),
-                    w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
-                                : nullptr,
-                    bias(lay, dir), cell_src_layer,
-                    SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
-                    cell_src_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
-                    SAFE_PTR(diff_weights_layer, lay, dir, 0),
-                    SAFE_PTR(diff_weights_iter, lay, dir, 0),
-                    SAFE_PTR(diff_weights_projection, lay, dir, 0),
-                    SAFE_PTR(diff_weights_peephole, lay, dir, 0),
-                    SAFE_PTR(diff_bias, lay, dir, 0),
-                    SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
-                    proj_ht, scratch_diff_ht_,
-                    SAFE_PTR(ws_grid, lay, dir, iter, 0), scratch_cell_,
-                    cell_dst_iter, amx_scratchpad));
-#endif
+            CHECK(execute_cell(dir, j, lay, iter, 0));
         }
 
         CHECK(compute_merged_layer_part_if_applicable(
@@ -2274,6 +2408,21 @@ status_t ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
                     ws_diff_states_iter_c);
     }
 
+    // Time steps past the length of a sample produce no output.
+    if (rnn.with_seq_lengths) {
+        const auto seq_lengths
+                = CTX_IN_MEM(const int32_t *, DNNL_ARG_SEQ_LENGTHS);
+        const memory_desc_wrapper dst_layer_d(pd()->dst_md(0));
+        const auto dst_layer_dt = dst_layer_d.data_type();
+        const dim_t dlc = pd()->DLC();
+        parallel_nd(rnn.n_iter, rnn.mb, [&](dim_t t, dim_t b) {
+            if (t < seq_lengths[b]) return;
+            for (dim_t c = 0; c < dlc; c++)
+                io::store_float_value(dst_layer_dt, 0.f, dst_layer,
+                        dst_layer_d.off(t, b, c));
+        });
+    }
+
     return status::success;
 };
 /* Fix for MSVS warning C4661 */
@@ -21,6 +21,7 @@
 #include <type_traits>
 
 #include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
 #include "common/memory_desc_wrapper.hpp"
 #include "common/primitive.hpp"
 #include "common/utils.hpp"
@@ -410,6 +411,12 @@ struct rnn_conf_t {
 
     bool diff_weights_overwrite = false;
     bool use_matmul = false;
+    // Per-sample sequence lengths are passed as DNNL_ARG_SEQ_LENGTHS.
+    bool with_seq_lengths = false;
+    // Cells on the same anti-diagonal of the grid (layer + iteration) are
+    // independent and may run concurrently, each with its own scratch.
+    bool use_wavefront = false;
+    int n_wavefront_lanes = 1;
 
     inline bool is_int8_conf() const {
         return is_signed_int8_conf() || is_unsigned_int8_conf();
@@ -679,6 +686,39 @@ bool is_ldoi_blocked(const memory_desc_wrapper &md);
 
 int get_good_ld(int dim, int sizeof_dt);
 
+// Largest number of multiply-adds in the GEMMs of a cell for which cells of
+// the grid are executed as a wavefront.
+constexpr dim_t wavefront_max_cell_work = 1 << 18;
+
+// An internal env var is provided for oneDNN debug and testing only: 0
+// disables the wavefront, 1 forces it regardless of the size of the cells
+// and of the implementations available.
+inline int get_wavefront_mode() {
+    static const int mode = getenv_int("_ONEDNN_RNN_WAVEFRONT", -1);
+    return mode;
+}
+
+// Cell (l, t) only depends on cells (l - 1, t) and (l, t - 1), so when a cell
+// is too small to keep all threads busy, the cells of an anti-diagonal of the
+// grid are executed concurrently, one per thread. Each cell then needs its
+// own scratch, which the per-thread buffers of the brgemm and matmul cells do
+// not provide, so the wavefront is only used with the reference gemm cells.
+// Unless it is forced, it doesn't replace the brgemm and matmul cells since
+// it wasn't measured to outperform them.
+inline bool is_wavefront_applicable(const rnn_conf_t &rnn) {
+    const int mode = get_wavefront_mode();
+    if (mode == 0) return false;
+
+    const dim_t cell_work = static_cast<dim_t>(rnn.mb) * rnn.n_gates * rnn.dhc
+            * (rnn.slc + rnn.sic);
+    const bool is_small_cell = dnnl_get_max_threads() > 1
+            && cell_work <= wavefront_max_cell_work;
+    return rnn.is_fwd && !rnn.is_training && rnn.is_f32_conf()
+            && rnn.is_cell_dt_f32() && !rnn.is_lstm_projection
+            && !rnn.with_seq_lengths && rnn.n_layer > 1 && rnn.n_iter > 1
+            && (mode > 0 || is_small_cell);
+}
+
 template <typename T>
 bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
         const primitive_attr_t &attr, const memory_desc_wrapper &src_layer_d,
@@ -953,6 +993,26 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
             : false;
 
     rnn.diff_weights_overwrite = rd.flags & rnn_flags::diff_weights_overwrite;
+    rnn.with_seq_lengths = rd.flags & rnn_flags::seq_lengths;
+
+    // The wavefront requires a dedicated gates scratch per cell, which is not
+    // compatible with the matmul cells and the merged GEMMs across iterations.
+    rnn.use_wavefront = !rnn.is_brgemm
+            && IMPLICATION(rnn.use_matmul, get_wavefront_mode() > 0)
+            && is_wavefront_applicable(rnn);
+    rnn.n_wavefront_lanes = rnn.use_wavefront
+            ? nstl::max(1,
+                    nstl::min(dnnl_get_max_threads(),
+                            rnn.n_dir * nstl::min(rnn.n_layer, rnn.n_iter)))
+            : 1;
+    if (rnn.use_wavefront) {
+        rnn.use_matmul = false;
+        rnn.merge_gemm_layer = false;
+        rnn.merge_gemm_iter = false;
+        rnn.use_layer_packed_gemm = false;
+        rnn.use_iter_packed_gemm = false;
+        rnn.use_projection_packed_gemm = false;
+    }
 
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL || BUILD_GEMM_KERNELS_NONE
     // XXX: Threadpool runtime may use different number of threads at execute
@@ -1167,8 +1227,8 @@ void set_workspace_sizes(rnn_conf_t &rnn, const rnn_desc_t &rd) {
     rnn.n_iter_scratch_gates
             = (rnn.merge_gemm_layer || rnn.merge_gemm_iter) ? rnn.n_iter : 1;
     rnn.scratch_gates_size = sizeof(typename T::scratch_t)
-            * rnn.n_iter_scratch_gates * rnn.scratch_gates_nld
-            * rnn.scratch_gates_ld;
+            * rnn.n_iter_scratch_gates * rnn.n_wavefront_lanes
+            * rnn.scratch_gates_nld * rnn.scratch_gates_ld;
     rnn.scratch_ht_size
             = sizeof(typename T::ht_t) * rnn.scratch_ht_nld * rnn.scratch_ht_ld;
     rnn.scratch_diff_ht_size = rnn.is_training ? sizeof(typename T::gemm_acc_t)
@@ -1180,8 +1240,8 @@ void set_workspace_sizes(rnn_conf_t &rnn, const rnn_desc_t &rd) {
     rnn.scratch_cell_size = (utils::one_of(rd.cell_kind, alg_kind::vanilla_gru,
                                      alg_kind::vanilla_augru, alg_kind::lbr_gru,
                                      alg_kind::lbr_augru)
-                    ? sizeof(typename T::scratch_t) * rnn.scratch_gates_nld
-                            * rnn.scratch_gates_ld
+                    ? sizeof(typename T::scratch_t) * rnn.n_wavefront_lanes
+                            * rnn.scratch_gates_nld * rnn.scratch_gates_ld
                     : 0);
     /// workspace needed for lbr GRU
     rnn.ws_per_cell = (size_t)rnn.is_lbr * rnn.mb * rnn.dhc
@@ -0,0 +1,247 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <float.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/int4.hpp"
+#include "common/math_utils.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/simple_gather.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+// Number of indices ahead of the current one whose rows are prefetched.
+constexpr dim_t prefetch_distance = 4;
+
+inline void prefetch_row(const void *row, size_t size) {
+#if defined(__GNUC__) || defined(__clang__)
+    const char *p = static_cast<const char *>(row);
+    for (size_t off = 0; off < size; off += platform::get_cache_line_size())
+        __builtin_prefetch(p + off, /* rw = */ 0, /* locality = */ 1);
+#else
+    UNUSED(row);
+    UNUSED(size);
+#endif
+}
+
+template <typename data_t>
+inline float load_elem(const void *row, dim_t i) {
+    return static_cast<float>(static_cast<const data_t *>(row)[i]);
+}
+
+template <>
+inline float load_elem<int4_t>(const void *row, dim_t i) {
+    const nibble2_t nibble_pair(static_cast<const uint8_t *>(row)[i / 2]);
+    return static_cast<float>(int4_t(nibble_pair.get(i % 2)));
+}
+
+template <>
+inline float load_elem<uint4_t>(const void *row, dim_t i) {
+    const nibble2_t nibble_pair(static_cast<const uint8_t *>(row)[i / 2]);
+    return static_cast<float>(uint4_t(nibble_pair.get(i % 2)));
+}
+
+// Dequantizes a table row and folds it into the f32 accumulator.
+template <typename data_t, bool is_max>
+void accumulate_row(
+        float *acc, const void *row, dim_t cols, float scale, float zp) {
+    if (is_max) {
+        for (dim_t c = 0; c < cols; ++c)
+            acc[c] = nstl::max(
+                    acc[c], (load_elem<data_t>(row, c) - zp) * scale);
+    } else {
+        PRAGMA_OMP_SIMD()
+        for (dim_t c = 0; c < cols; ++c)
+            acc[c] += (load_elem<data_t>(row, c) - zp) * scale;
+    }
+}
+
+using accumulate_row_fn_t
+        = void (*)(float *, const void *, dim_t, float, float);
+
+template <bool is_max>
+accumulate_row_fn_t get_accumulate_row_fn(data_type_t dt) {
+    using namespace data_type;
+    switch (dt) {
+        case f32: return accumulate_row<float, is_max>;
+        case bf16: return accumulate_row<bfloat16_t, is_max>;
+        case f16: return accumulate_row<float16_t, is_max>;
+        case s8: return accumulate_row<int8_t, is_max>;
+        case u8: return accumulate_row<uint8_t, is_max>;
+        case s4: return accumulate_row<int4_t, is_max>;
+        case u4: return accumulate_row<uint4_t, is_max>;
+        default: assert(!"unsupported data type");
+    }
+    return nullptr;
+}
+
+} // namespace
+
+status_t simple_gather_t::execute_forward(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+    const auto table = CTX_IN_MEM(const void *, DNNL_ARG_TABLE);
+    const auto indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_INDICES);
+    const auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_OFFSETS);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    if (pd()->has_zero_dim_memory()) return status::success;
+
+    DEFINE_ARG_SCALES_BUFFER(table_scales, DNNL_ARG_TABLE);
+    DEFINE_ZERO_POINTS_BUFFER(table_zero_points, DNNL_ARG_TABLE);
+
+    const memory_desc_wrapper table_d(pd()->table_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const dim_t rows = pd()->rows();
+    const dim_t cols = pd()->cols();
+    const dim_t n_indices = pd()->n_indices();
+    const dim_t n_bags = pd()->n_bags();
+    const bool with_offsets = pd()->with_offsets();
+    const alg_kind_t alg = pd()->desc()->alg_kind;
+    const bool is_max = with_offsets && alg == alg_kind::reduction_max;
+    const bool is_mean = with_offsets && alg == alg_kind::reduction_mean;
+
+    const auto table_dt = table_d.data_type();
+    const size_t row_size = cols * types::data_type_bits(table_dt) / 8;
+    const auto accumulate = is_max ? get_accumulate_row_fn<true>(table_dt)
+                                   : get_accumulate_row_fn<false>(table_dt);
+
+    const auto &attr_scales = pd()->attr()->scales_;
+    const bool per_row_scales = pd()->with_scales()
+            && attr_scales.get_mask(DNNL_ARG_TABLE) != 0;
+    const auto scales_dt = attr_scales.get_data_type(DNNL_ARG_TABLE);
+    const auto &attr_zps = pd()->attr()->zero_points_;
+    const bool with_zero_points = pd()->with_zero_points();
+    const bool per_row_zero_points
+            = with_zero_points && attr_zps.get_mask(DNNL_ARG_TABLE) != 0;
+    const auto zero_points_dt = attr_zps.get_data_type(DNNL_ARG_TABLE);
+
+    const bool with_post_ops = !pd()->attr()->post_ops_.has_default_values();
+    const auto sum_dt = pd()->attr()->post_ops_.get_sum_dt(dst_d.data_type());
+    const auto dst_dt = dst_d.data_type();
+
+    // Offsets come from the user, so they are clamped to the indices and a
+    // bag ending before its beginning is empty.
+    auto clamp_offset = [&](int32_t off, dim_t lo) {
+        return nstl::min(nstl::max(static_cast<dim_t>(off), lo), n_indices);
+    };
+
+    auto row_ptr = [&](dim_t r) {
+        return static_cast<const char *>(table) + r * row_size;
+    };
+
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    float *acc_base = scratchpad.template get<float>(
+            memory_tracking::names::key_gather_acc);
+    const dim_t acc_stride = acc_row_stride(cols);
+
+    const int nthr = pd()->nthr_;
+    parallel(nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(n_bags, nthr, ithr, start, end);
+        if (start == end) return;
+
+        float *acc = acc_base + ithr * acc_stride;
+
+        for (dim_t b = start; b < end; ++b) {
+            const dim_t i_beg = with_offsets ? clamp_offset(offsets[b], 0) : b;
+            const dim_t i_end = with_offsets
+                    ? (b + 1 < n_bags ? clamp_offset(offsets[b + 1], i_beg)
+                                      : n_indices)
+                    : b + 1;
+
+            const float init = is_max ? -FLT_MAX : 0.f;
+            for (dim_t c = 0; c < cols; ++c)
+                acc[c] = init;
+
+            // Rows for the first indices of the bag are already in flight
+            // when the previous bag prefetched ahead.
+            if (b == start) {
+                for (dim_t i = i_beg;
+                        i < nstl::min(i_beg + prefetch_distance, i_end); ++i) {
+                    const dim_t r = indices[i];
+                    if (r >= 0 && r < rows) prefetch_row(row_ptr(r), row_size);
+                }
+            }
+
+            dim_t n_valid = 0;
+            for (dim_t i = i_beg; i < i_end; ++i) {
+                // The prefetch window crosses bag boundaries, so the next bag
+                // of this thread starts with warm rows.
+                const dim_t i_pf = i + prefetch_distance;
+                if (i_pf < n_indices) {
+                    const dim_t r_pf = indices[i_pf];
+                    if (r_pf >= 0 && r_pf < rows)
+                        prefetch_row(row_ptr(r_pf), row_size);
+                }
+
+                // Out of range indices do not contribute to the bag.
+                const dim_t r = indices[i];
+                if (r < 0 || r >= rows) continue;
+
+                const float scale = per_row_scales
+                        ? io::load_float_value(scales_dt, table_scales, r)
+                        : table_scales[0];
+                const float zp = with_zero_points
+                        ? static_cast<float>(io::load_int_value(zero_points_dt,
+                                table_zero_points, per_row_zero_points ? r : 0))
+                        : 0.f;
+                accumulate(acc, row_ptr(r), cols, scale, zp);
+                n_valid++;
+            }
+
+            if (n_valid == 0) {
+                for (dim_t c = 0; c < cols; ++c)
+                    acc[c] = 0.f;
+            } else if (is_mean) {
+                const float inv_n = 1.f / n_valid;
+                PRAGMA_OMP_SIMD()
+                for (dim_t c = 0; c < cols; ++c)
+                    acc[c] *= inv_n;
+            }
+
+            for (dim_t c = 0; c < cols; ++c) {
+                const dim_t dst_off = b * cols + c;
+                float d = acc[c];
+                if (with_post_ops) {
+                    ref_post_ops_t::args_t args;
+                    args.dst_val = io::load_float_value(sum_dt, dst, dst_off);
+                    args.ctx = &ctx;
+                    args.l_offset = dst_off;
+                    args.dst_md = pd()->dst_md();
+                    ref_post_ops->execute(d, args);
+                }
+                io::store_float_value(dst_dt, d, dst, dst_off);
+            }
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
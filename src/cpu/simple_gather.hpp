@@ -0,0 +1,139 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_GATHER_HPP
+#define CPU_SIMPLE_GATHER_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_gather_pd.hpp"
+#include "cpu/platform.hpp"
+#include "cpu/primitive_attr_postops.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Gather / embedding bag over a plain [rows, cols] table.
+//
+// Work is distributed over output rows (bags). Each thread accumulates a bag
+// in f32 in its own scratchpad row, which keeps dequantization, reduction,
+// post-ops and down-conversion in cache. Rows referenced by upcoming indices
+// of a bag are software-prefetched since the access pattern is random and
+// defeats the hardware prefetcher.
+struct simple_gather_t : public primitive_t {
+    struct pd_t : public cpu_gather_pd_t {
+        using cpu_gather_pd_t::cpu_gather_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_gather_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+            const auto table_dt = table_md()->data_type;
+            const auto dst_dt = dst_md()->data_type;
+
+            VDISPATCH_GATHER(
+                    utils::one_of(table_dt, f32, bf16, f16, s8, u8, s4, u4)
+                            && platform::has_data_type_support(table_dt),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_GATHER(utils::one_of(dst_dt, f32, bf16, f16)
+                            && platform::has_data_type_support(dst_dt),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_GATHER(attr()->has_default_values(
+                                     skip_mask_t::scales_data_type
+                                     | skip_mask_t::zero_points_data_type
+                                     | skip_mask_t::post_ops),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_GATHER(
+                    ref_post_ops_t::primitive_kind_ok(attr()->post_ops_),
+                    VERBOSE_UNSUPPORTED_POSTOP);
+            VDISPATCH_GATHER(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_GATHER(memory_desc_wrapper(table_md()).matches_tag(
+                                     format_tag::ab)
+                            && memory_desc_wrapper(dst_md()).matches_tag(
+                                    format_tag::ab)
+                            && memory_desc_wrapper(indices_md()).matches_tag(
+                                    format_tag::a),
+                    VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_GATHER(IMPLICATION(with_offsets(),
+                                     memory_desc_wrapper(offsets_md())
+                                             .matches_tag(format_tag::a)),
+                    VERBOSE_UNSUPPORTED_TAG);
+            // Every row of an int4 table has to start on a byte boundary.
+            VDISPATCH_GATHER(IMPLICATION(utils::one_of(table_dt, s4, u4),
+                                     cols() % 2 == 0),
+                    VERBOSE_BAD_DIM, "table", 1);
+            VDISPATCH_GATHER(
+                    attr_.set_default_formats(dst_md(0)) == status::success,
+                    VERBOSE_UNSUPPORTED_POSTOP);
+
+            nthr_ = dnnl_get_max_threads();
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        int nthr_ = 0;
+
+    private:
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.template book<float>(key_gather_acc,
+                    static_cast<size_t>(nthr_) * acc_row_stride(cols()));
+        }
+    };
+
+    simple_gather_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        ref_post_ops
+                = utils::make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
+        if (!ref_post_ops) return status::out_of_memory;
+        CHECK(ref_post_ops->init(pd()->dst_md()));
+        return status::success;
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+    // Per-thread accumulation rows are padded to a full cache line to avoid
+    // false sharing between threads.
+    static dim_t acc_row_stride(dim_t cols) {
+        constexpr dim_t floats_per_line
+                = platform::get_cache_line_size() / sizeof(float);
+        return utils::rnd_up(cols, floats_per_line);
+    }
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+
+    std::unique_ptr<ref_post_ops_t> ref_post_ops;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
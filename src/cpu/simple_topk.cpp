@@ -0,0 +1,209 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/math_utils.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/simple_topk.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+// Number of consecutive elements checked against the current threshold at
+// once. A block without a candidate costs a single vectorized comparison.
+constexpr dim_t block_size = 16;
+
+// Ordering used for the selection, on values negated for reduction_min. NaN is
+// greater than any number, as in the common frameworks, so it is the best
+// value of reduction_max and the worst one of reduction_min.
+template <bool nan_is_best>
+inline bool better(float a, float b) {
+    if (nan_is_best) return a > b || (std::isnan(a) && !std::isnan(b));
+    return a > b || (!std::isnan(a) && std::isnan(b));
+}
+
+// Inserts `v` at position `j` into the list of `k` best values sorted in
+// descending order. The caller guarantees `v` is better than the last entry.
+// Equal values keep their order, so the lower position wins ties.
+template <bool nan_is_best>
+inline void insert(float *top_v, int32_t *top_i, dim_t k, float v, dim_t j) {
+    dim_t pos = k - 1;
+    for (; pos > 0 && better<nan_is_best>(v, top_v[pos - 1]); --pos) {
+        top_v[pos] = top_v[pos - 1];
+        top_i[pos] = top_i[pos - 1];
+    }
+    top_v[pos] = v;
+    top_i[pos] = static_cast<int32_t>(j);
+}
+
+template <bool nan_is_best>
+void select_by_insertion(const float *v, dim_t n, dim_t k, float *top_v,
+        int32_t *top_i) {
+    // The first `k` elements seed the list.
+    for (dim_t j = 0; j < k; ++j) {
+        top_v[j] = v[j];
+        top_i[j] = static_cast<int32_t>(j);
+        insert<nan_is_best>(top_v, top_i, j + 1, v[j], j);
+    }
+
+    for (dim_t j_blk = k; j_blk < n; j_blk += block_size) {
+        const dim_t j_end = nstl::min(j_blk + block_size, n);
+        const float thr = top_v[k - 1];
+        // Any number beats a NaN threshold when NaN is the worst value.
+        int has_candidate = !nan_is_best && thr != thr;
+        PRAGMA_OMP_SIMD(reduction(| : has_candidate))
+        for (dim_t j = j_blk; j < j_end; ++j)
+            has_candidate |= (v[j] > thr) | (nan_is_best && v[j] != v[j]);
+        if (!has_candidate) continue;
+
+        for (dim_t j = j_blk; j < j_end; ++j)
+            if (better<nan_is_best>(v[j], top_v[k - 1]))
+                insert<nan_is_best>(top_v, top_i, k, v[j], j);
+    }
+}
+
+template <bool nan_is_best>
+void select_by_partial_sort(const float *v, dim_t n, dim_t k, float *top_v,
+        int32_t *top_i, int32_t *idx) {
+    for (dim_t j = 0; j < n; ++j)
+        idx[j] = static_cast<int32_t>(j);
+    std::partial_sort(idx, idx + k, idx + n, [&](int32_t a, int32_t b) {
+        return better<nan_is_best>(v[a], v[b])
+                || (!better<nan_is_best>(v[b], v[a]) && a < b);
+    });
+    for (dim_t j = 0; j < k; ++j) {
+        top_i[j] = idx[j];
+        top_v[j] = v[idx[j]];
+    }
+}
+
+} // namespace
+
+status_t simple_topk_t::execute_forward(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+    const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+    auto dst_indices
+            = CTX_OUT_CLEAN_MEM(int32_t *, DNNL_ARG_DST_INDICES, status);
+    CHECK(status);
+
+    if (pd()->has_zero_dim_memory()) return status::success;
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+
+    const dim_t n = pd()->axis_size();
+    const dim_t k = pd()->k();
+    const dim_t outer = pd()->outer_size();
+    const dim_t inner = pd()->inner_size();
+    const bool with_softmax = pd()->with_softmax();
+    const bool use_insertion = pd()->use_insertion();
+
+    const auto src_dt = pd()->src_md()->data_type;
+    const auto dst_dt = pd()->dst_md()->data_type;
+
+    // The smallest values are selected as the largest negated ones, which
+    // keeps a single selection kernel.
+    const bool is_max = pd()->is_max();
+    const float sign = is_max ? 1.f : -1.f;
+    const float scale = sign * src_scales[0];
+    // Rows along the innermost axis of an f32 source are read in place.
+    const bool read_in_place
+            = inner == 1 && src_dt == data_type::f32 && scale == 1.f;
+
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    float *val_base = scratchpad.template get<float>(
+            memory_tracking::names::key_topk_val);
+    int32_t *idx_base = scratchpad.template get<int32_t>(
+            memory_tracking::names::key_topk_idx);
+    const dim_t val_stride = pd()->val_stride();
+    const dim_t idx_stride = pd()->idx_stride();
+
+    const int nthr = pd()->nthr_;
+    parallel(nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(outer * inner, nthr, ithr, start, end);
+        if (start == end) return;
+
+        float *row = val_base + ithr * val_stride;
+        float *top_v = row + pd()->row_stride();
+        int32_t *top_i = idx_base + ithr * idx_stride;
+        // The partial sort permutes positions in place and copies the best
+        // ones out, so the two buffers may alias.
+        int32_t *idx = top_i;
+
+        for (dim_t r = start; r < end; ++r) {
+            const dim_t ou = r / inner;
+            const dim_t in = r % inner;
+            const dim_t src_off = ou * n * inner + in;
+            const dim_t dst_off = ou * k * inner + in;
+
+            const float *v = row;
+            if (read_in_place) {
+                v = static_cast<const float *>(src) + src_off;
+            } else {
+                for (dim_t j = 0; j < n; ++j)
+                    row[j] = scale
+                            * io::load_float_value(
+                                    src_dt, src, src_off + j * inner);
+            }
+
+            if (use_insertion && is_max)
+                select_by_insertion<true>(v, n, k, top_v, top_i);
+            else if (use_insertion)
+                select_by_insertion<false>(v, n, k, top_v, top_i);
+            else if (is_max)
+                select_by_partial_sort<true>(v, n, k, top_v, top_i, idx);
+            else
+                select_by_partial_sort<false>(v, n, k, top_v, top_i, idx);
+
+            if (with_softmax) {
+                // Values are sorted, so the first one is the maximum.
+                const float max = top_v[0];
+                float sum = 0.f;
+                for (dim_t j = 0; j < k; ++j) {
+                    top_v[j] = ::expf(top_v[j] - max);
+                    sum += top_v[j];
+                }
+                const float inv_sum = 1.f / sum;
+                for (dim_t j = 0; j < k; ++j)
+                    top_v[j] *= inv_sum;
+            }
+
+            for (dim_t j = 0; j < k; ++j) {
+                const float val = with_softmax ? top_v[j] : sign * top_v[j];
+                io::store_float_value(dst_dt, val, dst, dst_off + j * inner);
+                dst_indices[dst_off + j * inner] = top_i[j];
+            }
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,125 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_TOPK_HPP
+#define CPU_SIMPLE_TOPK_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/tag_traits.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_topk_pd.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Top-k over plain dense tensors.
+//
+// Work is distributed over the independent selections (all positions except
+// the axis). For small `k` a sorted candidate list is maintained and the input
+// is scanned in blocks compared against the current k-th best value with a
+// vectorized check, so that most blocks are rejected without touching the
+// list. Larger `k` fall back to a partial sort of the positions.
+struct simple_topk_t : public primitive_t {
+    struct pd_t : public cpu_topk_pd_t {
+        using cpu_topk_pd_t::cpu_topk_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_topk_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+            const auto src_dt = src_md()->data_type;
+            const auto dst_dt = dst_md()->data_type;
+
+            VDISPATCH_TOPK(utils::one_of(src_dt, f32, bf16, f16)
+                            && platform::has_data_type_support(src_dt),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_TOPK(utils::one_of(dst_dt, f32, bf16, f16)
+                            && platform::has_data_type_support(dst_dt),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_TOPK(
+                    attr()->has_default_values(skip_mask_t::scales_data_type),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_TOPK(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+
+            const auto tag = get_abx_tag(src_md()->ndims);
+            VDISPATCH_TOPK(memory_desc_wrapper(src_md()).matches_tag(tag)
+                            && memory_desc_wrapper(dst_md()).matches_tag(tag)
+                            && memory_desc_wrapper(dst_indices_md())
+                                       .matches_tag(tag),
+                    VERBOSE_UNSUPPORTED_TAG);
+
+            nthr_ = dnnl_get_max_threads();
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        int nthr_ = 0;
+
+        // Above this `k` a partial sort is cheaper than insertions into the
+        // sorted candidate list.
+        static constexpr dim_t max_k_for_insertion = 32;
+        bool use_insertion() const { return k() <= max_k_for_insertion; }
+
+        // Per-thread f32 buffer: the converted input row followed by the
+        // values of the best candidates.
+        dim_t row_stride() const { return utils::rnd_up(axis_size(), simd_w); }
+        dim_t val_stride() const {
+            return row_stride() + utils::rnd_up(k(), simd_w);
+        }
+        dim_t idx_stride() const {
+            return utils::rnd_up(nstl::max(axis_size(), k()), simd_w);
+        }
+
+    private:
+        // Keeps per-thread buffers a multiple of a cache line apart.
+        static constexpr dim_t simd_w
+                = platform::get_cache_line_size() / sizeof(float);
+
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.template book<float>(
+                    key_topk_val, static_cast<size_t>(nthr_) * val_stride());
+            scratchpad.template book<int32_t>(
+                    key_topk_idx, static_cast<size_t>(nthr_) * idx_stride());
+        }
+    };
+
+    simple_topk_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -764,8 +764,11 @@ int brgemm_cmp(const brgemm_desc_t &lhs, const brgemm_desc_t &rhs) {
     CMP_BRGEMM_FIELD(brgattr.hint_prefetching);
     CMP_BRGEMM_FIELD(brgattr.hint_prfA.dist1);
     CMP_BRGEMM_FIELD(brgattr.hint_prfA.dist2);
+    CMP_BRGEMM_FIELD(brgattr.hint_prfB.dist0);
     CMP_BRGEMM_FIELD(brgattr.hint_prfB.dist1);
     CMP_BRGEMM_FIELD(brgattr.hint_prfB.dist2);
+    CMP_BRGEMM_FIELD(brgattr.hint_prfB.distNTA);
+    CMP_BRGEMM_FIELD(brgattr.hint_B_streamed);
     CMP_BRGEMM_FIELD(brgattr.hint_prfC.dist1);
     CMP_BRGEMM_FIELD(brgattr.hint_prfC.dist2);
     CMP_BRGEMM_FIELD(brgattr.wary_A_k_tail_read);
@@ -169,7 +169,13 @@ struct DNNL_API brgemm_attr_t {
     brgemm_kernel_loop_order_t hint_loop_order;
     brgemm_kernel_prefetching_t hint_prefetching
             = brgemm_kernel_prefetching_t::brgemm_prf_default;
+    // For the non-AMX kernel, prefetch distances of B are given in blocks
+    // by reduce dimension.
     brgemm_prf_t hint_prfA, hint_prfB, hint_prfC;
+    // B is read only once and comes from memory, e.g. the weights of a
+    // GEMV-like problem. Unless hint_prfB is set, the non-AMX kernel then
+    // prefetches B at distances derived from the blocking and cache sizes.
+    bool hint_B_streamed {false};
 
     // This parameter determines how we will read the tail by K dimension from
     // matrix A. For AMX if the parameter is true then the brgemm will first
@@ -767,6 +767,30 @@ status_t brgemm_blocking_vmm(brgemm_desc_t *brg) {
     return status::success;
 }
 
+// Sets prefetch distances of a streamed B for the non-AMX kernel. B is
+// prefetched to L2 far enough ahead to hide the memory latency, and then to
+// L1 shortly before it is used. Each distance keeps the data in flight to a
+// small part of the target cache.
+void set_B_prefetch_distances(brgemm_desc_t *brg) {
+    const auto &hint = brg->brgattr.hint_prfB;
+    if (!brg->brgattr.hint_B_streamed
+            || utils::one_of(true, hint.dist0 >= 0, hint.dist1 >= 0,
+                    hint.dist2 >= 0, hint.distNTA >= 0))
+        return;
+
+    const dim_t L1 = platform::get_per_core_cache_size(1);
+    const dim_t L2 = platform::get_per_core_cache_size(2);
+    // B bytes read by a block of columns per block by reduce dimension.
+    const dim_t rdb_bytes = static_cast<dim_t>(brg->typesize_B)
+            * brg->rd_block * brg->ld_block2 * brg->ld_block;
+    if (rdb_bytes <= 0) return;
+
+    const dim_t dist0 = nstl::max<dim_t>(1, L1 / 32 / rdb_bytes);
+    const dim_t dist1 = nstl::max<dim_t>(dist0 + 1, L2 / 256 / rdb_bytes);
+    brg->prfB.dist0 = static_cast<int>(dist0);
+    brg->prfB.dist1 = static_cast<int>(nstl::min<dim_t>(dist1, INT_MAX));
+}
+
 status_t brgemm_blocking(brgemm_desc_t *brg) {
     const data_type_t ld_step_compute_dt = get_mac_emu_data_type(
             brg->dt_b, brg->isa_impl, brg->isa_impl != avx2_vnni_2);
@@ -787,8 +811,10 @@ status_t brgemm_blocking(brgemm_desc_t *brg) {
 
     if (brg->is_tmm)
         CHECK(brgemm_blocking_tmm(brg));
-    else
+    else {
         CHECK(brgemm_blocking_vmm(brg));
+        set_B_prefetch_distances(brg);
+    }
 
     if (!IMPLICATION(brg->brgattr.LDB2 == 0, brg->load_dim <= brg->LDB))
         return status::invalid_arguments;
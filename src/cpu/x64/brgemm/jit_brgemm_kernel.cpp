@@ -2394,12 +2394,41 @@ void jit_brgemm_kernel_t<Wmm>::gemm_microkernel(dim_t bd_block2,
         compute_int8_compensation(
                 rd_loop, bd_b, bd_e, bd_block, ld_block2, is_ld_tail, vpad);
 
+    // When prefetch distances of B are set, the columns of B are prefetched
+    // that many blocks by reduce dimension ahead for each cache level.
+    // Otherwise, B is prefetched to L1 one block ahead for as many columns
+    // as there are rows in the block.
+    const int prf_B_dists[] = {brg.prfB.dist0, brg.prfB.dist1,
+            brg.prfB.dist2, brg.prfB.distNTA};
+    std::vector<std::pair<int, dim_t>> prfs_B; // (cache level, column)
+    int max_prf_B_dist = 1;
+    for (int level = 0; level < 4; level++) {
+        if (prf_B_dists[level] <= 0) continue;
+        max_prf_B_dist = nstl::max(max_prf_B_dist, prf_B_dists[level]);
+        for (dim_t ld = 0; ld < ld_block2; ld++)
+            prfs_B.emplace_back(level, ld);
+    }
+    const auto prefetch_B = [&](const std::pair<int, dim_t> &prf, dim_t rd) {
+        const dim_t offset = B_offset(prf.second, rd)
+                + prf_B_dists[prf.first] * rdb_B_offset();
+        const auto addr = is_superset(brg.isa_impl, avx512_core)
+                ? EVEX_compress_addr_safe(
+                        reg_aux_B, offset, reg_tmp_microkernel)
+                : make_safe_addr(reg_aux_B, offset, reg_tmp_microkernel);
+        switch (prf.first) {
+            case 0: prefetcht0(addr); break;
+            case 1: prefetcht1(addr); break;
+            case 2: prefetcht2(addr); break;
+            default: prefetchnta(addr); break;
+        }
+    };
+
     // Sometimes the offset used for prefetching is too big and needs to be
     // handled with an additional temporary register.
     // `reg_aux_C` and `reg_tmp_microkernel` are aliases for `r14` so we need to
     // save its content.
     const dim_t max_prefetch_offset = B_offset(ld_block2 - 1, rd_loop - 1)
-            + static_cast<dim_t>(brg.LDB) * brg.rd_block * brg.typesize_B;
+            + max_prf_B_dist * rdb_B_offset();
     if (max_prefetch_offset > INT_MAX)
         mov(ptr[rsp + reg_aux_C_backup_offs_], reg_aux_C);
 
@@ -2430,9 +2459,12 @@ void jit_brgemm_kernel_t<Wmm>::gemm_microkernel(dim_t bd_block2,
                     }
                 }
             }
+            for (const auto &prf : prfs_B)
+                prefetch_B(prf, rd);
 
         } else {
             dim_t prefetch_count_B = 0;
+            size_t prf_B_idx = 0;
             for (dim_t ld = 0; ld < ld_block2; ld++) {
                 load_B(ld, rd, ld);
             }
@@ -2441,7 +2473,10 @@ void jit_brgemm_kernel_t<Wmm>::gemm_microkernel(dim_t bd_block2,
                 if (!is_emdbd) broadcast_A(bcst(), bd, rd);
                 if (brg.is_fp8_via_convert_non_amx())
                     maybe_pre_process_data(brg.dt_a, bcst(), vmm_fp8_bcst());
-                if (prefetch_count_B < ld_block2) {
+                if (!prfs_B.empty()) {
+                    if (prf_B_idx < prfs_B.size())
+                        prefetch_B(prfs_B[prf_B_idx++], rd);
+                } else if (prefetch_count_B < ld_block2) {
                     const dim_t prefetch_offset
                             = B_offset(prefetch_count_B++, rd)
                             + static_cast<dim_t>(brg.LDB) * brg.rd_block
@@ -2471,6 +2506,9 @@ void jit_brgemm_kernel_t<Wmm>::gemm_microkernel(dim_t bd_block2,
                     }
                 }
             }
+            // Few rows of A leave prefetches to be issued after the block.
+            for (; prf_B_idx < prfs_B.size(); prf_B_idx++)
+                prefetch_B(prfs_B[prf_B_idx], rd);
         }
     }
 
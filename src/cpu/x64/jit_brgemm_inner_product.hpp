@@ -105,6 +105,14 @@ struct brgemm_inner_product_fwd_t : public primitive_t {
             const float beta = 1.0;
             const float beta_init = 0.0;
 
+            // Weights are streamed from memory when all rows of the source
+            // are handled by a single block and they do not fit in L2.
+            const bool wei_streamed = jbgp_.os <= jbgp_.M
+                    && static_cast<dim_t>(jbgp_.ic) * jbgp_.oc
+                                    * types::data_type_size(jbgp_.wei_dt)
+                            > static_cast<dim_t>(
+                                    platform::get_per_core_cache_size(2));
+
             for_(int i_bs = 0; i_bs < 2; i_bs++)
             for_(int i_init = 0; i_init < 2; i_init++)
             for_(int i_M = 0; i_M < 2; i_M++)
@@ -126,6 +134,7 @@ struct brgemm_inner_product_fwd_t : public primitive_t {
                         &brg, attr(), &dst_md_, jbgp_.LDD, jbgp_.bia_dt));
 
                 brgemm_attr_t brgattr;
+                brgattr.hint_B_streamed = wei_streamed;
                 if (jbgp_.is_amx) {
                     brgattr.max_bs = bs;
                     brgattr.wary_A_k_tail_read = false;
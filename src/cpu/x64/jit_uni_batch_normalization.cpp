@@ -27,6 +27,7 @@
 
 #include "cpu/cpu_batch_normalization_utils.hpp"
 #include "cpu/platform.hpp"
+#include "cpu/ref_io_helper.hpp"
 #include "cpu/x64/cpu_barrier.hpp"
 #include "cpu/x64/jit_generator.hpp"
 
@@ -80,10 +81,18 @@ struct jit_bnorm_conf_t {
     int N_nthr_last_iter_ {0};
     int S_nthr_last_iter_ {0};
 
-    jit_bnorm_conf_t(const batch_normalization_pd_t *pd, int nthr, int simd_w)
+    // Single pass statistics: sums of shifted data and of its squares are
+    // accumulated together. Partial sums of squares are kept in the reduction
+    // buffer `rbuf_sqr_off_` elements after the partial sums.
+    bool stats_one_pass_ {false};
+    dim_t rbuf_sqr_off_ {0};
+
+    jit_bnorm_conf_t(const batch_normalization_pd_t *pd, int nthr, int simd_w,
+            bool stats_one_pass = false)
         : pd_(pd)
         , simd_w_(simd_w)
-        , dt_size_(types::data_type_size(pd_->src_md()->data_type)) {
+        , dt_size_(types::data_type_size(pd_->src_md()->data_type))
+        , stats_one_pass_(stats_one_pass) {
 
         const dim_t N = pd_->MB();
         const dim_t C_PADDED = get_c_padded(pd_);
@@ -94,6 +103,7 @@ struct jit_bnorm_conf_t {
 
         const memory_desc_wrapper src_d(pd_->src_md());
         is_nspc_ = is_nspc(src_d);
+        rbuf_sqr_off_ = C_PADDED * nthr;
 
         size_t data_size = dt_size_ * N * C_PADDED * SP;
         const size_t l3_size = platform::get_per_core_cache_size(3) * nthr;
@@ -1094,7 +1104,10 @@ struct jit_bnorm_t : public jit_generator_t {
         mov(reg_coff_max_fwd_copy, reg_coff_max);
 
         Label ch_unroll_label[5];
-        const int max_ch_unroll = isa == avx512_core ? 4 : 2;
+        // Single pass statistics need three registers per channel block.
+        const int max_ch_unroll = jbp_->stats_one_pass_
+                ? (isa == avx512_core ? 3 : 1)
+                : (isa == avx512_core ? 4 : 2);
 
         // TODO: Spatial and channel unrolling decisions should be made during
         // initialization depending on the problem size
@@ -1107,7 +1120,11 @@ struct jit_bnorm_t : public jit_generator_t {
                 jl(ch_unroll_label[ch_idx - 1], T_NEAR);
 
                 const int spat_blk_size = (1 << sp_idx);
-                mean_variance_nspc(ch_blk_size, spat_blk_size, compute_mean);
+                if (jbp_->stats_one_pass_)
+                    mean_var_nspc_one_pass(ch_blk_size, spat_blk_size);
+                else
+                    mean_variance_nspc(
+                            ch_blk_size, spat_blk_size, compute_mean);
 
                 add(reg_src, vlen_spat_data_ * ch_blk_size);
                 add(reg_coff, vlen * ch_blk_size);
@@ -1165,6 +1182,202 @@ struct jit_bnorm_t : public jit_generator_t {
         }
     }
 
+    Address rbuf_sqr_ptr(const Reg64 &reg_off, size_t offt = 0) {
+        return vmmword[reg_rbuf1 + reg_off + offt
+                + jbp_->rbuf_sqr_off_ * sizeof(acc_data_t)];
+    }
+
+    // The shift `K` of the single pass statistics is stored by the driver in
+    // place of the mean. The partial sums of `x - K` and `(x - K)^2` go to the
+    // reduction buffer.
+    void mean_var_channels_one_pass() {
+        Label ch_label;
+        L(ch_label);
+        {
+            uni_vmovups_maybe_tail(vmean, mean_ptr());
+            uni_vmovups(Vmm(0), vmmword[reg_rbuf1 + reg_coff]);
+            uni_vmovups(Vmm(1), rbuf_sqr_ptr(reg_coff));
+            spat_loop(
+                    spat_size, unroll_blocks, unroll_regs,
+                    [this](size_t base_reg) {
+                        Vmm vsum = Vmm(3 * base_reg);
+                        Vmm vsqr_sum = Vmm(3 * base_reg + 1);
+                        if (base_reg > 0) {
+                            uni_vpxor(vsum, vsum, vsum);
+                            uni_vpxor(vsqr_sum, vsqr_sum, vsqr_sum);
+                        }
+                    },
+                    [this](size_t base_reg, size_t i) {
+                        Vmm vsum = Vmm(3 * base_reg);
+                        Vmm vsqr_sum = Vmm(3 * base_reg + 1);
+                        Vmm vdata = Vmm(3 * base_reg + 2);
+                        size_t offt = i * vlen_spat_data_;
+                        uni_vmovups_spat_data(
+                                vdata, vmmword[reg_src + reg_soff + offt]);
+                        uni_vsubps(vdata, vdata, vmean);
+                        uni_vaddps(vsum, vsum, vdata);
+                        uni_vfmadd231ps(vsqr_sum, vdata, vdata);
+                    },
+                    [this](size_t base_reg) {
+                        if (base_reg) {
+                            uni_vaddps(Vmm(0), Vmm(0), Vmm(3 * base_reg));
+                            uni_vaddps(Vmm(1), Vmm(1), Vmm(3 * base_reg + 1));
+                        }
+                    });
+            uni_vmovups(vmmword[reg_rbuf1 + reg_coff], Vmm(0));
+            uni_vmovups(rbuf_sqr_ptr(reg_coff), Vmm(1));
+
+            add(reg_coff, vlen);
+            cmp(reg_coff, reg_coff_max);
+            jl(ch_label);
+        }
+    }
+
+    void mean_var_nspc_one_pass(const int num_ch_blks, int num_spat_pts) {
+        // Sums, sums of squares and shifts occupy 3 * num_ch_blks registers.
+        const auto vsum = [](int idx) { return Vmm(idx); };
+        const auto vsqr_sum
+                = [num_ch_blks](int idx) { return Vmm(idx + num_ch_blks); };
+        const auto vshift = [num_ch_blks](int idx) {
+            return Vmm(idx + 2 * num_ch_blks);
+        };
+
+        for (int idx = 0; idx < num_ch_blks; ++idx) {
+            const int coff = idx * vlen;
+            uni_vmovups(vsum(idx), vmmword[reg_rbuf1 + reg_coff + coff]);
+            uni_vmovups(vsqr_sum(idx), rbuf_sqr_ptr(reg_coff, coff));
+            uni_vmovups_maybe_tail(vshift(idx), mean_ptr(coff));
+        }
+
+        xor_(reg_soff_nspc, reg_soff_nspc);
+
+        if (jbp_->is_spatial_thr_) {
+            mov(reg_ctr, ptr[rsp + stack_off_spat_size_loc]);
+            add(reg_soff_nspc, ptr[rsp + stack_off_s_s]);
+            num_spat_pts = 1;
+        } else {
+            mov(reg_ctr, spat_size);
+            num_spat_pts = nstl::min((size_t)num_spat_pts, spat_size);
+            if (spat_size % num_spat_pts != 0) num_spat_pts = 1;
+        }
+
+        Label spatial;
+        L(spatial);
+        {
+            for (int spat_pt = 0; spat_pt < num_spat_pts; ++spat_pt) {
+                for (int idx = 0; idx < num_ch_blks; ++idx) {
+                    const int offt = idx * vlen_spat_data_;
+                    const Vmm vdata = vtmp;
+                    uni_vmovups_spat_data(
+                            vdata, vmmword[reg_src + reg_soff_nspc + offt]);
+                    uni_vsubps(vdata, vdata, vshift(idx));
+                    uni_vaddps(vsum(idx), vsum(idx), vdata);
+                    uni_vfmadd231ps(vsqr_sum(idx), vdata, vdata);
+                }
+                add(reg_soff_nspc, spat_step);
+            }
+            sub(reg_ctr, num_spat_pts);
+            jnz(spatial, T_NEAR);
+        }
+
+        for (int idx = 0; idx < num_ch_blks; ++idx) {
+            const int coff = idx * vlen;
+            uni_vmovups(vmmword[reg_rbuf1 + reg_coff + coff], vsum(idx));
+            uni_vmovups(rbuf_sqr_ptr(reg_coff, coff), vsqr_sum(idx));
+        }
+    }
+
+    // Mean and variance in a single pass over the data. With `K` being the
+    // value at the first point of a channel, and S and Q the sums of `x - K`
+    // and `(x - K)^2` over all N * SP points:
+    //   mean = K + S / (N * SP),  var = Q / (N * SP) - (S / (N * SP))^2.
+    // Shifting by a sample of the channel keeps the subtraction from
+    // cancelling catastrophically for data with a large offset.
+    void compute_mean_variance_one_pass() {
+        assert(isa != sse41);
+        uni_vpxor(Vmm(0), Vmm(0), Vmm(0));
+        xor_(reg_coff, reg_coff);
+        Label zero_rbuf;
+        L(zero_rbuf);
+        {
+            uni_vmovups(vmmword[reg_rbuf1 + reg_coff], Vmm(0));
+            uni_vmovups(rbuf_sqr_ptr(reg_coff), Vmm(0));
+            add(reg_coff, vlen);
+            cmp(reg_coff, reg_coff_max);
+            jne(zero_rbuf);
+        }
+
+        mov(reg_src, ptr[rsp + stack_off_src]);
+
+        xor_(reg_soff, reg_soff);
+        Label stat_spatial;
+        L(stat_spatial);
+        {
+            xor_(reg_coff, reg_coff);
+
+            jbp_->is_nspc_ ? compute_mean_variance_nspc()
+                           : mean_var_channels_one_pass();
+
+            // Process next image
+            if (jbp_->is_nspc_) {
+                // Can use static offset since we comeback after spatial loop
+                add(reg_src, mb_offt);
+                add(reg_soff, mb_offt);
+            } else {
+                add(reg_soff, reg_mb_stride_Bc);
+            }
+
+            cmp(reg_soff, reg_soff_max);
+            jl(stat_spatial);
+        }
+
+        if (jbp_->is_nspc_) mov(reg_src, ptr[rsp + stack_off_src]); // comeback
+
+        Label no_reduction;
+        barrier();
+        {
+            mov(reg_tmp, ptr[rsp + stack_off_N_ithr]);
+            cmp(reg_tmp, 0);
+            jne(no_reduction);
+            mov(reg_nnthr, ptr[rsp + stack_off_N_nthr]);
+            xor_(reg_coff, reg_coff);
+            Label reduction_channels;
+            L(reduction_channels);
+            {
+                mov(reg_roff, reg_coff);
+                uni_vpxor(Vmm(1), Vmm(1), Vmm(1));
+                uni_vpxor(Vmm(2), Vmm(2), Vmm(2));
+                mov(reg_ctr, reg_nnthr);
+                Label reduction_thrs;
+                L(reduction_thrs);
+                {
+                    uni_vaddps(Vmm(1), Vmm(1), vmmword[reg_rbuf1 + reg_roff]);
+                    uni_vaddps(Vmm(2), Vmm(2), rbuf_sqr_ptr(reg_roff));
+                    add(reg_roff, reg_coff_max);
+                    sub(reg_ctr, 1);
+                    jnz(reduction_thrs);
+                }
+                uni_vdivps(Vmm(1), Vmm(1), vchan_size);
+                uni_vdivps(Vmm(2), Vmm(2), vchan_size);
+                uni_vmulps(vtmp, Vmm(1), Vmm(1));
+                uni_vsubps(Vmm(2), Vmm(2), vtmp);
+                // Rounding may push the variance of constant data below zero.
+                uni_vpxor(vtmp, vtmp, vtmp);
+                uni_vmaxps(Vmm(2), Vmm(2), vtmp);
+                uni_vmovups_maybe_tail(vmean, mean_ptr());
+                uni_vaddps(Vmm(1), Vmm(1), vmean);
+                uni_vmovups_maybe_tail(mean_ptr(), Vmm(1));
+                uni_vmovups_maybe_tail(var_ptr(), Vmm(2));
+
+                add(reg_coff, vlen);
+                cmp(reg_coff, reg_coff_max);
+                jl(reduction_channels);
+            }
+        }
+        L(no_reduction);
+        barrier();
+    }
+
     void compute_mean_variance() {
         uni_vpxor(Vmm(0), Vmm(0), Vmm(0));
         xor_(reg_coff, reg_coff);
@@ -2112,7 +2325,12 @@ struct jit_bnorm_t : public jit_generator_t {
         load_common_params();
 
         if (pd_->is_fwd()) {
-            if (!pd_->stats_is_src()) { compute_mean_variance(); }
+            if (!pd_->stats_is_src()) {
+                if (jbp_->stats_one_pass_)
+                    compute_mean_variance_one_pass();
+                else
+                    compute_mean_variance();
+            }
             forward();
         } else {
             backward();
@@ -2131,7 +2349,9 @@ namespace bnorm_impl {
 template <cpu_isa_t isa>
 struct driver_t : public c_compatible {
     driver_t(const batch_normalization_pd_t *pd, int nthr)
-        : pd_(pd), jbp_(pd_, nthr, simd_w), ker_(pd_, &jbp_) {}
+        : pd_(pd)
+        , jbp_(pd_, nthr, simd_w, use_stats_one_pass(pd, nthr))
+        , ker_(pd_, &jbp_) {}
 
     ~driver_t() = default;
 
@@ -2142,7 +2362,8 @@ struct driver_t : public c_compatible {
         auto sbuf_sz = use_tmp_stats(pd) * 2 * C_PADDED;
         auto pbuf_sz
                 = (use_tmp_diff_scale(pd) + use_tmp_diff_shift(pd)) * C_PADDED;
-        auto rbuf_sz = (pd->is_fwd() ? 1 : 2) * C_PADDED * nthr;
+        auto rbuf_sz = (pd->is_fwd() && !use_stats_one_pass(pd, nthr) ? 1 : 2)
+                * C_PADDED * nthr;
 
         scratchpad.book<acc_data_t>(key_bnorm_tmp_stats, sbuf_sz);
         scratchpad.book<acc_data_t>(key_bnorm_tmp_diff_ss, pbuf_sz);
@@ -2308,8 +2529,57 @@ struct driver_t : public c_compatible {
         }
     }
 
+    // Stores the shift of the single pass statistics, the value at the first
+    // point of each channel, in place of the mean. Padded channels get zero.
+    void init_stats_shift(const void *src, acc_data_t *mean,
+            const memory_tracking::grantor_t &scratchpad) const {
+        if (!jbp_.stats_one_pass_) return;
+
+        auto shift = use_tmp_stats(pd_)
+                ? scratchpad.get<acc_data_t>(key_bnorm_tmp_stats)
+                : mean;
+        const memory_desc_wrapper src_d(pd_->src_md());
+        const dim_t C = pd_->C();
+        const dim_t C_shift = use_tmp_stats(pd_) ? get_c_padded(pd_) : C;
+        for (dim_t c = 0; c < C_shift; c++) {
+            if (c >= C) {
+                shift[c] = 0.f;
+                continue;
+            }
+            dims_t pos = {0};
+            pos[1] = c;
+            const dim_t off = src_d.off_v(pos);
+            shift[c] = io::load_float_value(src_d.data_type(), src, off);
+        }
+    }
+
     status_t create_kernel() { return ker_.create_kernel(); }
 
+    static bool use_stats_one_pass(
+            const batch_normalization_pd_t *pd, int nthr) {
+        // The accumulation of squares is not unrolled for SSE4.1 and the
+        // ne_convert xf16 path loads even and odd elements separately.
+        const bool is_avx2_ne_xf16 = isa == avx2 && mayiuse(avx2_vnni_2)
+                && utils::one_of(pd->src_md()->data_type, data_type::bf16,
+                        data_type::f16);
+        if (isa == sse41 || is_avx2_ne_xf16 || !pd->is_fwd()
+                || pd->stats_is_src())
+            return false;
+
+        // Data that does not fit L2 is read from memory twice by separate
+        // mean and variance passes.
+        //
+        // An internal env var is provided for oneDNN debug and testing only:
+        // 0 disables the single pass, 1 forces it regardless of the size.
+        const int mode = getenv_int("_ONEDNN_BNORM_STATS_ONE_PASS", -1);
+        if (mode >= 0) return mode > 0;
+
+        const size_t data_size
+                = types::data_type_size(pd->src_md()->data_type) * pd->MB()
+                * get_c_padded(pd) * pd->D() * pd->H() * pd->W();
+        return data_size > platform::get_per_core_cache_size(2) * nthr;
+    }
+
 private:
     enum {
         simd_w = isa == sse41 ? 8
@@ -2468,6 +2738,8 @@ status_t jit_uni_batch_normalization_fwd_t<isa>::execute(
     auto scratchpad = ctx.get_scratchpad_grantor();
 
     bnorm_driver_->init_barriers(scratchpad);
+    if (!pd()->stats_is_src())
+        bnorm_driver_->init_stats_shift(src, mean, scratchpad);
     const int nthr = pd()->nthr_;
 
     parallel(nthr, [&](const int ithr, const int nthr) {
@@ -17,6 +17,7 @@
 #include "common/dnnl_thread.hpp"
 
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/platform.hpp"
 
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/jit_generator.hpp"
@@ -391,10 +392,12 @@ struct kernel_stat_t
     DECLARE_CPU_JIT_AUX_FUNCTIONS(
             jit_uni_group_normalization_fwd_t::kernel_stat_t);
 
-    kernel_stat_t(const group_normalization_pd_t *pd, bool compute_var = false)
+    kernel_stat_t(const group_normalization_pd_t *pd, bool compute_var = false,
+            bool channel_stats = false)
         : jit_generator_t(jit_name())
         , src_d_(pd->src_md())
         , compute_var_(compute_var)
+        , channel_stats_(channel_stats)
         , C_(pd->C())
         , C_PER_G_(C_ / pd->G())
         , SP_(pd->D() * pd->H() * pd->W())
@@ -424,13 +427,13 @@ struct kernel_stat_t
                 this, io_isa, {f32}, io_conf, io_tail_conf_stats);
 
         VDEBUGINFO(1, primitive, group_normalization,
-                "%s:\n    compute_var_=%d\n    C_=%" PRId64
-                "\n    C_PER_G_=%" PRId64
+                "%s:\n    compute_var_=%d\n    channel_stats_=%d"
+                "\n    C_=%" PRId64 "\n    C_PER_G_=%" PRId64
                 "\n    simd_w_=%zu\n    axis_simd_tail_=%" PRId64
                 "\n    unroll_c_=%" PRId64 "\n    c_block_=%" PRId64
                 "\n    nc_blocks_=%" PRId64 "\n    c_block_tail_=%" PRId64
                 "\n    unroll_c_tail_=%" PRId64,
-                jit_name(), compute_var_, C_, C_PER_G_, simd_w_,
+                jit_name(), compute_var_, channel_stats_, C_, C_PER_G_, simd_w_,
                 axis_simd_tail_, unroll_c_, c_block_, nc_blocks_, c_block_tail_,
                 unroll_c_tail_);
     }
@@ -447,10 +450,20 @@ struct kernel_stat_t
 
 #define PARAM_OFF(x) offsetof(ker_args_t, x)
         mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
-        if (compute_var_) mov(reg_var, ptr[reg_param + PARAM_OFF(var)]);
+        if (compute_var_ || channel_stats_)
+            mov(reg_var, ptr[reg_param + PARAM_OFF(var)]);
         mov(reg_src_start, ptr[reg_param + PARAM_OFF(src)]);
+        if (channel_stats_)
+            uni_vbroadcastss(
+                    vmm_rcp_block, ptr[reg_param + PARAM_OFF(rcp_block_size)]);
 #undef PARAM_OFF
 
+        if (channel_stats_) {
+            generate_channel_stats();
+            postamble();
+            return;
+        }
+
         // Initializing registers for unrolling and further reduction of those
         // is called with the maximum unroll value of a `compute_stat_block`
         // function as they operate over vmms, which numeration depends on
@@ -571,6 +584,19 @@ struct kernel_stat_t
         jit_generator_t::operator()(&args);
     }
 
+    void operator()(const void *src, float *ch_mean, float *ch_m2,
+            float rcp_block_size, size_t block_size) const override {
+        ker_args_t args;
+        args.src = src;
+        args.mean = ch_mean;
+        args.var = ch_m2;
+        args.block_size
+                = block_size * C_ * types::data_type_size(src_d_.data_type());
+        args.rcp_block_size = rcp_block_size;
+
+        jit_generator_t::operator()(&args);
+    }
+
 protected:
     using Vmm = typename cpu_isa_traits_t<isa>::Vmm;
     const Xbyak::AddressFrame &vmmword = (isa == sse41) ? xword
@@ -583,10 +609,12 @@ protected:
         const float *mean;
         const float *var;
         size_t block_size;
+        float rcp_block_size;
     };
 
     const memory_desc_wrapper src_d_;
     const bool compute_var_;
+    const bool channel_stats_;
     const dim_t C_;
     const dim_t C_PER_G_;
     const dim_t SP_;
@@ -708,6 +736,97 @@ protected:
         }
         L(sp_blk_loop_end);
     }
+    // Accumulates `S = sum(x - K)` and `Q = sum((x - K)^2)` for every channel
+    // of a block over spatial points, where the shift `K` is the value at the
+    // first spatial point of the channel. Then stores
+    //   mean = K + S / n  and  M2 = Q - S^2 / n.
+    // The shift keeps the sums small for data with a large offset, so no
+    // second pass over the data is required for an accurate variance.
+    void compute_channel_stat_block(size_t unroll, bool tail = false) {
+        const size_t c_src_size
+                = C_ * types::data_type_size(src_d_.data_type());
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+        mov(reg_sp_block_end, ptr[reg_param + PARAM_OFF(block_size)]);
+#undef PARAM_OFF
+
+        for (size_t ur = 0; ur < unroll; ur++) {
+            uni_vpxor(Vmm_mean(ur), Vmm_mean(ur), Vmm_mean(ur));
+            uni_vpxor(Vmm_var(ur), Vmm_var(ur), Vmm_var(ur));
+        }
+
+        mov(reg_src, reg_src_start);
+        // add block_start to block_size to define block_end
+        add(reg_sp_block_end, reg_src);
+
+        Xbyak::Label sp_blk_loop, sp_blk_loop_end;
+        L(sp_blk_loop);
+        {
+            cmp(reg_sp_block_end, reg_src);
+            jle(sp_blk_loop_end, T_NEAR);
+
+            for (size_t ur = 0; ur < unroll; ur++) {
+                io_[src_d_.data_type()]->load(
+                        src_ptr(ur * simd_w_), Vmm_src(ur), tail);
+            }
+            for (size_t ur = 0; ur < unroll; ur++) {
+                // Masked loads zero both the data and the shift, so unused
+                // lanes do not contribute to the sums.
+                io_[src_d_.data_type()]->load(
+                        src_start_ptr(ur * simd_w_), vmm_tmp, tail);
+                uni_vsubps(Vmm_src(ur), Vmm_src(ur), vmm_tmp);
+                uni_vaddps(Vmm_mean(ur), Vmm_mean(ur), Vmm_src(ur));
+                uni_vfmadd231ps(Vmm_var(ur), Vmm_src(ur), Vmm_src(ur));
+            }
+
+            add(reg_src, c_src_size);
+            jmp(sp_blk_loop);
+        }
+        L(sp_blk_loop_end);
+
+        for (size_t ur = 0; ur < unroll; ur++) {
+            uni_vmulps(vmm_tmp, Vmm_mean(ur), vmm_rcp_block);
+            uni_vfnmadd231ps(Vmm_var(ur), Vmm_mean(ur), vmm_tmp);
+            io_[src_d_.data_type()]->load(
+                    src_start_ptr(ur * simd_w_), Vmm_src(ur), tail);
+            uni_vaddps(Vmm_src(ur), Vmm_src(ur), vmm_tmp);
+            io_[f32]->store(Vmm_src(ur), mean_ptr(ur * simd_w_), tail);
+            io_[f32]->store(Vmm_var(ur), var_ptr(ur * simd_w_), tail);
+        }
+    }
+
+    void generate_channel_stats() {
+        const size_t src_dt_size = types::data_type_size(src_d_.data_type());
+        const auto advance = [&](dim_t c) {
+            add(reg_src_start, c * src_dt_size);
+            add(reg_mean, c * sizeof(float));
+            add(reg_var, c * sizeof(float));
+        };
+
+        if (nc_blocks_) {
+            xor_(reg_nc_block, reg_nc_block);
+            Xbyak::Label c_blk_loop, c_blk_loop_end;
+            L(c_blk_loop);
+            {
+                cmp(reg_nc_block, nc_blocks_);
+                je(c_blk_loop_end, T_NEAR);
+
+                compute_channel_stat_block(unroll_c_);
+                advance(c_block_);
+                add(reg_nc_block, 1);
+
+                jmp(c_blk_loop);
+            }
+            L(c_blk_loop_end);
+        }
+
+        if (unroll_c_tail_) {
+            compute_channel_stat_block(unroll_c_tail_);
+            advance(c_block_tail_);
+        }
+
+        if (axis_simd_tail_) compute_channel_stat_block(1, true);
+    }
+
     void compute_stat_block(size_t unroll, bool tail = false) {
         if (compute_var_)
             compute_var_block(unroll, tail);
@@ -723,6 +842,10 @@ protected:
         return vmmword[reg_src + offt * src_d_.data_type_size()];
     }
 
+    Xbyak::Address src_start_ptr(size_t offt = 0) {
+        return vmmword[reg_src_start + offt * src_d_.data_type_size()];
+    }
+
     Xbyak::Address mean_ptr(size_t offt = 0) {
         return vmmword[reg_mean + offt * sizeof(float)];
     }
@@ -745,6 +868,8 @@ protected:
     const Xmm xmm_tmp = Xmm(13);
     const Vmm vmm_var = Vmm(14);
     const Vmm vmm_mean = Vmm(15);
+    // Reuses `vmm_var` which is not needed when computing channel stats.
+    const Vmm vmm_rcp_block = Vmm(14);
 
     const int bf16_emu_zmm_1_idx = 28;
     const int bf16_emu_zmm_2_idx = 29;
@@ -758,6 +883,28 @@ protected:
 template struct kernel_stat_t<avx2>;
 template struct kernel_stat_t<avx512_core>;
 
+// Statistics of a set of points: their number, mean and sum of squared
+// deviations from the mean (M2). Partial results are combined with the
+// pairwise update by Chan et al., which does not suffer from cancellation
+// the way merging sums of squares does.
+struct stat_acc_t {
+    void merge(dim_t n_other, double mean_other, double m2_other) {
+        if (n_other == 0) return;
+        const dim_t n_total = n + n_other;
+        const double delta = mean_other - mean;
+        const double w_other = static_cast<double>(n_other) / n_total;
+        mean += delta * w_other;
+        m2 += nstl::max(m2_other, 0.) + delta * delta * n * w_other;
+        n = n_total;
+    }
+
+    float var() const { return n ? static_cast<float>(m2 / n) : 0.f; }
+
+    dim_t n = 0;
+    double mean = 0.;
+    double m2 = 0.;
+};
+
 } // namespace
 
 jit_uni_group_normalization_fwd_t::kernel_base_t *
@@ -775,11 +922,12 @@ jit_uni_group_normalization_fwd_t::kernel_base_t::create(
 
 jit_uni_group_normalization_fwd_t::kernel_stat_base_t *
 jit_uni_group_normalization_fwd_t::kernel_stat_base_t::create(
-        const group_normalization_pd_t *apd, bool compute_var) {
+        const group_normalization_pd_t *apd, bool compute_var,
+        bool channel_stats) {
     if (mayiuse(avx512_core)) {
-        return new kernel_stat_t<avx512_core>(apd, compute_var);
+        return new kernel_stat_t<avx512_core>(apd, compute_var, channel_stats);
     } else if (mayiuse(avx2)) {
-        return new kernel_stat_t<avx2>(apd, compute_var);
+        return new kernel_stat_t<avx2>(apd, compute_var, channel_stats);
     } else {
         assert(!"kernel is empty.");
         return nullptr;
@@ -846,6 +994,14 @@ status_t jit_uni_group_normalization_fwd_t::pd_t::init(engine_t *engine) {
     VDISPATCH_GNORM(post_ops_ok(), VERBOSE_UNSUPPORTED_POSTOP);
 
     nthr_ = dnnl_get_max_threads();
+
+    // A group that does not fit L1 is read from memory twice when mean and
+    // variance are computed one after another.
+    const size_t group_size
+            = C_PER_G * D() * H() * W() * src_d.data_type_size();
+    stats_one_pass_ = !stats_is_src()
+            && group_size > platform::get_per_core_cache_size(1);
+
     auto scratchpad = scratchpad_registry().registrar();
     if (!stats_is_src()) {
         using namespace memory_tracking::names;
@@ -855,6 +1011,9 @@ status_t jit_uni_group_normalization_fwd_t::pd_t::init(engine_t *engine) {
         const size_t stats_reduction_buf_sz = stats_size * nthr_;
         scratchpad.template book<float>(
                 key_gnorm_reduction, stats_reduction_buf_sz);
+        if (stats_one_pass_)
+            scratchpad.template book<float>(
+                    key_gnorm_channel_stats, 2 * C_PER_G * nthr_);
         if (!is_training()) {
             scratchpad.template book<float>(key_gnorm_tmp_mean, stats_size);
             scratchpad.template book<float>(key_gnorm_tmp_var, stats_size);
@@ -878,6 +1037,8 @@ status_t jit_uni_group_normalization_fwd_t::execute_forward(
     auto stat_reduction = scratchpad.template get<float>(key_gnorm_reduction);
     auto tmp_mean = scratchpad.template get<float>(key_gnorm_tmp_mean);
     auto tmp_var = scratchpad.template get<float>(key_gnorm_tmp_var);
+    auto channel_stats
+            = scratchpad.template get<float>(key_gnorm_channel_stats);
 
     float *mean {nullptr}, *variance {nullptr};
     mean = pd()->stats_is_src()
@@ -910,8 +1071,22 @@ status_t jit_uni_group_normalization_fwd_t::execute_forward(
     const dim_t SP = D * H * W;
 
     const bool calculate_stats = !pd()->stats_is_src();
+    const bool stats_one_pass = pd()->stats_one_pass_;
     const int nthr = pd()->nthr_;
 
+    // Single pass statistics of `sp_block` spatial points of a group.
+    const auto compute_group_stats
+            = [&](int ithr, const char *src_ptr, dim_t sp_block) {
+                  float *ch_mean = channel_stats + 2 * C_PER_G * ithr;
+                  float *ch_m2 = ch_mean + C_PER_G;
+                  (*kernel_channel_stats_)(
+                          src_ptr, ch_mean, ch_m2, 1.f / sp_block, sp_block);
+                  stat_acc_t acc;
+                  for (dim_t c = 0; c < C_PER_G; c++)
+                      acc.merge(sp_block, ch_mean[c], ch_m2[c]);
+                  return acc;
+              };
+
     // There are two algorithms to distribute the problem among threads:
     // * Single-threaded-group - it gives each thread a whole group and runs
     //   it through all kernels. In this case there are no dependencies and
@@ -947,7 +1122,11 @@ status_t jit_uni_group_normalization_fwd_t::execute_forward(
                 float *mean_ptr = mean + i;
                 float *var_ptr = variance + i;
 
-                if (calculate_stats) {
+                if (calculate_stats && stats_one_pass) {
+                    const auto acc = compute_group_stats(ithr, src_ptr, SP);
+                    *mean_ptr = static_cast<float>(acc.mean);
+                    *var_ptr = acc.var();
+                } else if (calculate_stats) {
                     (*kernel_mean_)(src_ptr, mean_ptr, SP);
                     (*kernel_var_)(src_ptr, mean_ptr, var_ptr, SP);
                 }
@@ -974,7 +1153,61 @@ status_t jit_uni_group_normalization_fwd_t::execute_forward(
                 stat[g] /= C_PER_G * SP;
         };
 
-        if (calculate_stats) {
+        const auto sp_block_size = [&](dim_t ithr_in_g) {
+            const dim_t SP_chunk = SP / nthr_per_g;
+            return ithr_in_g == nthr_per_g - 1 ? SP - ithr_in_g * SP_chunk
+                                               : SP_chunk;
+        };
+
+        if (calculate_stats && stats_one_pass) {
+            // Partial statistics of every chunk are written as (mean, M2)
+            // pairs and merged per group afterwards.
+            const dim_t n_chunks = G * N * nthr_per_g;
+            float *chunk_mean = stat_reduction;
+            float *chunk_m2 = stat_reduction + n_chunks;
+
+            parallel(nthr, [&](const int ithr, const int nthr) {
+                dim_t chunk_start = 0, chunk_end = 0;
+                balance211(n_chunks, nthr, ithr, chunk_start, chunk_end);
+                if (chunk_start == chunk_end) return;
+
+                dim_t g_per_n = G * nthr_per_g;
+                dim_t SP_chunk = SP / nthr_per_g;
+
+                for (dim_t i = chunk_start; i < chunk_end; i++) {
+                    dim_t ithr_stride_n = (i / g_per_n) * C_padded * SP;
+                    dim_t ithr_stride_g = (i % G) * C_PER_G;
+                    dim_t ithr_stride_sp
+                            = ((i % g_per_n) / G) * C_padded * SP_chunk;
+                    const size_t data_off = (size_t)ithr_stride_n
+                            + ithr_stride_g + ithr_stride_sp;
+                    const char *__restrict src_ptr
+                            = static_cast<const char *>(src)
+                            + data_off * src_d.data_type_size();
+
+                    const dim_t kernel_sp_block_size
+                            = sp_block_size((i % g_per_n) / G);
+                    stat_acc_t acc;
+                    if (kernel_sp_block_size > 0)
+                        acc = compute_group_stats(
+                                ithr, src_ptr, kernel_sp_block_size);
+                    chunk_mean[i] = static_cast<float>(acc.mean);
+                    chunk_m2[i] = static_cast<float>(acc.m2);
+                }
+            });
+
+            for_(dim_t n = 0; n < N; n++)
+            for (dim_t g = 0; g < G; g++) {
+                stat_acc_t acc;
+                for (dim_t ithr = 0; ithr < nthr_per_g; ithr++) {
+                    const dim_t i = n * nthr_per_g * G + ithr * G + g;
+                    acc.merge(C_PER_G * sp_block_size(ithr), chunk_mean[i],
+                            chunk_m2[i]);
+                }
+                mean[n * G + g] = static_cast<float>(acc.mean);
+                variance[n * G + g] = acc.var();
+            }
+        } else if (calculate_stats) {
             parallel(nthr, [&](const int ithr, const int nthr) {
                 dim_t chunk_start = 0, chunk_end = 0;
                 balance211(
@@ -40,6 +40,8 @@ struct jit_uni_group_normalization_fwd_t : public primitive_t {
         status_t init(engine_t *engine);
 
         int nthr_; // To not exceed the limit in execute used for set up.
+        // Mean and variance are computed in a single pass over the data.
+        bool stats_one_pass_ = false;
     };
 
     status_t init(engine_t *engine) override {
@@ -47,9 +49,14 @@ struct jit_uni_group_normalization_fwd_t : public primitive_t {
         CHECK(safe_ptr_assign(kernel_mean_, kernel_stat_base_t::create(pd())));
         CHECK(safe_ptr_assign(
                 kernel_var_, kernel_stat_base_t::create(pd(), true)));
+        if (pd()->stats_one_pass_)
+            CHECK(safe_ptr_assign(kernel_channel_stats_,
+                    kernel_stat_base_t::create(pd(), false, true)));
         if (kernel_) CHECK(kernel_->create_kernel());
         if (kernel_mean_) CHECK(kernel_mean_->create_kernel());
         if (kernel_var_) CHECK(kernel_var_->create_kernel());
+        if (kernel_channel_stats_)
+            CHECK(kernel_channel_stats_->create_kernel());
         return status::success;
     }
 
@@ -80,8 +87,12 @@ struct jit_uni_group_normalization_fwd_t : public primitive_t {
                 const void *src, float *mean, size_t block_size) const = 0;
         virtual void operator()(const void *src, const float *mean, float *var,
                 size_t block_size) const = 0;
-        static kernel_stat_base_t *create(
-                const group_normalization_pd_t *pd, bool compute_var = false);
+        // Per-channel mean and sum of squared deviations from it (M2) over
+        // `block_size` spatial points. Used by the single pass statistics.
+        virtual void operator()(const void *src, float *ch_mean, float *ch_m2,
+                float rcp_block_size, size_t block_size) const = 0;
+        static kernel_stat_base_t *create(const group_normalization_pd_t *pd,
+                bool compute_var = false, bool channel_stats = false);
         virtual status_t create_kernel() = 0;
         virtual ~kernel_stat_base_t() = default;
     };
@@ -93,6 +104,7 @@ protected:
     std::unique_ptr<kernel_base_t> kernel_;
     std::unique_ptr<kernel_stat_base_t> kernel_mean_;
     std::unique_ptr<kernel_stat_base_t> kernel_var_;
+    std::unique_ptr<kernel_stat_base_t> kernel_channel_stats_;
 };
 
 } // namespace x64
@@ -23,6 +23,7 @@
 #include "common/type_helpers.hpp"
 
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/platform.hpp"
 
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
@@ -134,6 +135,14 @@ struct jit_stat_and_data_base_kernel_t : stat_and_data_kernel_t,
         with_src_scales_ = !attr_scales.has_default_values(DNNL_ARG_SRC);
         with_dst_scales_ = !attr_scales.has_default_values(DNNL_ARG_DST);
 
+        // Rows that do not fit L1 are read from memory twice by the two-pass
+        // statistics. Compute mean and variance in a single pass over the
+        // row instead.
+        one_pass_stats_ = calculate_stats_ && !skip_mean_
+                && !has_ne_convert_src_xf16_ && axis_simd_full_ > 0
+                && static_cast<size_t>(C_) * src_d_.data_type_size()
+                        > platform::get_per_core_cache_size(1);
+
         io::io_conf_t io_conf;
         io::io_tail_conf_t io_tail_conf(simd_w_, axis_simd_tail_,
                 tail_opmask_idx, vmm_tail_mask.getIdx(), reg_tmp);
@@ -191,6 +200,7 @@ protected:
     bool with_eltwise_ = false;
     bool with_src_scales_ = false;
     bool with_dst_scales_ = false;
+    bool one_pass_stats_ = false;
 
     std::unique_ptr<injector::jit_uni_postops_injector_t<isa>>
             postops_injector_;
@@ -431,6 +441,72 @@ protected:
             uni_vmovss(ptr[reg_var], Xmm(vmm_inv_sqrtvar.getIdx()));
     }
 
+    // Single pass statistics over shifted data. Sums of `x - K` and
+    // `(x - K)^2` are accumulated with `K` being the first element of the row:
+    //   mean = K + S / C,  var = Q / C - (S / C)^2.
+    // The shift is a sample of the row, so it is within a few standard
+    // deviations of the mean and the final subtraction does not cancel
+    // catastrophically even for data with a large offset, unlike plain
+    // sum/sum-of-squares.
+    void compute_mean_var_one_pass() {
+        const int base_idx = 1; // Preserve `0` for tail on AVX2.
+        const int unroll
+                = axis_simd_full_ >= unroll_factor_ ? unroll_factor_ : 1;
+        assert(math::is_pow2(unroll));
+        const auto vmm_sum = [&](int j) { return Vmm(base_idx + j); };
+        const auto vmm_sqr_sum
+                = [&](int j) { return Vmm(base_idx + unroll_factor_ + j); };
+        const Vmm vmm_shift_k = vmm_mean;
+        const Vmm vmm_src = vmm_dst;
+
+        io_[src_d_.data_type()]->load(src_ptr(), vmm_shift_k, false);
+        uni_vbroadcastss(vmm_shift_k, Xmm(vmm_shift_k.getIdx()));
+
+        for (int j = 0; j < unroll; j++) {
+            uni_vpxor(vmm_sum(j), vmm_sum(j), vmm_sum(j));
+            uni_vpxor(vmm_sqr_sum(j), vmm_sqr_sum(j), vmm_sqr_sum(j));
+        }
+
+        const auto accumulate = [&](size_t offt_elems, int j, bool tail) {
+            io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_src, tail);
+            uni_vsubps_maybe_tail(vmm_src, vmm_shift_k, tail);
+            uni_vaddps(vmm_sum(j), vmm_sum(j), vmm_src);
+            uni_vfmadd231ps(vmm_sqr_sum(j), vmm_src, vmm_src);
+        };
+
+        for (int i = 0; i < axis_simd_full_; i++)
+            accumulate(i * simd_w_, i % unroll, false);
+        if (axis_simd_tail_ > 0)
+            accumulate(axis_simd_full_ * simd_w_, 0, true);
+
+        int n = unroll;
+        while (n > 1) {
+            for (int j = 0; j < n / 2; j++) {
+                uni_vaddps(vmm_sum(j), vmm_sum(j), vmm_sum(j + n / 2));
+                uni_vaddps(vmm_sqr_sum(j), vmm_sqr_sum(j),
+                        vmm_sqr_sum(j + n / 2));
+            }
+            n = n / 2;
+        }
+
+        reduce(vmm_sum(0), vmm_sum(1));
+        reduce(vmm_sqr_sum(0), vmm_sum(1));
+        uni_vdivps(vmm_sum(0), vmm_sum(0), vmm_c, vmm_tmp);
+        uni_vdivps(vmm_sqr_sum(0), vmm_sqr_sum(0), vmm_c, vmm_tmp);
+
+        // Rounding may push the variance of (nearly) constant rows below zero.
+        uni_vmulps(vmm_tmp, vmm_sum(0), vmm_sum(0));
+        uni_vsubps(vmm_inv_sqrtvar, vmm_sqr_sum(0), vmm_tmp);
+        uni_vpxor(vmm_tmp, vmm_tmp, vmm_tmp);
+        uni_vmaxps(vmm_inv_sqrtvar, vmm_inv_sqrtvar, vmm_tmp);
+        uni_vaddps(vmm_mean, vmm_shift_k, vmm_sum(0));
+
+        if (save_stats_) {
+            uni_vmovss(ptr[reg_mean], Xmm(vmm_mean.getIdx()));
+            uni_vmovss(ptr[reg_var], Xmm(vmm_inv_sqrtvar.getIdx()));
+        }
+    }
+
     void calculate_ne_convert_xf16_dst_body(
             size_t offt_elems, bool tail = false) {
         io_[src_d_.data_type()]->load_two_simdw_xf16(
@@ -610,8 +686,12 @@ protected:
 
             if (calculate_stats_) {
                 // compute stats
-                if (!skip_mean_) { compute_mean(); }
-                compute_var();
+                if (one_pass_stats_)
+                    compute_mean_var_one_pass();
+                else {
+                    if (!skip_mean_) { compute_mean(); }
+                    compute_var();
+                }
             } else {
                 // read mean and var from input
                 if (!skip_mean_) {
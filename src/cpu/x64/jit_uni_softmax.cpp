@@ -118,6 +118,16 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
     bool with_src_scales_ = false;
     bool with_dst_scales_ = false;
     bool use_ext_aux_vmms_ = false;
+    bool use_exp_lut_ = false;
+
+    // For int8 sources, `src - max` is an integer in [-255, 0], so its
+    // exponent is looked up as exp(-16 * hi) * exp(-lo) from two tables of
+    // 16 values, which fit a single zmm each.
+    // The tables are only used on avx512_core, with at most 16 vmms taken
+    // by an unrolled body.
+    Xbyak::Label exp_lut_label_;
+    Vmm vexp_lut_lo = Vmm(17);
+    Vmm vexp_lut_hi = Vmm(18);
 
     size_t unroll_regs_ = 4;
 
@@ -601,6 +611,10 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
                 Vmm vreg_tmp_max = get_aux_vmm(vreg_tmp_src, max_unroll);
                 uni_vpxor(vreg_tmp_max, vreg_tmp_max, vreg_tmp_max);
             }
+            if (use_exp_lut_) {
+                vmovups(vexp_lut_lo, ptr[rip + exp_lut_label_]);
+                vmovups(vexp_lut_hi, ptr[rip + exp_lut_label_ + vlen]);
+            }
         };
 
         // Each unroll encounter accumulates maximum values into its own vmm.
@@ -624,7 +638,11 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
             for (int i = 0; i < unroll; i++) {
                 Vmm vreg_tmp_src = Vmm(i + 1);
                 Vmm vreg_tmp_sum = get_aux_vmm(vreg_tmp_src, 1 * max_unroll);
-                if (use_ext_aux_vmms_) {
+                if (use_exp_lut_) {
+                    compute_exp_lut(vreg_tmp_src,
+                            get_aux_vmm(vreg_tmp_sum, 1 * max_unroll),
+                            get_aux_vmm(vreg_tmp_sum, 2 * max_unroll));
+                } else if (use_ext_aux_vmms_) {
                     // Prepare indices for exp aux vmms.
                     injector_utils::vmm_index_set_t exp_aux_indices;
                     const auto exp_vmm_aux_count
@@ -711,6 +729,31 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         }
     }
 
+    // Computes exp of `vsrc`, holding `src - max` of int8 values, using
+    // `vlo` and `vhi` as temporary registers.
+    void compute_exp_lut(const Vmm &vsrc, const Vmm &vlo, const Vmm &vhi) {
+        const Zmm zsrc(vsrc.getIdx()), zlo(vlo.getIdx()), zhi(vhi.getIdx());
+        // k = max - src, in [0, 255]
+        vcvtps2dq(zhi, zsrc);
+        vpxord(zlo, zlo, zlo);
+        vpsubd(zlo, zlo, zhi);
+        vpsrld(zhi, zlo, 4);
+        vpandd(zlo, zlo, ptr_b[rip + exp_lut_label_ + 2 * vlen]);
+        vpermps(zlo, zlo, Zmm(vexp_lut_lo.getIdx()));
+        vpermps(zhi, zhi, Zmm(vexp_lut_hi.getIdx()));
+        vmulps(zsrc, zlo, zhi);
+    }
+
+    void prepare_exp_lut() {
+        align(vlen);
+        L(exp_lut_label_);
+        for (int i = 0; i < (int)simd_w_; i++)
+            dd(float2int(expf(-static_cast<float>(i))));
+        for (int i = 0; i < (int)simd_w_; i++)
+            dd(float2int(expf(-static_cast<float>(i * simd_w_))));
+        dd(simd_w_ - 1);
+    }
+
     // Use ne_convert instruction to load xf16 even/odd elements from memory
     void compute_avx2_ne_xf16_dst() {
         const auto pre_body = [](int max_unroll) {};
@@ -932,7 +975,7 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
     // that are participated are not defined at the moment of base ctor
     // initialization.
     void generate() override {
-        if (pd_->is_fwd() || is_logsoftmax_)
+        if ((pd_->is_fwd() || is_logsoftmax_) && !use_exp_lut_)
             exp_injector_.reset(new jit_uni_eltwise_injector_t<isa>(this,
                     alg_kind::eltwise_exp, 0.0f, 0.0f, 1.0f, data_type::f32,
                     !use_ext_aux_vmms_, reg_exp_injector_table, injector_mask));
@@ -977,6 +1020,7 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         postamble();
         if (exp_injector_) exp_injector_->prepare_table();
         if (log_injector_) log_injector_->prepare_table();
+        if (use_exp_lut_) prepare_exp_lut();
         if (with_eltwise_ && postops_injector_)
             postops_injector_->prepare_table(/* generate = */ true);
     }
@@ -1000,6 +1044,9 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
                                   accumulation_mode::relaxed,
                                   accumulation_mode::any)))
         , use_ext_aux_vmms_(!is_logsoftmax_ && n_vregs > 16)
+        , use_exp_lut_(is_superset(isa, avx512_core) && pd_->is_fwd()
+                  && is_softmax_
+                  && utils::one_of(src_d_.data_type(), s8, u8))
         , axis_simd_full_(pd_->axis_size() / simd_w_)
         , axis_simd_tail_(pd_->axis_size() % simd_w_) {
 
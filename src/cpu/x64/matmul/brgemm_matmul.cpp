@@ -290,6 +290,13 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
 
     maybe_set_LDB2();
 
+    // When all rows of A are handled by a single block, each block of B is
+    // used once, and B is streamed from memory unless it fits in L2.
+    const bool B_streamed = bgmmc_.M <= bgmmc_.M_blk
+            && bgmmc_.K * bgmmc_.N * bgmmc_.b_dt_sz
+                    > static_cast<dim_t>(
+                            platform::get_per_core_cache_size(2));
+
     const int i_bs_end = bgmmc_.brgemm_batch_tail_size ? 2 : 1;
     const int i_init_start = bgmmc_.K_blk != bgmmc_.K ? 0 : 1;
     const int i_K_end = bgmmc_.K_tail ? 2 : 1;
@@ -333,6 +340,7 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
         brgattr.generate_skip_accumulation
                 = bgmmc_.post_ops_applicable && bgmmc_.nthr_k > 1;
         brgattr.mem_advice = bgmmc_.mem_advice;
+        brgattr.hint_B_streamed = B_streamed;
         if (is_superset(kernel_isa, avx512_core_amx)) {
             brgattr.use_uker = true;
             brgattr.use_interleave_stores = true;
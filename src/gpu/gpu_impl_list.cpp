@@ -34,6 +34,7 @@ const impl_list_item_t *gpu_impl_list_t::get_implementation_list(
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            case primitive_kind::gather: return empty_list;
             CASE(gemm);
             CASE(group_normalization);
             CASE(inner_product);
@@ -48,6 +49,7 @@ const impl_list_item_t *gpu_impl_list_t::get_implementation_list(
             CASE(sdpa);
             CASE(shuffle);
             CASE(softmax);
+            case primitive_kind::topk: return empty_list;
             CASE(zero_pad);
             default: assert(!"unknown primitive kind"); return empty_list;
         }
@@ -805,6 +805,76 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_gen_index, 1,
                         executable_creator<genindex_executable_t>)
                 .SET_ARG_INDICES_GETTER(genindex_executable_t))
 
+DNNL_GRAPH_OP_SCHEMA(dnnl_embedding_bag, 1,
+        op_schema_t()
+                .set_inputs_option(op_schema_t::param_num_option::variadic)
+                .set_num_inputs(std::set<size_t>({2, 32}))
+                .set_num_outputs(2)
+                .set_input(0, "table")
+                .set_input(1, "indices")
+                .set_input(2, "offsets")
+                .set_output(0, "output")
+                .set_output(1, "scratchpad")
+                // Attributes inherited from front EmbeddingBag ops
+                .set_attr(op_attr::mode, false, attribute_kind::s, "sum",
+                        {"sum", "mean", "max"})
+                // New added attributes
+                .set_attr(op_attr::fusion_info_key, false, attribute_kind::i,
+                        (int64_t)-1)
+                .set_attr(op_attr::alg_kind, true, attribute_kind::i)
+                .set_attr(op_attr::with_offsets, false, attribute_kind::b,
+                        false)
+                .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                // Analysis rules
+                .set_shape_inference_function(
+                        infer_dnnl_embedding_bag_output_shape)
+                .SET_LAYOUT_PROPAGATOR(layout_propagator_for_embedding_bag)
+                .SET_EXECUTABLE_CREATOR(
+                        executable_creator<embedding_bag_executable_t>)
+                .SET_ARG_INDICES_GETTER(embedding_bag_executable_t))
+
+DNNL_GRAPH_OP_SCHEMA(dnnl_topk, 1,
+        op_schema_t()
+                .set_num_inputs(1)
+                .set_num_outputs(3)
+                .set_input(0, "input")
+                .set_output(0, "output")
+                .set_output(1, "indices")
+                .set_output(2, "scratchpad")
+                // Attributes inherited from front TopK ops
+                .set_attr(op_attr::axis, false, attribute_kind::i, (int64_t)-1)
+                .set_attr(op_attr::k, true, attribute_kind::i)
+                .set_attr(op_attr::mode, false, attribute_kind::s, "max",
+                        {"max", "min"})
+                // New added attributes
+                .set_attr(op_attr::alg_kind, true, attribute_kind::i)
+                .set_attr(op_attr::with_softmax, false, attribute_kind::b,
+                        false)
+                .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                // Analysis rules
+                .set_shape_inference_function(infer_dnnl_topk_output_shape)
+                .SET_LAYOUT_PROPAGATOR(layout_propagator_for_topk)
+                .SET_EXECUTABLE_CREATOR(executable_creator<topk_executable_t>)
+                .SET_ARG_INDICES_GETTER(topk_executable_t))
+
+// A view of [slice_begin, slice_begin + slice_size) along the axis of the
+// input. Used to split the output of horizontally fused ops.
+DNNL_GRAPH_OP_SCHEMA(dnnl_slice, 1,
+        op_schema_t()
+                .set_num_inputs(1)
+                .set_num_outputs(1)
+                .set_input(0, "input")
+                .set_output(0, "output")
+                .set_attr(op_attr::axis, true, attribute_kind::i)
+                .set_attr(op_attr::slice_begin, true, attribute_kind::i)
+                .set_attr(op_attr::slice_size, true, attribute_kind::i)
+                .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                // Analysis rules
+                .set_shape_inference_function(infer_slice_output_shape)
+                .SET_LAYOUT_PROPAGATOR(layout_propagator_for_slice)
+                .SET_EXECUTABLE_CREATOR(executable_creator<slice_view_t>)
+                .SET_ARG_INDICES_GETTER(slice_view_t))
+
 DNNL_GRAPH_OP_SCHEMA(dnnl_shuffle, 1,
         op_schema_t()
                 .set_num_inputs(1)
@@ -930,6 +1000,10 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_concat, 1,
                 .set_attr(op_attr::axis, true, attribute_kind::i)
                 // New added attributes
                 .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                // Set by memory planning when all the inputs are written in
+                // place into the output buffer
+                .set_attr(op_attr::is_zero_copy, false, attribute_kind::b,
+                        false)
                 // Analysis rules
                 .set_shape_inference_function(infer_concat_output_shape)
                 .SET_LAYOUT_PROPAGATOR(layout_propagator_for_concat)
@@ -41,8 +41,83 @@ status_t get_ordered_inputs_outputs(
     if (ordered.size() != expected.size()) return status::invalid_arguments;
     return status::success;
 }
+
+bool has_unknown_dim(const logical_tensor_t &lt) {
+    for (int d = 0; d < lt.ndims; ++d) {
+        if (lt.dims[d] == DNNL_GRAPH_UNKNOWN_DIM) return true;
+    }
+    return false;
+}
+
+// Appends the shape and the layout of a logical tensor to a specialization
+// key.
+void append_key(std::vector<dim_t> &key, const logical_tensor_t &lt) {
+    key.push_back(lt.ndims);
+    key.insert(key.end(), lt.dims, lt.dims + std::max(lt.ndims, 0));
+    key.push_back(static_cast<dim_t>(lt.layout_type));
+    if (lt.layout_type == layout_type::strided) {
+        key.insert(key.end(), lt.layout.strides,
+                lt.layout.strides + std::max(lt.ndims, 0));
+    } else if (lt.layout_type == layout_type::opaque) {
+        key.push_back(static_cast<dim_t>(lt.layout.layout_id));
+    }
+}
 } // namespace
 
+status_t dnnl_polymorphic_compiled_partition_impl_t::get_kernel(
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs, kernel_ptr &kernel) {
+    std::vector<logical_tensor_t> in_lts, out_lts;
+    std::vector<dim_t> key;
+    for (const auto &t : inputs) {
+        in_lts.push_back(t.get_logical_tensor());
+        append_key(key, in_lts.back());
+    }
+    for (const auto &t : outputs) {
+        out_lts.push_back(t.get_logical_tensor());
+        append_key(key, out_lts.back());
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = kernels_.find(key);
+        if (it != kernels_.end()) {
+            usage_.splice(usage_.begin(), usage_, it->second.second);
+            kernel = it->second.first;
+            return status::success;
+        }
+    }
+
+    for (const auto &lt : in_lts) {
+        if (logical_tensor_wrapper_t(lt).is_shape_unknown())
+            return status::invalid_arguments;
+    }
+    for (const auto &lt : out_lts) {
+        if (logical_tensor_wrapper_t(lt).is_shape_unknown())
+            return status::invalid_arguments;
+    }
+
+    // The compilation may be long, so it does not block the executions of
+    // the shapes already compiled
+    CHECK(part_->compile_kernel(kernel, in_lts, out_lts, get_engine()));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = kernels_.find(key);
+    if (it != kernels_.end()) {
+        // Another thread compiled the same shape meanwhile
+        usage_.splice(usage_.begin(), usage_, it->second.second);
+        kernel = it->second.first;
+        return status::success;
+    }
+    if (kernels_.size() >= max_num_specializations) {
+        kernels_.erase(usage_.back());
+        usage_.pop_back();
+    }
+    usage_.push_front(key);
+    kernels_.emplace(std::move(key), std::make_pair(kernel, usage_.begin()));
+    return status::success;
+}
+
 void dnnl_partition_impl_t::init(FCreateKernel kernel_creator) {
     init_inputs_outputs();
 
@@ -109,8 +184,7 @@ const backend_t *dnnl_partition_impl_t::get_assigned_backend() const {
     return &dnnl_backend_t::get_singleton();
 }
 
-status_t dnnl_partition_impl_t::compile(
-        compiled_partition_t *compiled_partition,
+status_t dnnl_partition_impl_t::compile_kernel(kernel_ptr &kernel,
         const std::vector<logical_tensor_t> &inputs,
         const std::vector<logical_tensor_t> &outputs,
         const engine_t *g_engine) const {
@@ -143,22 +217,49 @@ status_t dnnl_partition_impl_t::compile(
         }
     }
 
-    kernel_ptr kernel = kernel_creator();
+    kernel = kernel_creator();
     if (!kernel) return status::unimplemented;
 
-    status_t ret;
-
     // compile kernel.
     // FIXME(qun) will modify the outputs inside the compile, which
     // break the constant semantics
-    ret = kernel->compile(part.get(), g_engine, inputs, outputs);
-    if (ret != status::success) return ret;
+    return kernel->compile(part.get(), g_engine, inputs, outputs);
+}
 
+status_t dnnl_partition_impl_t::compile(
+        compiled_partition_t *compiled_partition,
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs,
+        const engine_t *g_engine) const {
     std::vector<logical_tensor_t> ordered_inputs;
     std::vector<logical_tensor_t> ordered_outputs;
+    status_t ret;
+
+    // Inputs with unknown dimensions are only compiled at execution, once
+    // the shapes are given by the tensors.
+    if (std::any_of(inputs.begin(), inputs.end(), has_unknown_dim)) {
+        ret = get_ordered_inputs_outputs(inputs_, inputs, ordered_inputs);
+        if (status::success != ret) return ret;
+        ret = get_ordered_inputs_outputs(outputs_, outputs, ordered_outputs);
+        if (status::success != ret) return ret;
+
+        auto pimpl = std::make_shared<
+                dnnl_polymorphic_compiled_partition_impl_t>(*g_engine,
+                ordered_inputs, ordered_outputs,
+                std::dynamic_pointer_cast<const dnnl_partition_impl_t>(
+                        this->clone()));
+        compiled_partition->init(pimpl);
+        return status::success;
+    }
+
+    kernel_ptr kernel;
+    ret = compile_kernel(kernel, inputs, outputs, g_engine);
+    if (ret != status::success) return ret;
+
+    // The kernel may have written the layouts it chose into the logical
+    // tensors, so they are ordered after the compilation
     ret = get_ordered_inputs_outputs(inputs_, inputs, ordered_inputs);
     if (status::success != ret) return ret;
-
     ret = get_ordered_inputs_outputs(outputs_, outputs, ordered_outputs);
     if (status::success != ret) return ret;
 
@@ -17,7 +17,10 @@
 #ifndef GRAPH_BACKEND_DNNL_DNNL_PARTITION_IMPL_HPP
 #define GRAPH_BACKEND_DNNL_DNNL_PARTITION_IMPL_HPP
 
+#include <list>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -86,8 +89,91 @@ private:
     kernel_ptr kernel_;
 };
 
+class dnnl_partition_impl_t;
+
+// A compiled partition for inputs with unknown dimensions. Kernels are only
+// compiled at execution, for the concrete shapes and strides of the given
+// tensors, and are cached so that each distinct shape is compiled once.
+class dnnl_polymorphic_compiled_partition_impl_t
+    : public compiled_partition_impl_t {
+public:
+    dnnl_polymorphic_compiled_partition_impl_t(const engine_t &engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs,
+            const std::shared_ptr<const dnnl_partition_impl_t> &part)
+        : compiled_partition_impl_t(engine, inputs, outputs, {})
+        , part_(part) {}
+
+    status_t execute(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override {
+        kernel_ptr kernel;
+        CHECK(get_kernel(inputs, outputs, kernel));
+        return kernel->execute(g_stream, inputs, outputs);
+    }
+
+#ifdef DNNL_WITH_SYCL
+    status_t execute_sycl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        kernel_ptr kernel;
+        CHECK(get_kernel(inputs, outputs, kernel));
+        return kernel->execute_sycl(
+                g_stream, inputs, outputs, sycl_deps, sycl_event);
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    status_t execute_ocl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<cl_event> &ocl_deps,
+            cl_event *ocl_event) override {
+        kernel_ptr kernel;
+        CHECK(get_kernel(inputs, outputs, kernel));
+        return kernel->execute_ocl(
+                g_stream, inputs, outputs, ocl_deps, ocl_event);
+    }
+#endif
+
+    std::string str() const override {
+        return "dnnl_polymorphic_compiled_partition_impl_t";
+    }
+
+    // Returns the number of kernels compiled so far.
+    size_t get_num_specializations() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return kernels_.size();
+    }
+
+    // The maximum number of kernels kept. The least recently used kernel is
+    // evicted when a new shape is compiled beyond it.
+    static constexpr size_t max_num_specializations = 64;
+
+private:
+    using key_t = std::vector<dim_t>;
+
+    // Returns the kernel specialized for the logical tensors of the given
+    // tensors, compiling it on first use.
+    status_t get_kernel(const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs, kernel_ptr &kernel);
+
+    std::shared_ptr<const dnnl_partition_impl_t> part_;
+
+    // Kernels keyed by the dims and strides of the inputs and outputs, with
+    // their position in the usage order.
+    mutable std::mutex mutex_;
+    std::map<key_t, std::pair<kernel_ptr, std::list<key_t>::iterator>>
+            kernels_;
+    // Keys from the most to the least recently used
+    std::list<key_t> usage_;
+};
+
 class dnnl_partition_impl_t : public partition_impl_t {
     friend class dnnl_backend_t;
+    friend class dnnl_polymorphic_compiled_partition_impl_t;
 
 public:
     dnnl_partition_impl_t(engine_kind_t engine_kind,
@@ -123,6 +209,13 @@ public:
             std::vector<logical_tensor_t *> &outputs) const override;
 
 private:
+    // Creates and compiles the kernel of the partition for the given
+    // logical tensors, which must have known shapes.
+    status_t compile_kernel(kernel_ptr &kernel,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs,
+            const engine_t *g_engine) const;
+
     FCreateKernel kernel_creator_;
 };
 
@@ -612,6 +612,56 @@ status_t infer_dnnl_host_scalar_output_shape(op_t *n,
     return status::success;
 }
 
+status_t infer_dnnl_embedding_bag_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    // Fused scales and post-op inputs are appended after the lookup inputs, so
+    // only pass table, indices and the optional offsets to the frontend rule.
+    const bool with_offsets = n->has_attr(op_attr::with_offsets)
+            && n->get_attr<bool>(op_attr::with_offsets);
+    std::vector<logical_tensor_t *> lookup_inputs(
+            inputs.begin(), inputs.begin() + (with_offsets ? 3 : 2));
+    return infer_embedding_bag_output_shape(n, lookup_inputs, outputs);
+}
+
+status_t infer_dnnl_topk_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    // The scratchpad output is not known to the frontend rule.
+    std::vector<logical_tensor_t *> topk_outputs(
+            outputs.begin(), outputs.begin() + 2);
+    return infer_topk_output_shape(n, inputs, topk_outputs);
+}
+
+status_t infer_slice_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto out = logical_tensor_wrapper_t(outputs[0]);
+    if (!out.is_shape_unknown()) return status::success;
+
+    dims inferred_out_dims = logical_tensor_wrapper_t(inputs[0]).vdims();
+    const auto ndims = static_cast<int64_t>(inferred_out_dims.size());
+    auto axis = n->get_attr<int64_t>(op_attr::axis);
+    if (axis < 0) axis += ndims;
+    VCHECK_INVALID_SHAPE(axis >= 0 && axis < ndims,
+            "%s, slice axis %ld is out of range for %ld dims",
+            op_t::kind2str(n->get_kind()).c_str(), static_cast<long>(axis),
+            static_cast<long>(ndims));
+
+    const auto begin = n->get_attr<int64_t>(op_attr::slice_begin);
+    const auto size = n->get_attr<int64_t>(op_attr::slice_size);
+    VCHECK_INVALID_SHAPE(begin >= 0 && size >= 0
+                    && begin + size <= inferred_out_dims[axis],
+            "%s, slice [%ld, %ld) is out of range for the dim %ld",
+            op_t::kind2str(n->get_kind()).c_str(), static_cast<long>(begin),
+            static_cast<long>(begin + size),
+            static_cast<long>(inferred_out_dims[axis]));
+    inferred_out_dims[axis] = size;
+
+    set_shape_and_strides(*outputs[0], inferred_out_dims);
+    return status::success;
+}
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
@@ -305,6 +305,12 @@ public:
         return data_[k];
     }
 
+    // Copy the fusion information of another manager, so that passes can be
+    // tried on a copy of a subgraph whose ops refer to the same keys
+    void copy_info_from(const fusion_info_mgr_t &other) {
+        data_ = other.data_;
+    }
+
     const fpmath_t &get_fpmath_mode() const { return fpmath_mode_; }
     bool get_use_blocked_layout() const { return can_use_blocked_layout_; }
 
@@ -48,6 +48,9 @@ const op_attr_t keep_dst_layout = 0x1000f;
 const op_attr_t with_scale = 0x10010;
 const op_attr_t is_invert_scale = 0x10011;
 const op_attr_t mask_type = 0x10012;
+const op_attr_t with_offsets = 0x10013;
+const op_attr_t with_softmax = 0x10014;
+const op_attr_t is_zero_copy = 0x10015;
 
 // int64_t
 const op_attr_t alg_kind = 0x10100;
@@ -56,6 +59,8 @@ const op_attr_t group_mask = 0x10104;
 const op_attr_t data_type = 0x10105;
 const op_attr_t axis_row = 0x10106;
 const op_attr_t axis_col = 0x10107;
+const op_attr_t slice_begin = 0x10108;
+const op_attr_t slice_size = 0x10109;
 
 // string
 const op_attr_t dw_type = 0x10201;
@@ -92,10 +97,15 @@ static inline std::string internal_attr2str(op_attr_t attr) {
         CASE(with_scale);
         CASE(is_invert_scale);
         CASE(mask_type);
+        CASE(with_offsets);
+        CASE(with_softmax);
+        CASE(is_zero_copy);
         CASE(alg_kind);
         CASE(fusion_info_key);
         CASE(axis_row);
         CASE(axis_col);
+        CASE(slice_begin);
+        CASE(slice_size);
         CASE(dw_type);
         CASE(kind);
         CASE(p);
@@ -81,6 +81,9 @@ namespace op_kind {
     X(dnnl_gen_index, Dnnl_gen_index) \
     X(dnnl_mask, Dnnl_mask) \
     X(dnnl_sdpa, Dnnl_sdpa) \
+    X(dnnl_embedding_bag, Dnnl_embedding_bag) \
+    X(dnnl_topk, Dnnl_topk) \
+    X(dnnl_slice, Dnnl_slice) \
     X(dnnl_host_scalar, Dnnl_host_scalar)
 
 enum kind_t {
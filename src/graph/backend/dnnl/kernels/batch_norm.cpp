@@ -109,7 +109,8 @@ status_t batch_norm_fwd_t::compile_impl(const dnnl_partition_impl_t *part,
         return this->memory_planner_.get_exec_args_set().clone();
     };
 
-    const_md_hash_ = generate_constant_md_hash(part->id(),
+    const_md_hash_ = generate_constant_md_hash(
+            get_constant_subgraph_key(part->id(), subgraph_),
             memory_planner_.get_exec_args_set().get_persistent_mem_desc_list());
 
     return status::success;
@@ -139,7 +140,7 @@ status_t batch_norm_fwd_t::execute_impl(const stream_t *g_stream,
                 = encode_constant_cache_key(inputs, const_md_hash_);
         std::promise<constant_tensor_cache_t::cached_t> c_promise;
         constant_tensor_cache_t::value_t cached_value
-                = dnnl_constant_cache_get_or_add(p_engine_, encoded_key,
+                = get_or_add_constant_cache(encoded_key,
                         memory_planner_.total_internal_persistent_size(),
                         c_promise.get_future());
         bool is_from_cache = cached_value.valid();
@@ -210,7 +211,7 @@ status_t batch_norm_fwd_t::sycl_execute_impl(const stream_t *g_stream,
                 = encode_constant_cache_key(inputs, const_md_hash_);
         std::promise<constant_tensor_cache_t::cached_t> c_promise;
         constant_tensor_cache_t::value_t cached_value
-                = dnnl_constant_cache_get_or_add(p_engine_, encoded_key,
+                = get_or_add_constant_cache(encoded_key,
                         memory_planner_.total_internal_persistent_size(),
                         c_promise.get_future());
         bool is_from_cache = cached_value.valid();
@@ -287,7 +288,7 @@ status_t batch_norm_fwd_t::ocl_execute_impl(const stream_t *g_stream,
                 = encode_constant_cache_key(inputs, const_md_hash_);
         std::promise<constant_tensor_cache_t::cached_t> c_promise;
         constant_tensor_cache_t::value_t cached_value
-                = dnnl_constant_cache_get_or_add(p_engine_, encoded_key,
+                = get_or_add_constant_cache(encoded_key,
                         memory_planner_.total_internal_persistent_size(),
                         c_promise.get_future());
         bool is_from_cache = cached_value.valid();
@@ -103,6 +103,12 @@ void concat_t<quantized>::prepare_args_set(const execution_args_set_t *res,
     for (auto &mem_offkey : res->get_mems_use_internal_temporary()) {
         mem_offkey.first.set_data_handle(var_grantor.get(mem_offkey.second));
     }
+
+    // concat inputs written in place into the concat output
+    for (const auto &sub : res->get_mems_use_sub_buffers()) {
+        sub.mem.set_data_handle(
+                static_cast<char *>(sub.base.get_data_handle()) + sub.offset);
+    }
 }
 
 template <bool quantized>
@@ -134,7 +134,8 @@ status_t conv_fwd_t<quantized>::compile_impl(const dnnl_partition_impl_t *part,
         return this->memory_planner_.get_exec_args_set().clone();
     };
 
-    const_md_hash_ = generate_constant_md_hash(part->id(),
+    const_md_hash_ = generate_constant_md_hash(
+            get_constant_subgraph_key(part->id(), subgraph_),
             memory_planner_.get_exec_args_set().get_persistent_mem_desc_list());
 
     return status::success;
@@ -202,7 +203,8 @@ status_t conv_bwd_data_t::compile_impl(const dnnl_partition_impl_t *part,
         return this->memory_planner_.get_exec_args_set().clone();
     };
 
-    const_md_hash_ = generate_constant_md_hash(part->id(),
+    const_md_hash_ = generate_constant_md_hash(
+            get_constant_subgraph_key(part->id(), subgraph_),
             memory_planner_.get_exec_args_set().get_persistent_mem_desc_list());
 
     return status::success;
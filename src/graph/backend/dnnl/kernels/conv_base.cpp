@@ -67,7 +67,7 @@ status_t conv_base_t::execute_impl(const stream_t *g_stream,
                 = encode_constant_cache_key(inputs, const_md_hash_);
         std::promise<constant_tensor_cache_t::cached_t> c_promise;
         constant_tensor_cache_t::value_t cached_value
-                = dnnl_constant_cache_get_or_add(p_engine_, encoded_key,
+                = get_or_add_constant_cache(encoded_key,
                         memory_planner_.total_internal_persistent_size(),
                         c_promise.get_future());
         bool is_from_cache = cached_value.valid();
@@ -138,7 +138,7 @@ status_t conv_base_t::sycl_execute_impl(const stream_t *g_stream,
                 = encode_constant_cache_key(inputs, const_md_hash_);
         std::promise<constant_tensor_cache_t::cached_t> c_promise;
         constant_tensor_cache_t::value_t cached_value
-                = dnnl_constant_cache_get_or_add(p_engine_, encoded_key,
+                = get_or_add_constant_cache(encoded_key,
                         memory_planner_.total_internal_persistent_size(),
                         c_promise.get_future());
         bool is_from_cache = cached_value.valid();
@@ -215,7 +215,7 @@ status_t conv_base_t::ocl_execute_impl(const stream_t *g_stream,
                 = encode_constant_cache_key(inputs, const_md_hash_);
         std::promise<constant_tensor_cache_t::cached_t> c_promise;
         constant_tensor_cache_t::value_t cached_value
-                = dnnl_constant_cache_get_or_add(p_engine_, encoded_key,
+                = get_or_add_constant_cache(encoded_key,
                         memory_planner_.total_internal_persistent_size(),
                         c_promise.get_future());
         bool is_from_cache = cached_value.valid();
@@ -0,0 +1,652 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+#include "cpu/platform.hpp"
+
+#include "graph/backend/dnnl/kernels/conv_bnorm_decomp.hpp"
+
+#include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/fusion_info.hpp"
+#include "graph/backend/dnnl/passes/lower.hpp"
+#include "graph/backend/dnnl/passes/transform.hpp"
+#include "graph/backend/dnnl/passes/utils.hpp"
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+#include "cpu/cpu_stream.hpp"
+#include "oneapi/dnnl/dnnl_threadpool.h"
+#endif
+
+#define VCHECK_CONV_BNORM_DECOMP(cond, status, msg, ...) \
+    VCONDCHECK(graph, create, check, conv_bnorm_decomp_kernel_t, (cond), \
+            status, msg, ##__VA_ARGS__);
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+using op_ptr = std::shared_ptr<op_t>;
+using ltw = logical_tensor_wrapper_t;
+
+namespace {
+// Returns true if `lt` is a plain tensor of shape `shape` with dense
+// row-major strides. A tensor with `any` layout is set to such a tensor.
+bool init_dense(logical_tensor_t &lt, const dims &shape) {
+    const int ndims = static_cast<int>(shape.size());
+    if (ltw(lt).is_any()) {
+        lt.ndims = ndims;
+        lt.layout_type = layout_type::strided;
+        dim_t stride = 1;
+        for (int d = ndims - 1; d >= 0; d--) {
+            lt.dims[d] = shape[d];
+            lt.layout.strides[d] = stride;
+            stride *= shape[d];
+        }
+    }
+    const ltw w(lt);
+    if (!w.is_strided() || w.vdims() != shape) return false;
+    const auto strides = w.vstrides();
+    dim_t stride = 1;
+    for (int d = ndims - 1; d >= 0; d--) {
+        if (shape[d] != 1 && strides[d] != stride) return false;
+        stride *= shape[d];
+    }
+    return true;
+}
+
+template <typename T>
+T get_attr_or(const op_ptr &op, op_attr_t attr, const T &def) {
+    return op->has_attr(attr) ? op->get_attr<T>(attr) : def;
+}
+
+// Per-channel statistics of a set of points: their number, their mean and
+// the sum of squared differences from the mean.
+struct stats_t {
+    dim_t n;
+    double *mean, *m2;
+
+    // Merges the statistics of `n_b` other points (Chan et al.).
+    void merge(dim_t n_b, const double *mean_b, const double *m2_b, dim_t c) {
+        const double n_ab = static_cast<double>(n + n_b);
+        const double w = static_cast<double>(n_b) / n_ab;
+        const double w_m2 = static_cast<double>(n) * n_b / n_ab;
+        for (dim_t i = 0; i < c; i++) {
+            const double delta = mean_b[i] - mean[i];
+            mean[i] += delta * w;
+            m2[i] += m2_b[i] + delta * delta * w_m2;
+        }
+        n += n_b;
+    }
+};
+} // namespace
+
+status_t conv_bnorm_decomp_kernel_t::compile_impl(
+        const dnnl_partition_impl_t *part, const engine_t *g_engine,
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    VCHECK_CONV_BNORM_DECOMP(g_engine->kind() == engine_kind::cpu,
+            status::unimplemented, "only cpu engine is supported");
+
+    p_engine_ = make_dnnl_engine(*g_engine);
+    g_alloc_
+            = reinterpret_cast<graph::allocator_t *>(g_engine->get_allocator());
+
+    subgraph_ = std::make_shared<subgraph_t>(
+            part->get_ops(), p_engine_, part->get_fpmath_mode(), false, true);
+    BACKEND_DNNL_CHECK(set_given_inputs_outputs(subgraph_, inputs, outputs));
+
+    subgraph_visualizer_t vis(part->id());
+    pass_pipeline_t pipeline = pass_pipeline_t(vis);
+    BACKEND_DNNL_ADD_PASS(pipeline, lower_down);
+    BACKEND_DNNL_ADD_PASS(pipeline, check_with_bias);
+    BACKEND_DNNL_CHECK(pipeline.run(subgraph_));
+
+    op_ptr conv, bnorm, relu;
+    for (const auto &op : subgraph_->get_ops()) {
+        if (op->get_kind() == op_kind::dnnl_convolution && !conv)
+            conv = op;
+        else if (op->get_kind() == op_kind::dnnl_batchnorm && !bnorm)
+            bnorm = op;
+        else if (op->get_kind() == op_kind::dnnl_eltwise && !relu)
+            relu = op;
+        else
+            VCHECK_CONV_BNORM_DECOMP(false, status::unimplemented,
+                    "unexpected op %s", op->get_name().c_str());
+    }
+    VCHECK_CONV_BNORM_DECOMP(conv && bnorm
+                    && bnorm->get_input_value(0)->has_producer()
+                    && &bnorm->get_input_value(0)->get_producer()
+                            == conv.get(),
+            status::unimplemented,
+            "expected a convolution and a batch normalization");
+    VCHECK_CONV_BNORM_DECOMP(bnorm->get_attr<bool>(op_attr::is_training),
+            status::unimplemented, "only training batch normalization");
+    if (relu) {
+        const auto alg = static_cast<dnnl::algorithm>(
+                relu->get_attr<int64_t>(op_attr::alg_kind));
+        VCHECK_CONV_BNORM_DECOMP(alg == algorithm::eltwise_relu
+                        && get_attr_or<float>(relu, op_attr::alpha, 0.f) == 0.f
+                        && relu->get_input_value(0)->has_producer()
+                        && &relu->get_input_value(0)->get_producer()
+                                == bnorm.get(),
+                status::unimplemented, "only ReLU is supported after bnorm");
+    }
+
+    // Layouts and attributes.
+    const auto wei_fmt
+            = get_attr_or<std::string>(conv, op_attr::weights_format, "XIO");
+    VCHECK_CONV_BNORM_DECOMP(
+            get_attr_or<std::string>(conv, op_attr::data_format, "NXC")
+                            == "NXC"
+                    && get_attr_or<std::string>(
+                               bnorm, op_attr::data_format, "NXC")
+                            == "NXC",
+            status::unimplemented, "only NXC data format is supported");
+    VCHECK_CONV_BNORM_DECOMP(wei_fmt == "XIO" || wei_fmt == "OIX",
+            status::unimplemented, "unsupported weights format %s",
+            wei_fmt.c_str());
+    VCHECK_CONV_BNORM_DECOMP(
+            get_attr_or<int64_t>(conv, op_attr::groups, 1) == 1,
+            status::unimplemented, "grouped convolution is not supported");
+    VCHECK_CONV_BNORM_DECOMP(
+            get_attr_or<std::string>(conv, op_attr::auto_pad, "None")
+                    == "None",
+            status::unimplemented, "auto padding is not supported");
+    epsilon_ = bnorm->get_attr<float>(op_attr::epsilon);
+    momentum_ = get_attr_or<float>(bnorm, op_attr::momentum, 0.5f);
+
+    auto &mgr = subgraph_->fusion_info_mgr_;
+    conv_attr_.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+    const auto fpmath = mgr.get_fpmath_mode();
+    conv_attr_.set_fpmath_mode(
+            static_cast<dnnl::fpmath_mode>(fpmath.mode_), fpmath.apply_to_int_);
+
+    // Partition inputs and outputs.
+    const auto find_input = [&](const op_ptr &op, size_t offset, int &idx) {
+        const auto id = op->get_input_value(offset)->get_logical_tensor().id;
+        for (size_t i = 0; i < inputs.size(); i++)
+            if (inputs[i].id == id) {
+                idx = static_cast<int>(i);
+                return true;
+            }
+        return false;
+    };
+    const auto find_output = [&](const op_ptr &op, size_t offset, int &idx) {
+        idx = -1;
+        const auto id = op->get_output_value(offset)->get_logical_tensor().id;
+        for (size_t i = 0; i < outputs.size(); i++)
+            if (outputs[i].id == id) idx = static_cast<int>(i);
+        return idx >= 0;
+    };
+    int src = -1, wei = -1, mean = -1, var = -1, dst = -1;
+    const bool with_bias = conv->has_attr(op_attr::with_bias)
+            && conv->get_attr<bool>(op_attr::with_bias);
+    const bool with_scale_shift = bnorm->num_inputs() >= 5;
+    VCHECK_CONV_BNORM_DECOMP(bnorm->num_inputs() != 4, status::unimplemented,
+            "scale without shift is not supported");
+    VCHECK_CONV_BNORM_DECOMP(find_input(conv, 0, src)
+                    && find_input(conv, 1, wei)
+                    && (!with_bias || find_input(conv, 2, bias_idx_))
+                    && find_input(bnorm, 1, mean) && find_input(bnorm, 2, var)
+                    && (!with_scale_shift
+                            || (find_input(bnorm, 3, scale_idx_)
+                                    && find_input(bnorm, 4, shift_idx_))),
+            status::unimplemented, "inputs of the partition are not given");
+    src_idx_ = src;
+    wei_idx_ = wei;
+    mean_idx_ = mean;
+    var_idx_ = var;
+
+    // The normalized output is written once: the batch normalization output
+    // can not be used outside of the partition when it is followed by ReLU.
+    VCHECK_CONV_BNORM_DECOMP(relu ? find_output(relu, 0, dst)
+                                            && !find_output(bnorm, 0, dst)
+                                          : find_output(bnorm, 0, dst),
+            status::unimplemented, "unsupported outputs of the partition");
+    if (relu) find_output(relu, 0, dst);
+    dst_idx_ = dst;
+    find_output(conv, 0, conv_dst_idx_);
+    find_output(bnorm, 1, running_mean_idx_);
+    find_output(bnorm, 2, running_var_idx_);
+    find_output(bnorm, 3, batch_mean_idx_);
+    find_output(bnorm, 4, batch_var_idx_);
+
+    const auto &src_lt = inputs[src_idx_];
+    const auto &wei_lt = inputs[wei_idx_];
+    VCHECK_CONV_BNORM_DECOMP(
+            ltw(src_lt).ndims() == 4 && ltw(wei_lt).ndims() == 4
+                    && ltw(wei_lt).is_strided(),
+            status::unimplemented, "only 2D convolution is supported");
+    for (const auto *lt : {&src_lt, &wei_lt, &inputs[mean_idx_]})
+        VCHECK_CONV_BNORM_DECOMP(ltw(*lt).data_type() == data_type::f32,
+                status::unimplemented, "only f32 is supported");
+
+    // Geometry.
+    const auto src_dims = ltw(src_lt).vdims();
+    const auto wei_dims = ltw(wei_lt).vdims();
+    const auto wei_strides = ltw(wei_lt).vstrides();
+    mb_ = src_dims[0];
+    ih_ = src_dims[1];
+    iw_ = src_dims[2];
+    ic_ = src_dims[3];
+    // Weights in the {OC, IC, KH, KW} order of the primitives.
+    const std::vector<int> wei_perm = wei_fmt == "XIO"
+            ? std::vector<int> {3, 2, 0, 1}
+            : std::vector<int> {0, 1, 2, 3};
+    memory::dims user_wei_strides(4);
+    wei_dims_.resize(4);
+    for (int d = 0; d < 4; d++) {
+        wei_dims_[d] = wei_dims[wei_perm[d]];
+        user_wei_strides[d] = wei_strides[wei_perm[d]];
+    }
+    oc_ = wei_dims_[0];
+    VCHECK_CONV_BNORM_DECOMP(wei_dims_[1] == ic_, status::unimplemented,
+            "channels mismatch between source and weights");
+
+    conv_strides_ = conv->get_attr<dims>(op_attr::strides);
+    conv_dilates_ = get_compatible_dilates(
+            conv->get_attr<dims>(op_attr::dilations));
+    const auto pads_l = conv->get_attr<dims>(op_attr::pads_begin);
+    const auto pads_r = conv->get_attr<dims>(op_attr::pads_end);
+    VCHECK_CONV_BNORM_DECOMP(conv_strides_.size() == 2
+                    && conv_dilates_.size() == 2 && pads_l.size() == 2
+                    && pads_r.size() == 2,
+            status::unimplemented, "only 2D convolution is supported");
+    const dim_t conv_kw = (wei_dims_[3] - 1) * (conv_dilates_[1] + 1) + 1;
+    conv_kh_ = (wei_dims_[2] - 1) * (conv_dilates_[0] + 1) + 1;
+    conv_sh_ = conv_strides_[0];
+    conv_pt_ = pads_l[0];
+    conv_pl_ = pads_l[1];
+    conv_pr_ = pads_r[1];
+    VCHECK_CONV_BNORM_DECOMP(conv_pt_ < conv_kh_ && pads_r[0] < conv_kh_,
+            status::unimplemented, "padding exceeds the kernel extent");
+    oh_ = (ih_ + conv_pt_ + pads_r[0] - conv_kh_) / conv_sh_ + 1;
+    ow_ = (iw_ + conv_pl_ + conv_pr_ - conv_kw) / conv_strides_[1] + 1;
+    VCHECK_CONV_BNORM_DECOMP(oh_ > 0 && ow_ > 0, status::unimplemented,
+            "empty output");
+
+    // Tensors are accessed as dense NHWC ones. The given logical tensors are
+    // only updated once the kernel is known to be supported, so that the
+    // fallback kernel sees them unchanged.
+    const dims data_dims {mb_, oh_, ow_, oc_}, stat_dims {oc_};
+    std::vector<logical_tensor_t> new_outputs(outputs);
+    logical_tensor_t in_src = src_lt;
+    VCHECK_CONV_BNORM_DECOMP(
+            init_dense(in_src, {mb_, ih_, iw_, ic_})
+                    && init_dense(new_outputs[dst_idx_], data_dims)
+                    && (conv_dst_idx_ < 0
+                            || init_dense(
+                                    new_outputs[conv_dst_idx_], data_dims)),
+            status::unimplemented, "only dense NHWC tensors are supported");
+    for (int idx : {bias_idx_, scale_idx_, shift_idx_,
+                 static_cast<int>(mean_idx_), static_cast<int>(var_idx_)}) {
+        if (idx < 0) continue;
+        logical_tensor_t lt = inputs[idx];
+        VCHECK_CONV_BNORM_DECOMP(init_dense(lt, stat_dims)
+                        && ltw(lt).data_type() == data_type::f32,
+                status::unimplemented, "only dense f32 channel vectors");
+    }
+    for (int idx : {running_mean_idx_, running_var_idx_, batch_mean_idx_,
+                 batch_var_idx_}) {
+        if (idx < 0) continue;
+        VCHECK_CONV_BNORM_DECOMP(init_dense(new_outputs[idx], stat_dims)
+                        && ltw(new_outputs[idx]).data_type()
+                                == data_type::f32,
+                status::unimplemented, "only dense f32 statistics");
+    }
+    VCHECK_CONV_BNORM_DECOMP(
+            ltw(new_outputs[dst_idx_]).data_type() == data_type::f32,
+            status::unimplemented, "only f32 is supported");
+
+    using tag = memory::format_tag;
+    user_wei_md_ = memory::desc(
+            wei_dims_, memory::data_type::f32, user_wei_strides);
+    if (bias_idx_ >= 0)
+        bias_md_ = memory::desc({oc_}, memory::data_type::f32, tag::a);
+    data_md_ = memory::desc(
+            {mb_, oc_, oh_, ow_}, memory::data_type::f32, tag::nhwc);
+    stat_md_ = memory::desc({oc_}, memory::data_type::f32, tag::a);
+
+    // Bands are distributed over threads, so the decomposition only pays off
+    // when there are enough of them.
+    nthr_ = dnnl_get_current_num_threads();
+    VCHECK_CONV_BNORM_DECOMP(mb_ * oh_ >= nthr_, status::unimplemented,
+            "not enough output rows for %d threads: batch %ld, rows %ld",
+            nthr_, static_cast<long int>(mb_), static_cast<long int>(oh_));
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    // Convolutions are executed inside of a parallel region, so they are
+    // created for a single thread.
+    omp_set_num_threads(1);
+#endif
+    const status_t st = init_bands();
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    omp_set_num_threads(nthr_);
+#endif
+    CHECK(st);
+
+    // The normalization is applied with the batch statistics, as given
+    // statistics, by all threads.
+    auto flags = dnnl::normalization_flags::use_global_stats;
+    if (scale_idx_ >= 0)
+        flags |= dnnl::normalization_flags::use_scale
+                | dnnl::normalization_flags::use_shift;
+    if (relu) flags |= dnnl::normalization_flags::fuse_norm_relu;
+    dnnl::primitive_attr bnorm_attr;
+    bnorm_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+    auto bnorm_pd = batch_normalization_forward::primitive_desc(p_engine_,
+            prop_kind::forward_inference, data_md_, data_md_, epsilon_, flags,
+            bnorm_attr, true);
+    VCHECK_CONV_BNORM_DECOMP(bnorm_pd, status::unimplemented,
+            "failed to create a batch normalization");
+    bnorm_scratchpad_size_ = bnorm_pd.scratchpad_desc().get_size();
+    bnorm_ = batch_normalization_forward(bnorm_pd);
+
+    for (size_t i = 0; i < outputs.size(); i++)
+        const_cast<logical_tensor_t &>(outputs[i]) = new_outputs[i];
+    return status::success;
+}
+
+status_t conv_bnorm_decomp_kernel_t::init_bands() {
+    const size_t row_size = ow_ * oc_ * sizeof(float);
+
+    // The rows of a band should stay in the private L2 cache of a core
+    // together with the source rows and the weights, so only half of it is
+    // given to them.
+    const size_t cache_size = cpu::platform::get_per_core_cache_size(2) / 2;
+    dim_t band = std::max<dim_t>(1, cache_size / row_size);
+    // Keep enough bands to occupy all threads.
+    band = std::min(band,
+            dnnl::impl::utils::div_up(
+                    oh_, dnnl::impl::utils::div_up<dim_t>(nthr_, mb_)));
+
+    for (dim_t oh_beg = 0; oh_beg < oh_; oh_beg += band) {
+        band_t b;
+        b.oh_beg = oh_beg;
+        b.oh_end = std::min(oh_, oh_beg + band);
+        CHECK(get_conv(b.oh_beg, b.oh_end, b.conv, b.ih_beg));
+        bands_.push_back(b);
+    }
+    return status::success;
+}
+
+status_t conv_bnorm_decomp_kernel_t::get_conv(
+        dim_t oh_beg, dim_t oh_end, int &conv, dim_t &ih_beg) {
+    const dim_t in_beg = oh_beg * conv_sh_ - conv_pt_;
+    const dim_t in_end = (oh_end - 1) * conv_sh_ - conv_pt_ + conv_kh_;
+    ih_beg = std::max<dim_t>(0, in_beg);
+    const dim_t ih_end = std::min(ih_, in_end);
+    const dim_t pad_t = ih_beg - in_beg;
+    const dim_t pad_b = in_end - ih_end;
+
+    const band_key_t key {ih_end - ih_beg, pad_t, pad_b, oh_end - oh_beg};
+    const auto it = conv_cache_.find(key);
+    if (it != conv_cache_.end()) {
+        conv = it->second;
+        return status::success;
+    }
+
+    using tag = memory::format_tag;
+    const auto f32 = memory::data_type::f32;
+    conv_band_t c;
+    c.src_md = memory::desc({1, ic_, ih_end - ih_beg, iw_}, f32, tag::nhwc);
+    c.dst_md = memory::desc({1, oc_, oh_end - oh_beg, ow_}, f32, tag::nhwc);
+    const memory::desc wei_md(wei_dims_, f32, tag::any);
+    const dims pads_l {pad_t, conv_pl_}, pads_r {pad_b, conv_pr_};
+
+    convolution_forward::primitive_desc pd;
+    if (bias_idx_ >= 0)
+        pd = convolution_forward::primitive_desc(p_engine_,
+                prop_kind::forward_training, algorithm::convolution_direct,
+                c.src_md, wei_md, bias_md_, c.dst_md, conv_strides_,
+                conv_dilates_, pads_l, pads_r, conv_attr_, true);
+    else
+        pd = convolution_forward::primitive_desc(p_engine_,
+                prop_kind::forward_training, algorithm::convolution_direct,
+                c.src_md, wei_md, c.dst_md, conv_strides_, conv_dilates_,
+                pads_l, pads_r, conv_attr_, true);
+    VCHECK_CONV_BNORM_DECOMP(pd, status::unimplemented,
+            "failed to create a convolution for %ld rows",
+            static_cast<long int>(oh_end - oh_beg));
+
+    // Bands share the weights layouts.
+    const auto &wei_layout = pd.weights_desc();
+    const auto wei_it = std::find(wei_mds_.begin(), wei_mds_.end(), wei_layout);
+    c.wei_layout = wei_it - wei_mds_.begin();
+    if (wei_it == wei_mds_.end()) {
+        auto reorder_pd = reorder::primitive_desc(p_engine_, user_wei_md_,
+                p_engine_, wei_layout, primitive_attr(), true);
+        VCHECK_CONV_BNORM_DECOMP(reorder_pd, status::unimplemented,
+                "failed to create a weights reorder");
+        wei_mds_.push_back(wei_layout);
+        wei_reorders_.emplace_back(reorder_pd);
+    }
+
+    conv_scratchpad_size_ = std::max(
+            conv_scratchpad_size_, pd.scratchpad_desc().get_size());
+    c.prim = convolution_forward(pd);
+    conv = static_cast<int>(convs_.size());
+    convs_.push_back(c);
+    conv_cache_.emplace(key, conv);
+    return status::success;
+}
+
+status_t conv_bnorm_decomp_kernel_t::execute_impl(const stream_t *g_stream,
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs) {
+    dnnl::stream strm = make_dnnl_stream(p_engine_, *g_stream);
+
+    int nthr = nthr_;
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    auto *tp_stream
+            = dnnl::impl::utils::downcast<dnnl::impl::cpu::cpu_stream_t *>(
+                    const_cast<stream_t *>(g_stream));
+    tp_stream->before_exec_hook();
+    dnnl_threadpool_interop_get_max_concurrency(&nthr);
+    tp_stream->after_exec_hook();
+#endif
+
+    // The scratchpad holds the reordered weights, the batch statistics when
+    // they are not outputs of the partition, the scratchpad of the
+    // normalization and, for each thread, the statistics of its bands and
+    // the scratchpad of the convolutions.
+    using dnnl::impl::utils::rnd_up;
+    constexpr size_t align = 64;
+    size_t size = 0;
+    std::vector<size_t> wei_offsets;
+    for (const auto &md : wei_mds_) {
+        wei_offsets.push_back(size);
+        size += rnd_up(md.get_size(), align);
+    }
+    const size_t stat_size = rnd_up(oc_ * sizeof(float), align);
+    const size_t batch_stats_offset = size;
+    size += 2 * stat_size;
+    const size_t bnorm_scratchpad_offset = size;
+    size += rnd_up(bnorm_scratchpad_size_, align);
+    // mean and m2 of the thread and of the current band
+    const size_t thr_stats_size = rnd_up(4 * oc_ * sizeof(double), align);
+    const size_t thr_size
+            = thr_stats_size + rnd_up(conv_scratchpad_size_, align);
+    const size_t thr_offset = size;
+    size += nthr * thr_size;
+    temporary_scratchpad_t scratchpad(size, p_engine_, *g_alloc_);
+    assertm(scratchpad.size() >= size, "no enough scratchpad memory");
+    char *buf = scratchpad.get_buffer();
+
+    memory user_wei(
+            user_wei_md_, p_engine_, inputs[wei_idx_].get_data_handle());
+    std::vector<memory> weis;
+    for (size_t i = 0; i < wei_mds_.size(); i++) {
+        weis.emplace_back(wei_mds_[i], p_engine_, buf + wei_offsets[i]);
+        wei_reorders_[i].execute(strm, user_wei, weis[i]);
+    }
+    memory bias;
+    if (bias_idx_ >= 0)
+        bias = memory(
+                bias_md_, p_engine_, inputs[bias_idx_].get_data_handle());
+
+    const char *src = static_cast<const char *>(
+            inputs[src_idx_].get_data_handle());
+    float *conv_dst = static_cast<float *>(
+            outputs[conv_dst_idx_ >= 0 ? conv_dst_idx_ : dst_idx_]
+                    .get_data_handle());
+    const dim_t n_bands = static_cast<dim_t>(bands_.size());
+    const memory::desc conv_scratchpad_md(
+            {static_cast<dim_t>(conv_scratchpad_size_)},
+            memory::data_type::u8, memory::format_tag::a);
+    std::vector<dim_t> thr_count(nthr, 0);
+
+    // Convolution of the bands and their statistics.
+    const auto loop = [&](int ithr, int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(mb_ * n_bands, nthr, ithr, start, end);
+        if (start == end) return;
+
+        char *thr_buf = buf + thr_offset + ithr * thr_size;
+        double *thr_mean = reinterpret_cast<double *>(thr_buf);
+        double *thr_m2 = thr_mean + oc_;
+        double *band_mean = thr_m2 + oc_;
+        double *band_m2 = band_mean + oc_;
+        memory conv_scratchpad(
+                conv_scratchpad_md, p_engine_, thr_buf + thr_stats_size);
+        stats_t stats {0, thr_mean, thr_m2};
+        std::fill(thr_mean, thr_mean + 2 * oc_, 0.);
+
+        for (dim_t t = start; t < end; t++) {
+            const dim_t n = t / n_bands, b = t % n_bands;
+            const auto &band = bands_[b];
+            const auto &c = convs_[band.conv];
+            float *band_dst = conv_dst + (n * oh_ + band.oh_beg) * ow_ * oc_;
+
+            memory conv_src(c.src_md, p_engine_,
+                    const_cast<char *>(src)
+                            + (n * ih_ + band.ih_beg) * iw_ * ic_
+                                    * sizeof(float));
+            memory conv_dst_mem(c.dst_md, p_engine_, band_dst);
+            std::unordered_map<int, memory> args {{DNNL_ARG_SRC, conv_src},
+                    {DNNL_ARG_WEIGHTS, weis[c.wei_layout]},
+                    {DNNL_ARG_DST, conv_dst_mem},
+                    {DNNL_ARG_SCRATCHPAD, conv_scratchpad}};
+            if (bias_idx_ >= 0) args.insert({DNNL_ARG_BIAS, bias});
+            c.prim.execute(strm, args);
+
+            // The band is still in cache: its statistics are computed in two
+            // passes, which is exact even for data with a large mean, and are
+            // merged into the ones of the thread.
+            const dim_t sp = (band.oh_end - band.oh_beg) * ow_;
+            std::fill(band_mean, band_mean + 2 * oc_, 0.);
+            for (dim_t s = 0; s < sp; s++) {
+                const float *d = band_dst + s * oc_;
+                PRAGMA_OMP_SIMD()
+                for (dim_t i = 0; i < oc_; i++)
+                    band_mean[i] += d[i];
+            }
+            for (dim_t i = 0; i < oc_; i++)
+                band_mean[i] /= sp;
+            for (dim_t s = 0; s < sp; s++) {
+                const float *d = band_dst + s * oc_;
+                PRAGMA_OMP_SIMD()
+                for (dim_t i = 0; i < oc_; i++) {
+                    const double diff = d[i] - band_mean[i];
+                    band_m2[i] += diff * diff;
+                }
+            }
+            stats.merge(sp, band_mean, band_m2, oc_);
+        }
+        thr_count[ithr] = stats.n;
+    };
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    tp_stream->before_exec_hook();
+#endif
+    parallel(nthr, loop);
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    tp_stream->after_exec_hook();
+#endif
+
+    // Batch statistics.
+    const auto out_ptr = [&](int idx, size_t offset) {
+        return idx >= 0 ? static_cast<float *>(outputs[idx].get_data_handle())
+                        : reinterpret_cast<float *>(buf + offset);
+    };
+    float *batch_mean = out_ptr(batch_mean_idx_, batch_stats_offset);
+    float *batch_var
+            = out_ptr(batch_var_idx_, batch_stats_offset + stat_size);
+    {
+        double *mean = reinterpret_cast<double *>(buf + thr_offset);
+        double *m2 = mean + oc_;
+        stats_t stats {thr_count[0], mean, m2};
+        for (int ithr = 1; ithr < nthr; ithr++) {
+            if (thr_count[ithr] == 0) continue;
+            const double *thr_mean = reinterpret_cast<const double *>(
+                    buf + thr_offset + ithr * thr_size);
+            stats.merge(thr_count[ithr], thr_mean, thr_mean + oc_, oc_);
+        }
+        for (dim_t i = 0; i < oc_; i++) {
+            batch_mean[i] = static_cast<float>(mean[i]);
+            batch_var[i] = static_cast<float>(m2[i] / stats.n);
+        }
+    }
+
+    // Running statistics, as computed by the batch normalization op.
+    const auto update = [&](int out_idx, size_t in_idx, const float *batch) {
+        if (out_idx < 0) return;
+        const float *old
+                = static_cast<const float *>(inputs[in_idx].get_data_handle());
+        float *running
+                = static_cast<float *>(outputs[out_idx].get_data_handle());
+        for (dim_t i = 0; i < oc_; i++)
+            running[i] = momentum_ * old[i] + (1.f - momentum_) * batch[i];
+    };
+    update(running_mean_idx_, mean_idx_, batch_mean);
+    update(running_var_idx_, var_idx_, batch_var);
+
+    // Normalization, which reads the convolution output only once.
+    memory mean_mem(stat_md_, p_engine_, batch_mean);
+    memory var_mem(stat_md_, p_engine_, batch_var);
+    const memory::desc bnorm_scratchpad_md(
+            {static_cast<dim_t>(bnorm_scratchpad_size_)},
+            memory::data_type::u8, memory::format_tag::a);
+    std::unordered_map<int, memory> args {
+            {DNNL_ARG_SRC, memory(data_md_, p_engine_, conv_dst)},
+            {DNNL_ARG_DST,
+                    memory(data_md_, p_engine_,
+                            outputs[dst_idx_].get_data_handle())},
+            {DNNL_ARG_MEAN, mean_mem}, {DNNL_ARG_VARIANCE, var_mem},
+            {DNNL_ARG_SCRATCHPAD,
+                    memory(bnorm_scratchpad_md, p_engine_,
+                            buf + bnorm_scratchpad_offset)}};
+    if (scale_idx_ >= 0) {
+        args.insert({DNNL_ARG_SCALE,
+                memory(stat_md_, p_engine_,
+                        inputs[scale_idx_].get_data_handle())});
+        args.insert({DNNL_ARG_SHIFT,
+                memory(stat_md_, p_engine_,
+                        inputs[shift_idx_].get_data_handle())});
+    }
+    bnorm_.execute(strm, args);
+    return status::success;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,168 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_CONV_BNORM_DECOMP_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_CONV_BNORM_DECOMP_HPP
+
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "graph/backend/dnnl/kernels/kernel_base.hpp"
+
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+#include "graph/backend/dnnl/scratchpad.hpp"
+#include "graph/backend/dnnl/subgraph.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Convolution followed by a training batch normalization (and an optional
+// ReLU), decomposed into bands of convolution output rows.
+//
+// Each thread computes a band of rows of one image and accumulates the
+// per-channel statistics of the band while it is still in cache, so the
+// batch normalization only has to read the convolution output once to apply
+// the normalization instead of also reading it to compute the statistics.
+// Bands are processed by single-threaded convolution primitives created for
+// each distinct band shape.
+struct conv_bnorm_decomp_kernel_t : public kernel_base_t {
+private:
+    allocator_t *g_alloc_ = nullptr;
+    std::shared_ptr<subgraph_t> subgraph_;
+
+    int nthr_ = 1;
+
+    // Shapes in NHWC order.
+    dim_t mb_ = 0, ic_ = 0, ih_ = 0, iw_ = 0;
+    dim_t oc_ = 0, oh_ = 0, ow_ = 0;
+    // Convolution geometry along the height. The kernel extent includes
+    // dilations.
+    dim_t conv_kh_ = 0, conv_sh_ = 0, conv_pt_ = 0;
+
+    // Positions of the partition inputs.
+    size_t src_idx_ = 0, wei_idx_ = 0, mean_idx_ = 0, var_idx_ = 0;
+    int bias_idx_ = -1, scale_idx_ = -1, shift_idx_ = -1;
+    // Positions of the partition outputs. The convolution output is only an
+    // output of the partition when it is also used outside of it (e.g. by the
+    // backward pass); otherwise the normalization is applied in place.
+    size_t dst_idx_ = 0;
+    int conv_dst_idx_ = -1, running_mean_idx_ = -1, running_var_idx_ = -1,
+        batch_mean_idx_ = -1, batch_var_idx_ = -1;
+
+    float epsilon_ = 0.f, momentum_ = 0.5f;
+
+    // A convolution over a contiguous range of output rows.
+    struct conv_band_t {
+        dnnl::primitive prim;
+        memory::desc src_md, dst_md;
+        // Index of the weights layout used by the primitive.
+        size_t wei_layout = 0;
+    };
+
+    // Work of the output rows [oh_beg, oh_end) of an image, which read the
+    // source rows starting from `ih_beg`.
+    struct band_t {
+        dim_t oh_beg, oh_end, ih_beg;
+        int conv;
+    };
+
+    std::vector<conv_band_t> convs_;
+    std::vector<band_t> bands_;
+
+    // Reorders of the user weights to each layout used by convolutions.
+    memory::desc user_wei_md_;
+    std::vector<memory::desc> wei_mds_;
+    std::vector<dnnl::reorder> wei_reorders_;
+    memory::desc bias_md_;
+
+    // Normalization of the whole convolution output with the computed
+    // statistics.
+    dnnl::primitive bnorm_;
+    memory::desc data_md_, stat_md_;
+
+    size_t conv_scratchpad_size_ = 0;
+    size_t bnorm_scratchpad_size_ = 0;
+
+    // Parameters of the convolutions shared by every band.
+    dnnl::primitive_attr conv_attr_;
+    memory::dims wei_dims_, conv_strides_, conv_dilates_;
+    dim_t conv_pl_ = 0, conv_pr_ = 0;
+
+    using band_key_t = std::tuple<dim_t, dim_t, dim_t, dim_t>;
+    std::map<band_key_t, int> conv_cache_;
+
+    status_t init_bands();
+    // Returns the convolution computing the output rows [oh_beg, oh_end)
+    // and the first source row it reads.
+    status_t get_conv(dim_t oh_beg, dim_t oh_end, int &conv, dim_t &ih_beg);
+
+public:
+    status_t compile_impl(const dnnl_partition_impl_t *part,
+            const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) override;
+
+    status_t execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override;
+
+#ifdef DNNL_WITH_SYCL
+    status_t sycl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(sycl_deps);
+        UNUSED(sycl_event);
+        return status::unimplemented;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    status_t ocl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<cl_event> &cl_deps,
+            cl_event *ret_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(cl_deps);
+        UNUSED(ret_event);
+        return status::unimplemented;
+    }
+#endif
+
+    DEF_KERNEL_METHOD_STR(conv_bnorm_decomp_kernel_t)
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
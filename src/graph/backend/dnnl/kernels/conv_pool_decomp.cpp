@@ -0,0 +1,609 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <unordered_map>
+
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+#include "cpu/platform.hpp"
+
+#include "graph/backend/dnnl/kernels/conv_pool_decomp.hpp"
+
+#include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/dnnl_constant_tensor_cache.hpp"
+#include "graph/backend/dnnl/fusion_info.hpp"
+#include "graph/backend/dnnl/passes/lower.hpp"
+#include "graph/backend/dnnl/passes/transform.hpp"
+#include "graph/backend/dnnl/passes/utils.hpp"
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+#include "cpu/cpu_stream.hpp"
+#include "oneapi/dnnl/dnnl_threadpool.h"
+#endif
+
+#define VCHECK_CONV_POOL_DECOMP(cond, status, msg, ...) \
+    VCONDCHECK(graph, create, check, conv_pool_decomp_kernel_t, (cond), \
+            status, msg, ##__VA_ARGS__);
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+using op_ptr = std::shared_ptr<op_t>;
+using ltw = logical_tensor_wrapper_t;
+
+namespace {
+// Returns true if `lt` is a 4D plain tensor with dense row-major strides.
+bool is_dense_4d(const logical_tensor_t &lt) {
+    const ltw w(lt);
+    if (w.ndims() != 4 || !w.is_strided()) return false;
+    const auto dims = w.vdims();
+    const auto strides = w.vstrides();
+    dim_t stride = 1;
+    for (int d = 3; d >= 0; d--) {
+        if (dims[d] != 1 && strides[d] != stride) return false;
+        stride *= dims[d];
+    }
+    return true;
+}
+
+template <typename T>
+T get_attr_or(const op_ptr &op, op_attr_t attr, const T &def) {
+    return op->has_attr(attr) ? op->get_attr<T>(attr) : def;
+}
+} // namespace
+
+status_t conv_pool_decomp_kernel_t::compile_impl(
+        const dnnl_partition_impl_t *part, const engine_t *g_engine,
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    VCHECK_CONV_POOL_DECOMP(g_engine->kind() == engine_kind::cpu,
+            status::unimplemented, "only cpu engine is supported");
+
+    p_engine_ = make_dnnl_engine(*g_engine);
+    g_alloc_
+            = reinterpret_cast<graph::allocator_t *>(g_engine->get_allocator());
+
+    subgraph_ = std::make_shared<subgraph_t>(
+            part->get_ops(), p_engine_, part->get_fpmath_mode(), false, true);
+    BACKEND_DNNL_CHECK(set_given_inputs_outputs(subgraph_, inputs, outputs));
+
+    subgraph_visualizer_t vis(part->id());
+    pass_pipeline_t pipeline = pass_pipeline_t(vis);
+    BACKEND_DNNL_ADD_PASS(pipeline, lower_down);
+    BACKEND_DNNL_ADD_PASS(pipeline, fuse_bias_add);
+    BACKEND_DNNL_ADD_PASS(pipeline, check_with_bias);
+    BACKEND_DNNL_ADD_PASS(pipeline, fuse_post_ops);
+    BACKEND_DNNL_CHECK(pipeline.run(subgraph_));
+
+    op_ptr conv, pool;
+    for (const auto &op : subgraph_->get_ops()) {
+        if (op->get_kind() == op_kind::dnnl_convolution && !conv)
+            conv = op;
+        else if (op->get_kind() == op_kind::dnnl_pool && !pool)
+            pool = op;
+        else
+            VCHECK_CONV_POOL_DECOMP(false, status::unimplemented,
+                    "unexpected op %s", op->get_name().c_str());
+    }
+    VCHECK_CONV_POOL_DECOMP(conv && pool
+                    && pool->get_input_value(0)->has_producer()
+                    && &pool->get_input_value(0)->get_producer() == conv.get(),
+            status::unimplemented, "expected a convolution and a pooling");
+    VCHECK_CONV_POOL_DECOMP(outputs.size() == 1, status::unimplemented,
+            "does not support multiple outputs");
+
+    // Layouts and attributes.
+    const auto conv_fmt
+            = get_attr_or<std::string>(conv, op_attr::data_format, "NXC");
+    const auto pool_fmt
+            = get_attr_or<std::string>(pool, op_attr::data_format, "NXC");
+    const auto wei_fmt
+            = get_attr_or<std::string>(conv, op_attr::weights_format, "XIO");
+    VCHECK_CONV_POOL_DECOMP(conv_fmt == "NXC" && pool_fmt == "NXC",
+            status::unimplemented, "only NXC data format is supported");
+    VCHECK_CONV_POOL_DECOMP(wei_fmt == "XIO" || wei_fmt == "OIX",
+            status::unimplemented, "unsupported weights format %s",
+            wei_fmt.c_str());
+    VCHECK_CONV_POOL_DECOMP(
+            get_attr_or<int64_t>(conv, op_attr::groups, 1) == 1,
+            status::unimplemented, "grouped convolution is not supported");
+    VCHECK_CONV_POOL_DECOMP(
+            get_attr_or<std::string>(conv, op_attr::auto_pad, "None") == "None"
+                    && get_attr_or<std::string>(
+                               pool, op_attr::auto_pad, "None")
+                            == "None",
+            status::unimplemented, "auto padding is not supported");
+    VCHECK_CONV_POOL_DECOMP(
+            get_attr_or<std::string>(pool, op_attr::rounding_type, "floor")
+                    == "floor",
+            status::unimplemented, "only floor rounding is supported");
+
+    // Post-ops of the convolution must only depend on the computed element.
+    auto &mgr = subgraph_->fusion_info_mgr_;
+    if (conv->has_attr(op_attr::fusion_info_key)
+            && conv->get_attr<int64_t>(op_attr::fusion_info_key) != -1) {
+        const auto key = conv->get_attr<int64_t>(op_attr::fusion_info_key);
+        conv_attr_ = make_dnnl_primitive_attr(conv, mgr.get_info(key));
+    }
+    const auto post_ops = conv_attr_.get_post_ops();
+    for (int i = 0; i < post_ops.len(); i++)
+        VCHECK_CONV_POOL_DECOMP(
+                post_ops.kind(i) == dnnl::primitive::kind::eltwise,
+                status::unimplemented, "only eltwise post-ops are supported");
+    conv_attr_.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+    const auto fpmath = mgr.get_fpmath_mode();
+    conv_attr_.set_fpmath_mode(
+            static_cast<dnnl::fpmath_mode>(fpmath.mode_), fpmath.apply_to_int_);
+
+    // Partition inputs feeding the convolution.
+    const bool with_bias = conv->has_attr(op_attr::with_bias)
+            && conv->get_attr<bool>(op_attr::with_bias);
+    const auto find_input = [&](size_t offset, size_t &idx) {
+        const auto id
+                = conv->get_input_value(offset)->get_logical_tensor().id;
+        for (idx = 0; idx < inputs.size(); idx++)
+            if (inputs[idx].id == id) return true;
+        return false;
+    };
+    VCHECK_CONV_POOL_DECOMP(
+            find_input(0, src_idx_) && find_input(1, wei_idx_),
+            status::unimplemented, "convolution inputs are not given");
+    if (with_bias) {
+        size_t idx = 0;
+        VCHECK_CONV_POOL_DECOMP(find_input(2, idx), status::unimplemented,
+                "convolution bias is not given");
+        bias_idx_ = static_cast<int>(idx);
+    }
+
+    const auto &src_lt = inputs[src_idx_];
+    const auto &wei_lt = inputs[wei_idx_];
+    VCHECK_CONV_POOL_DECOMP(is_dense_4d(src_lt), status::unimplemented,
+            "only dense 4D source is supported");
+    VCHECK_CONV_POOL_DECOMP(
+            ltw(wei_lt).ndims() == 4 && ltw(wei_lt).is_strided(),
+            status::unimplemented, "only plain 4D weights are supported");
+
+    // Geometry.
+    const auto src_dims = ltw(src_lt).vdims();
+    const auto wei_dims = ltw(wei_lt).vdims();
+    const auto wei_strides = ltw(wei_lt).vstrides();
+    mb_ = src_dims[0];
+    ih_ = src_dims[1];
+    iw_ = src_dims[2];
+    ic_ = src_dims[3];
+    const bool is_xio = wei_fmt == "XIO";
+    // Weights in the {OC, IC, KH, KW} order of the primitives.
+    const std::vector<int> wei_perm = is_xio
+            ? std::vector<int> {3, 2, 0, 1}
+            : std::vector<int> {0, 1, 2, 3};
+    memory::dims user_wei_strides(4);
+    wei_dims_.resize(4);
+    for (int d = 0; d < 4; d++) {
+        wei_dims_[d] = wei_dims[wei_perm[d]];
+        user_wei_strides[d] = wei_strides[wei_perm[d]];
+    }
+    oc_ = wei_dims_[0];
+    VCHECK_CONV_POOL_DECOMP(wei_dims_[1] == ic_, status::unimplemented,
+            "channels mismatch between source and weights");
+
+    conv_strides_ = conv->get_attr<dims>(op_attr::strides);
+    conv_dilates_ = get_compatible_dilates(
+            conv->get_attr<dims>(op_attr::dilations));
+    const auto conv_pads_l = conv->get_attr<dims>(op_attr::pads_begin);
+    const auto conv_pads_r = conv->get_attr<dims>(op_attr::pads_end);
+    pool_strides_ = pool->get_attr<dims>(op_attr::strides);
+    pool_kernel_ = pool->get_attr<dims>(op_attr::kernel);
+    pool_dilates_ = get_compatible_dilates(
+            get_attr_or<dims>(pool, op_attr::dilations, dims(2, 1)));
+    const auto pool_pads_l = pool->get_attr<dims>(op_attr::pads_begin);
+    const auto pool_pads_r = pool->get_attr<dims>(op_attr::pads_end);
+    VCHECK_CONV_POOL_DECOMP(conv_strides_.size() == 2
+                    && conv_dilates_.size() == 2 && conv_pads_l.size() == 2
+                    && conv_pads_r.size() == 2 && pool_strides_.size() == 2
+                    && pool_kernel_.size() == 2 && pool_dilates_.size() == 2
+                    && pool_pads_l.size() == 2 && pool_pads_r.size() == 2,
+            status::unimplemented, "only 2D convolution and pooling");
+
+    const dim_t conv_kw = (wei_dims_[3] - 1) * (conv_dilates_[1] + 1) + 1;
+    const dim_t pool_kw = (pool_kernel_[1] - 1) * (pool_dilates_[1] + 1) + 1;
+    conv_kh_ = (wei_dims_[2] - 1) * (conv_dilates_[0] + 1) + 1;
+    conv_sh_ = conv_strides_[0];
+    conv_pt_ = conv_pads_l[0];
+    pool_kh_ = (pool_kernel_[0] - 1) * (pool_dilates_[0] + 1) + 1;
+    pool_sh_ = pool_strides_[0];
+    pool_pt_ = pool_pads_l[0];
+    conv_pl_ = conv_pads_l[1];
+    conv_pr_ = conv_pads_r[1];
+    pool_pl_ = pool_pads_l[1];
+    pool_pr_ = pool_pads_r[1];
+
+    // Every band must read at least one source row and every pooling window
+    // must cover at least one convolution row.
+    VCHECK_CONV_POOL_DECOMP(conv_pt_ < conv_kh_ && conv_pads_r[0] < conv_kh_
+                    && pool_pt_ < pool_kh_ && pool_pads_r[0] < pool_kh_,
+            status::unimplemented, "padding exceeds the kernel extent");
+
+    oh_ = (ih_ + conv_pt_ + conv_pads_r[0] - conv_kh_) / conv_sh_ + 1;
+    ow_ = (iw_ + conv_pl_ + conv_pr_ - conv_kw) / conv_strides_[1] + 1;
+    ph_ = (oh_ + pool_pt_ + pool_pads_r[0] - pool_kh_) / pool_sh_ + 1;
+    pw_ = (ow_ + pool_pl_ + pool_pr_ - pool_kw) / pool_strides_[1] + 1;
+    VCHECK_CONV_POOL_DECOMP(oh_ > 0 && ow_ > 0 && ph_ > 0 && pw_ > 0,
+            status::unimplemented, "empty output");
+
+    // Destination must be a dense NHWC tensor.
+    // The given output is only updated once the kernel is known to be
+    // supported, so that the fallback kernel sees it unchanged.
+    logical_tensor_t dst_lt = outputs[0];
+    const dims expected_dst_dims {mb_, ph_, pw_, oc_};
+    if (ltw(dst_lt).is_any()) {
+        dst_lt.ndims = 4;
+        for (int d = 0; d < 4; d++)
+            dst_lt.dims[d] = expected_dst_dims[d];
+        dst_lt.layout_type = layout_type::strided;
+        dst_lt.layout.strides[3] = 1;
+        for (int d = 2; d >= 0; d--)
+            dst_lt.layout.strides[d]
+                    = dst_lt.layout.strides[d + 1] * dst_lt.dims[d + 1];
+    }
+    VCHECK_CONV_POOL_DECOMP(
+            is_dense_4d(dst_lt) && ltw(dst_lt).vdims() == expected_dst_dims,
+            status::unimplemented, "only dense NHWC destination is supported");
+    if (bias_idx_ >= 0) {
+        const ltw bias(inputs[bias_idx_]);
+        VCHECK_CONV_POOL_DECOMP(bias.ndims() == 1 && bias.is_strided()
+                        && bias.vdims()[0] == oc_
+                        && bias.vstrides()[0] == 1,
+                status::unimplemented, "only dense bias is supported");
+        bias_md_ = memory::desc({oc_},
+                static_cast<memory::data_type>(bias.data_type()),
+                memory::format_tag::a);
+    }
+
+    src_dt_ = static_cast<memory::data_type>(ltw(src_lt).data_type());
+    wei_dt_ = static_cast<memory::data_type>(ltw(wei_lt).data_type());
+    inter_dt_ = static_cast<memory::data_type>(
+            ltw(conv->get_output_value(0)->get_logical_tensor()).data_type());
+    dst_dt_ = static_cast<memory::data_type>(ltw(dst_lt).data_type());
+    src_dt_size_ = memory::data_type_size(src_dt_);
+    inter_dt_size_ = memory::data_type_size(inter_dt_);
+    dst_dt_size_ = memory::data_type_size(dst_dt_);
+    user_wei_md_ = memory::desc(wei_dims_, wei_dt_, user_wei_strides);
+
+    if (pool->get_attr<std::string>(op_attr::kind) == "maxpool")
+        pool_alg_ = algorithm::pooling_max;
+    else if (get_attr_or<bool>(pool, op_attr::exclude_pad, false))
+        pool_alg_ = algorithm::pooling_avg_exclude_padding;
+    else
+        pool_alg_ = algorithm::pooling_avg_include_padding;
+
+    // Bands are distributed over threads, so the decomposition only pays off
+    // when there are enough of them.
+    nthr_ = dnnl_get_current_num_threads();
+    VCHECK_CONV_POOL_DECOMP(mb_ * ph_ >= nthr_, status::unimplemented,
+            "not enough pooled rows for %d threads: batch %ld, rows %ld",
+            nthr_, static_cast<long int>(mb_), static_cast<long int>(ph_));
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    // Primitives are executed inside of a parallel region, so they are
+    // created for a single thread.
+    omp_set_num_threads(1);
+#endif
+    const status_t st = init_bands();
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    omp_set_num_threads(nthr_);
+#endif
+    CHECK(st);
+
+    cache_wei_ = ltw(wei_lt).is_constant() && enabled_constant_cache();
+    if (cache_wei_)
+        const_md_hash_ = generate_constant_md_hash(
+                get_constant_subgraph_key(part->id(), subgraph_), wei_mds_);
+
+    const_cast<logical_tensor_t &>(outputs[0]) = dst_lt;
+    return status::success;
+}
+
+status_t conv_pool_decomp_kernel_t::init_bands() {
+    const size_t row_size = ow_ * oc_ * inter_dt_size_;
+
+    // The rows of a band should stay in the private L2 cache of a core
+    // together with the source rows and the weights, so only half of it is
+    // given to the row buffer.
+    const size_t cache_size
+            = cpu::platform::get_per_core_cache_size(2) / 2;
+    const dim_t budget_rows = static_cast<dim_t>(cache_size / row_size);
+    dim_t band = 1;
+    if (budget_rows > pool_kh_) band = (budget_rows - pool_kh_) / pool_sh_ + 1;
+    // Keep enough bands to occupy all threads.
+    band = std::min(
+            band, dnnl::impl::utils::div_up(
+                    ph_, dnnl::impl::utils::div_up<dim_t>(nthr_, mb_)));
+    band = std::max<dim_t>(1, band);
+
+    for (dim_t ph_beg = 0; ph_beg < ph_; ph_beg += band) {
+        band_t b;
+        b.ph_beg = ph_beg;
+        b.ph_end = std::min(ph_, ph_beg + band);
+        // Convolution rows covered by the pooling windows, padding included.
+        const dim_t win_beg = b.ph_beg * pool_sh_ - pool_pt_;
+        const dim_t win_end = (b.ph_end - 1) * pool_sh_ - pool_pt_ + pool_kh_;
+        b.oh_beg = std::max<dim_t>(0, win_beg);
+        b.oh_end = std::min(oh_, win_end);
+        CHECK(get_conv(b.oh_beg, b.oh_end, b.conv, b.ih_beg));
+
+        b.carry_oh_beg = bands_.empty()
+                ? b.oh_beg
+                : std::max(b.oh_beg, bands_.back().oh_end);
+        b.carry_conv = -1;
+        b.carry_ih_beg = 0;
+        if (b.carry_oh_beg < b.oh_end)
+            CHECK(get_conv(
+                    b.carry_oh_beg, b.oh_end, b.carry_conv, b.carry_ih_beg));
+
+        CHECK(get_pool(b.oh_end - b.oh_beg, b.oh_beg - win_beg,
+                win_end - b.oh_end, b.ph_end - b.ph_beg, b.pool));
+        row_buf_size_ = std::max(row_buf_size_,
+                static_cast<size_t>(b.oh_end - b.oh_beg) * row_size);
+        bands_.push_back(b);
+    }
+    return status::success;
+}
+
+status_t conv_pool_decomp_kernel_t::get_conv(
+        dim_t oh_beg, dim_t oh_end, int &conv, dim_t &ih_beg) {
+    const dim_t in_beg = oh_beg * conv_sh_ - conv_pt_;
+    const dim_t in_end = (oh_end - 1) * conv_sh_ - conv_pt_ + conv_kh_;
+    ih_beg = std::max<dim_t>(0, in_beg);
+    const dim_t ih_end = std::min(ih_, in_end);
+    const dim_t pad_t = ih_beg - in_beg;
+    const dim_t pad_b = in_end - ih_end;
+
+    const band_key_t key {ih_end - ih_beg, pad_t, pad_b, oh_end - oh_beg};
+    const auto it = conv_cache_.find(key);
+    if (it != conv_cache_.end()) {
+        conv = it->second;
+        return status::success;
+    }
+
+    using tag = memory::format_tag;
+    conv_band_t c;
+    c.src_md = memory::desc({1, ic_, ih_end - ih_beg, iw_}, src_dt_, tag::nhwc);
+    c.dst_md = memory::desc(
+            {1, oc_, oh_end - oh_beg, ow_}, inter_dt_, tag::nhwc);
+    const memory::desc wei_md(wei_dims_, wei_dt_, tag::any);
+    const dims pads_l {pad_t, conv_pl_}, pads_r {pad_b, conv_pr_};
+
+    convolution_forward::primitive_desc pd;
+    if (bias_idx_ >= 0)
+        pd = convolution_forward::primitive_desc(p_engine_,
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                c.src_md, wei_md, bias_md_, c.dst_md, conv_strides_,
+                conv_dilates_, pads_l, pads_r, conv_attr_, true);
+    else
+        pd = convolution_forward::primitive_desc(p_engine_,
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                c.src_md, wei_md, c.dst_md, conv_strides_, conv_dilates_,
+                pads_l, pads_r, conv_attr_, true);
+    VCHECK_CONV_POOL_DECOMP(pd, status::unimplemented,
+            "failed to create a convolution for %ld rows",
+            static_cast<long int>(oh_end - oh_beg));
+
+    // Bands share the weights layouts.
+    const auto &wei_layout = pd.weights_desc();
+    const auto wei_it = std::find(wei_mds_.begin(), wei_mds_.end(), wei_layout);
+    c.wei_layout = wei_it - wei_mds_.begin();
+    if (wei_it == wei_mds_.end()) {
+        auto reorder_pd = reorder::primitive_desc(p_engine_, user_wei_md_,
+                p_engine_, wei_layout, primitive_attr(), true);
+        VCHECK_CONV_POOL_DECOMP(reorder_pd, status::unimplemented,
+                "failed to create a weights reorder");
+        wei_mds_.push_back(wei_layout);
+        wei_reorders_.emplace_back(reorder_pd);
+    }
+
+    scratchpad_size_
+            = std::max(scratchpad_size_, pd.scratchpad_desc().get_size());
+    c.prim = convolution_forward(pd);
+    conv = static_cast<int>(convs_.size());
+    convs_.push_back(c);
+    conv_cache_.emplace(key, conv);
+    return status::success;
+}
+
+status_t conv_pool_decomp_kernel_t::get_pool(
+        dim_t rows, dim_t pad_t, dim_t pad_b, dim_t n_rows, int &pool) {
+    const band_key_t key {rows, pad_t, pad_b, n_rows};
+    const auto it = pool_cache_.find(key);
+    if (it != pool_cache_.end()) {
+        pool = it->second;
+        return status::success;
+    }
+
+    using tag = memory::format_tag;
+    pool_band_t p;
+    p.src_md = memory::desc({1, oc_, rows, ow_}, inter_dt_, tag::nhwc);
+    p.dst_md = memory::desc({1, oc_, n_rows, pw_}, dst_dt_, tag::nhwc);
+    const dims pads_l {pad_t, pool_pl_}, pads_r {pad_b, pool_pr_};
+
+    dnnl::primitive_attr attr;
+    attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+    auto pd = pooling_forward::primitive_desc(p_engine_,
+            prop_kind::forward_inference, pool_alg_, p.src_md, p.dst_md,
+            pool_strides_, pool_kernel_, pool_dilates_, pads_l, pads_r, attr,
+            true);
+    VCHECK_CONV_POOL_DECOMP(pd, status::unimplemented,
+            "failed to create a pooling for %ld rows",
+            static_cast<long int>(n_rows));
+
+    scratchpad_size_
+            = std::max(scratchpad_size_, pd.scratchpad_desc().get_size());
+    p.prim = pooling_forward(pd);
+    pool = static_cast<int>(pools_.size());
+    pools_.push_back(p);
+    pool_cache_.emplace(key, pool);
+    return status::success;
+}
+
+status_t conv_pool_decomp_kernel_t::execute_impl(const stream_t *g_stream,
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs) {
+    dnnl::stream strm = make_dnnl_stream(p_engine_, *g_stream);
+
+    int nthr = nthr_;
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    auto *tp_stream
+            = dnnl::impl::utils::downcast<dnnl::impl::cpu::cpu_stream_t *>(
+                    const_cast<stream_t *>(g_stream));
+    tp_stream->before_exec_hook();
+    dnnl_threadpool_interop_get_max_concurrency(&nthr);
+    tp_stream->after_exec_hook();
+#endif
+
+    // The scratchpad holds the reordered weights, unless they are cached,
+    // followed by a row buffer and a primitive scratchpad for each thread.
+    constexpr size_t align = 64;
+    std::vector<size_t> wei_offsets;
+    size_t wei_size = 0;
+    for (const auto &md : wei_mds_) {
+        wei_offsets.push_back(wei_size);
+        wei_size += dnnl::impl::utils::rnd_up(md.get_size(), align);
+    }
+    const size_t tmp_wei_size = cache_wei_ ? 0 : wei_size;
+    const size_t row_buf_size = dnnl::impl::utils::rnd_up(row_buf_size_, align);
+    const size_t thr_size
+            = row_buf_size + dnnl::impl::utils::rnd_up(scratchpad_size_, align);
+    temporary_scratchpad_t scratchpad(
+            tmp_wei_size + nthr * thr_size, p_engine_, *g_alloc_);
+    assertm(scratchpad.size() >= tmp_wei_size + nthr * thr_size,
+            "no enough scratchpad memory");
+    char *buf = scratchpad.get_buffer();
+
+    // Constant weights are only reordered by the first execution, and kept
+    // in the constant tensor cache.
+    char *wei_buf = buf;
+    bool reorder_wei = true;
+    constant_tensor_cache_t::cached_t c_buffer;
+    std::promise<constant_tensor_cache_t::cached_t> c_promise;
+    if (cache_wei_) {
+        const size_t encoded_key
+                = encode_constant_cache_key(inputs, const_md_hash_);
+        constant_tensor_cache_t::value_t cached_value
+                = get_or_add_constant_cache(
+                        encoded_key, wei_size, c_promise.get_future());
+        if (cached_value.valid()) {
+            c_buffer = cached_value.get();
+            reorder_wei = false;
+        } else {
+            c_buffer = std::make_shared<dnnl_constant_buffer_t>(
+                    wei_size, p_engine_, g_alloc_);
+        }
+        wei_buf = c_buffer->data<char>();
+    }
+
+    memory user_wei(
+            user_wei_md_, p_engine_, inputs[wei_idx_].get_data_handle());
+    std::vector<memory> weis;
+    for (size_t i = 0; i < wei_mds_.size(); i++) {
+        weis.emplace_back(wei_mds_[i], p_engine_, wei_buf + wei_offsets[i]);
+        if (reorder_wei) wei_reorders_[i].execute(strm, user_wei, weis[i]);
+    }
+    if (cache_wei_ && reorder_wei) c_promise.set_value(c_buffer);
+    memory bias;
+    if (bias_idx_ >= 0)
+        bias = memory(
+                bias_md_, p_engine_, inputs[bias_idx_].get_data_handle());
+
+    const char *src = static_cast<const char *>(
+            inputs[src_idx_].get_data_handle());
+    char *dst = static_cast<char *>(outputs[0].get_data_handle());
+    const size_t row_size = ow_ * oc_ * inter_dt_size_;
+    const dim_t n_bands = static_cast<dim_t>(bands_.size());
+    const memory::desc scratchpad_md({static_cast<dim_t>(scratchpad_size_)},
+            memory::data_type::u8, memory::format_tag::a);
+
+    const auto loop = [&](int ithr, int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(mb_ * n_bands, nthr, ithr, start, end);
+        if (start == end) return;
+
+        char *row_buf = buf + tmp_wei_size + ithr * thr_size;
+        memory scratchpad_mem(scratchpad_md, p_engine_, row_buf + row_buf_size);
+
+        for (dim_t t = start; t < end; t++) {
+            const dim_t n = t / n_bands, b = t % n_bands;
+            const auto &band = bands_[b];
+
+            int conv = band.conv;
+            dim_t oh_beg = band.oh_beg, ih_beg = band.ih_beg;
+            // The previous band of the image was computed by this thread:
+            // keep the rows it shares with this band.
+            if (t > start && b > 0) {
+                const auto &prev = bands_[b - 1];
+                if (prev.oh_end > band.oh_beg)
+                    std::memmove(row_buf,
+                            row_buf + (band.oh_beg - prev.oh_beg) * row_size,
+                            (prev.oh_end - band.oh_beg) * row_size);
+                conv = band.carry_conv;
+                oh_beg = band.carry_oh_beg;
+                ih_beg = band.carry_ih_beg;
+            }
+
+            if (conv >= 0) {
+                const auto &c = convs_[conv];
+                memory conv_src(c.src_md, p_engine_,
+                        const_cast<char *>(src)
+                                + (n * ih_ + ih_beg) * iw_ * ic_
+                                        * src_dt_size_);
+                memory conv_dst(c.dst_md, p_engine_,
+                        row_buf + (oh_beg - band.oh_beg) * row_size);
+                std::unordered_map<int, memory> args {
+                        {DNNL_ARG_SRC, conv_src},
+                        {DNNL_ARG_WEIGHTS, weis[c.wei_layout]},
+                        {DNNL_ARG_DST, conv_dst},
+                        {DNNL_ARG_SCRATCHPAD, scratchpad_mem}};
+                if (bias_idx_ >= 0) args.insert({DNNL_ARG_BIAS, bias});
+                c.prim.execute(strm, args);
+            }
+
+            const auto &p = pools_[band.pool];
+            memory pool_src(p.src_md, p_engine_, row_buf);
+            memory pool_dst(p.dst_md, p_engine_,
+                    dst + (n * ph_ + band.ph_beg) * pw_ * oc_ * dst_dt_size_);
+            p.prim.execute(strm,
+                    {{DNNL_ARG_SRC, pool_src}, {DNNL_ARG_DST, pool_dst},
+                            {DNNL_ARG_SCRATCHPAD, scratchpad_mem}});
+        }
+    };
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    tp_stream->before_exec_hook();
+#endif
+    parallel(nthr, loop);
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    tp_stream->after_exec_hook();
+#endif
+    return status::success;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
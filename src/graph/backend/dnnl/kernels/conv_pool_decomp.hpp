@@ -0,0 +1,186 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_CONV_POOL_DECOMP_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_CONV_POOL_DECOMP_HPP
+
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "graph/backend/dnnl/kernels/kernel_base.hpp"
+
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+#include "graph/backend/dnnl/scratchpad.hpp"
+#include "graph/backend/dnnl/subgraph.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Convolution (with eltwise post-ops) followed by pooling, decomposed into
+// bands of pooled output rows.
+//
+// Each thread computes the convolution rows needed by a band of pooled rows
+// of one image into a private row buffer and pools them right away, so the
+// pre-pooling activation stays in cache and is never written to memory.
+// When a thread handles consecutive bands of an image, the rows shared by
+// overlapping pooling windows are moved to the front of the row buffer
+// instead of being recomputed. Bands are processed by single-threaded
+// convolution and pooling primitives created for each distinct band shape.
+struct conv_pool_decomp_kernel_t : public kernel_base_t {
+private:
+    allocator_t *g_alloc_ = nullptr;
+    std::shared_ptr<subgraph_t> subgraph_;
+
+    int nthr_ = 1;
+
+    // Shapes in NHWC order.
+    dim_t mb_ = 0, ic_ = 0, ih_ = 0, iw_ = 0;
+    dim_t oc_ = 0, oh_ = 0, ow_ = 0;
+    dim_t ph_ = 0, pw_ = 0;
+    // Convolution and pooling geometry along the height. Kernel extents
+    // include dilations.
+    dim_t conv_kh_ = 0, conv_sh_ = 0, conv_pt_ = 0;
+    dim_t pool_kh_ = 0, pool_sh_ = 0, pool_pt_ = 0;
+
+    // Element sizes of the source, the convolution output and the
+    // destination.
+    size_t src_dt_size_ = 0, inter_dt_size_ = 0, dst_dt_size_ = 0;
+
+    // Positions of the partition inputs.
+    size_t src_idx_ = 0, wei_idx_ = 0;
+    int bias_idx_ = -1;
+
+    // A convolution over a contiguous range of output rows.
+    struct conv_band_t {
+        dnnl::primitive prim;
+        memory::desc src_md, dst_md;
+        // Index of the weights layout used by the primitive.
+        size_t wei_layout = 0;
+    };
+    // A pooling over the convolution rows held in a row buffer.
+    struct pool_band_t {
+        dnnl::primitive prim;
+        memory::desc src_md, dst_md;
+    };
+
+    // Work of a band of pooled rows [ph_beg, ph_end), which needs the
+    // convolution rows [oh_beg, oh_end).
+    struct band_t {
+        dim_t ph_beg, ph_end, oh_beg, oh_end;
+        // Convolution computing all rows of the band, starting from the
+        // source row `ih_beg`.
+        int conv;
+        dim_t ih_beg;
+        // Convolution computing only the rows not computed by the previous
+        // band, starting from the output row `carry_oh_beg` and source row
+        // `carry_ih_beg`. It is -1 when all rows are already computed.
+        int carry_conv;
+        dim_t carry_oh_beg, carry_ih_beg;
+        int pool;
+    };
+
+    std::vector<conv_band_t> convs_;
+    std::vector<pool_band_t> pools_;
+    std::vector<band_t> bands_;
+
+    // Reorders of the user weights to each layout used by convolutions.
+    memory::desc user_wei_md_;
+    std::vector<memory::desc> wei_mds_;
+    std::vector<dnnl::reorder> wei_reorders_;
+    memory::desc bias_md_;
+    // Constant weights are reordered once and kept in the constant tensor
+    // cache under this hash.
+    bool cache_wei_ = false;
+    size_t const_md_hash_ = 0;
+
+    size_t row_buf_size_ = 0;
+    size_t scratchpad_size_ = 0;
+
+    // Parameters of the primitives shared by every band.
+    dnnl::primitive_attr conv_attr_;
+    memory::data_type src_dt_, wei_dt_, inter_dt_, dst_dt_;
+    memory::dims wei_dims_, conv_strides_, conv_dilates_;
+    dim_t conv_pl_ = 0, conv_pr_ = 0;
+    memory::dims pool_strides_, pool_kernel_, pool_dilates_;
+    dim_t pool_pl_ = 0, pool_pr_ = 0;
+    dnnl::algorithm pool_alg_ = dnnl::algorithm::undef;
+
+    using band_key_t = std::tuple<dim_t, dim_t, dim_t, dim_t>;
+    std::map<band_key_t, int> conv_cache_, pool_cache_;
+
+    status_t init_bands();
+    // Returns the convolution computing the output rows [oh_beg, oh_end)
+    // and the first source row it reads.
+    status_t get_conv(dim_t oh_beg, dim_t oh_end, int &conv, dim_t &ih_beg);
+    status_t get_pool(dim_t rows, dim_t pad_t, dim_t pad_b, dim_t n_rows,
+            int &pool);
+
+public:
+    status_t compile_impl(const dnnl_partition_impl_t *part,
+            const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) override;
+
+    status_t execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override;
+
+#ifdef DNNL_WITH_SYCL
+    status_t sycl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(sycl_deps);
+        UNUSED(sycl_event);
+        return status::unimplemented;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    status_t ocl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<cl_event> &cl_deps,
+            cl_event *ret_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(cl_deps);
+        UNUSED(ret_event);
+        return status::unimplemented;
+    }
+#endif
+
+    DEF_KERNEL_METHOD_STR(conv_pool_decomp_kernel_t)
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -91,7 +91,8 @@ status_t eltwise_fwd_t<quantized>::compile_impl(
         return this->memory_planner_.get_exec_args_set().clone();
     };
 
-    const_md_hash_ = generate_constant_md_hash(part->id(),
+    const_md_hash_ = generate_constant_md_hash(
+            get_constant_subgraph_key(part->id(), subgraph_),
             memory_planner_.get_exec_args_set().get_persistent_mem_desc_list());
 
     return status::success;
@@ -142,7 +143,7 @@ status_t eltwise_fwd_t<quantized>::execute_impl(const stream_t *g_stream,
                 = encode_constant_cache_key(inputs, const_md_hash_);
         std::promise<constant_tensor_cache_t::cached_t> c_promise;
         constant_tensor_cache_t::value_t cached_value
-                = dnnl_constant_cache_get_or_add(p_engine_, encoded_key,
+                = get_or_add_constant_cache(encoded_key,
                         memory_planner_.total_internal_persistent_size(),
                         c_promise.get_future());
         bool is_from_cache = cached_value.valid();
@@ -214,7 +215,7 @@ status_t eltwise_fwd_t<quantized>::sycl_execute_impl(const stream_t *g_stream,
                 = encode_constant_cache_key(inputs, const_md_hash_);
         std::promise<constant_tensor_cache_t::cached_t> c_promise;
         constant_tensor_cache_t::value_t cached_value
-                = dnnl_constant_cache_get_or_add(p_engine_, encoded_key,
+                = get_or_add_constant_cache(encoded_key,
                         memory_planner_.total_internal_persistent_size(),
                         c_promise.get_future());
         bool is_from_cache = cached_value.valid();
@@ -292,7 +293,7 @@ status_t eltwise_fwd_t<quantized>::ocl_execute_impl(const stream_t *g_stream,
                 = encode_constant_cache_key(inputs, const_md_hash_);
         std::promise<constant_tensor_cache_t::cached_t> c_promise;
         constant_tensor_cache_t::value_t cached_value
-                = dnnl_constant_cache_get_or_add(p_engine_, encoded_key,
+                = get_or_add_constant_cache(encoded_key,
                         memory_planner_.total_internal_persistent_size(),
                         c_promise.get_future());
         bool is_from_cache = cached_value.valid();
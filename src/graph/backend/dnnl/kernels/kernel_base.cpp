@@ -22,6 +22,14 @@ namespace impl {
 namespace graph {
 namespace dnnl_impl {
 
+kernel_base_t::~kernel_base_t() {
+    constant_tensor_cache_t *cache = constant_cache_.load();
+    if (cache) {
+        cache->remove_requester(this);
+        cache->release();
+    }
+}
+
 status_t kernel_base_t::compile(const dnnl_partition_impl_t *part,
         const engine_t *aengine, const std::vector<logical_tensor_t> &inputs,
         const std::vector<logical_tensor_t> &outputs) {
@@ -45,10 +53,13 @@ bool kernel_base_t::enabled_constant_cache() const {
 
 size_t kernel_base_t::encode_constant_cache_key(
         const std::vector<tensor_t> &inputs, size_t cache_key) const {
-    // Encode the constant memory address into cache key for differentiation
+    // Encode the constant memory address and its input index into cache key
+    // for differentiation
     size_t encoded_cache_key = cache_key;
-    for (const auto &in : inputs) {
+    for (size_t i = 0; i < inputs.size(); i++) {
+        const auto &in = inputs[i];
         if (logical_tensor_wrapper_t(in.get_logical_tensor()).is_constant()) {
+            encoded_cache_key = hash_combine(encoded_cache_key, i);
             encoded_cache_key = hash_combine(encoded_cache_key,
                     reinterpret_cast<uintptr_t>(in.get_data_handle()));
         }
@@ -56,6 +67,19 @@ size_t kernel_base_t::encode_constant_cache_key(
     return encoded_cache_key;
 }
 
+constant_tensor_cache_t::value_t kernel_base_t::get_or_add_constant_cache(
+        size_t key, size_t size,
+        const constant_tensor_cache_t::value_t &value) {
+    constant_tensor_cache_t *cache = get_constant_tensor_cache(
+            p_engine_.get()->kind(), p_engine_.get()->index());
+    constant_tensor_cache_t *expected = nullptr;
+    if (cache && constant_cache_.compare_exchange_strong(expected, cache))
+        cache->retain();
+    assertm(!cache || constant_cache_.load() == cache,
+            "a kernel requests tensors from a single constant cache");
+    return dnnl_constant_cache_get_or_add(p_engine_, key, size, value, this);
+}
+
 const std::vector<inplace_pair_t> &kernel_base_t::get_inplace_pairs() const {
     return inplace_pairs_;
 };
@@ -18,10 +18,12 @@
 #define GRAPH_BACKEND_DNNL_KERNELS_KERNEL_BASE_HPP
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <vector>
 
 #include "graph/interface/c_types_map.hpp"
+#include "graph/interface/constant_tensor_cache.hpp"
 #include "graph/interface/logical_tensor.hpp"
 
 // required for dnnl::engine
@@ -39,7 +41,7 @@ namespace dnnl_impl {
 class dnnl_partition_impl_t;
 
 struct kernel_base_t {
-    virtual ~kernel_base_t() = default;
+    virtual ~kernel_base_t();
 
     status_t compile(const dnnl_partition_impl_t *part, const engine_t *aengine,
             const std::vector<logical_tensor_t> &inputs,
@@ -106,11 +108,22 @@ struct kernel_base_t {
     size_t encode_constant_cache_key(
             const std::vector<tensor_t> &inputs, size_t cache_key) const;
 
+    // Gets the constant tensors cached under the key, or adds the given value
+    // under the key. The cached tensors are shared with the other kernels
+    // requesting them until the kernel is destroyed.
+    constant_tensor_cache_t::value_t get_or_add_constant_cache(size_t key,
+            size_t size, const constant_tensor_cache_t::value_t &value);
+
     const std::vector<inplace_pair_t> &get_inplace_pairs() const;
 
 protected:
     std::vector<inplace_pair_t> inplace_pairs_;
     dnnl::engine p_engine_;
+
+private:
+    // The constant tensor cache which the kernel requested tensors from. It
+    // is retained by the kernel until the kernel is destroyed.
+    std::atomic<constant_tensor_cache_t *> constant_cache_ {nullptr};
 };
 
 using kernel_ptr = std::shared_ptr<kernel_base_t>;
@@ -21,6 +21,8 @@
 #include "graph/backend/dnnl/kernels/binary.hpp"
 #include "graph/backend/dnnl/kernels/concat.hpp"
 #include "graph/backend/dnnl/kernels/conv.hpp"
+#include "graph/backend/dnnl/kernels/conv_bnorm.hpp"
+#include "graph/backend/dnnl/kernels/conv_pool.hpp"
 #include "graph/backend/dnnl/kernels/conv_transpose.hpp"
 #include "graph/backend/dnnl/kernels/dummy.hpp"
 #include "graph/backend/dnnl/kernels/eltwise.hpp"
@@ -38,6 +40,7 @@
 #include "graph/backend/dnnl/kernels/reorder.hpp"
 #include "graph/backend/dnnl/kernels/resampling.hpp"
 #include "graph/backend/dnnl/kernels/sdp.hpp"
+#include "graph/backend/dnnl/kernels/sdp_bwd.hpp"
 #include "graph/backend/dnnl/kernels/shuffle.hpp"
 #include "graph/backend/dnnl/kernels/softmax.hpp"
 #include "graph/backend/dnnl/kernels/sum.hpp"
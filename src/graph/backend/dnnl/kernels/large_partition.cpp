@@ -45,6 +45,7 @@ void larger_partition_kernel_t::setup_pipeline_stage1(
     BACKEND_DNNL_ADD_PASS(pipeline, fuse_mul_sigmoid_to_swish);
     BACKEND_DNNL_ADD_PASS(pipeline, fuse_to_dnnl_sum);
     BACKEND_DNNL_ADD_PASS(pipeline, fuse_to_shuffle);
+    BACKEND_DNNL_ADD_PASS(pipeline, fuse_softmax_to_topk);
 
     // TODO(xx) The implementation of these two passes relay on a non-fully
     // lowered subgraph. We need to improve them.
@@ -114,6 +115,9 @@ void larger_partition_kernel_t::setup_pipeline_stage1(
     BACKEND_DNNL_ADD_PASS(pipeline, convert_dynamic_quantize_ops);
 
     BACKEND_DNNL_ADD_PASS(pipeline, insert_u8_to_s8_for_matmul);
+    // matmuls with post-ops have been settled, merge the remaining ones
+    // reading the same src before they get canonicalized independently
+    BACKEND_DNNL_ADD_PASS(pipeline, fuse_parallel_matmuls);
     BACKEND_DNNL_ADD_PASS(pipeline, insert_permute_for_matmul);
     BACKEND_DNNL_ADD_PASS(pipeline, insert_reshape_for_ndx2d_matmul);
     BACKEND_DNNL_ADD_PASS(pipeline, insert_unsqueeze_and_squeeze_for_matmul);
@@ -144,7 +148,7 @@ void larger_partition_kernel_t::setup_pipeline_stage2(pass_pipeline_t &pipeline,
     BACKEND_DNNL_ADD_PASS(pipeline, infer_shape);
     BACKEND_DNNL_ADD_PASS(pipeline, fuse_src_transpose_to_matmul);
     BACKEND_DNNL_ADD_PASS(pipeline, fuse_dst_transpose_to_predecessor);
-    BACKEND_DNNL_ADD_PASS(pipeline, layout_propagation);
+    BACKEND_DNNL_ADD_PASS(pipeline, layout_assignment);
     BACKEND_DNNL_ADD_PASS(pipeline, common_reorder_elimination);
     BACKEND_DNNL_ADD_PASS(pipeline, fuse_adjacent_reorders);
 
@@ -206,6 +210,12 @@ void larger_partition_kernel_t::prepare_args_set(
     for (auto &mem_offkey : res->get_mems_use_internal_temporary()) {
         mem_offkey.first.set_data_handle(var_grantor.get(mem_offkey.second));
     }
+
+    // concat inputs written in place into the concat output
+    for (const auto &sub : res->get_mems_use_sub_buffers()) {
+        sub.mem.set_data_handle(
+                static_cast<char *>(sub.base.get_data_handle()) + sub.offset);
+    }
 }
 
 status_t larger_partition_kernel_t::compile_impl(
@@ -251,7 +261,8 @@ status_t larger_partition_kernel_t::compile_impl(
         return this->memory_planner_.get_exec_args_set().clone();
     };
 
-    const_md_hash_ = generate_constant_md_hash(part->id(),
+    const_md_hash_ = generate_constant_md_hash(
+            get_constant_subgraph_key(part->id(), subgraph_),
             memory_planner_.get_exec_args_set().get_persistent_mem_desc_list());
 
     return status::success;
@@ -282,7 +293,7 @@ status_t larger_partition_kernel_t::execute_impl(const stream_t *g_stream,
                 = encode_constant_cache_key(inputs, const_md_hash_);
         std::promise<constant_tensor_cache_t::cached_t> c_promise;
         constant_tensor_cache_t::value_t cached_value
-                = dnnl_constant_cache_get_or_add(p_engine_, encoded_key,
+                = get_or_add_constant_cache(encoded_key,
                         memory_planner_.total_internal_persistent_size(),
                         c_promise.get_future());
         bool is_from_cache = cached_value.valid();
@@ -353,7 +364,7 @@ status_t larger_partition_kernel_t::sycl_execute_impl(const stream_t *g_stream,
                 = encode_constant_cache_key(inputs, const_md_hash_);
         std::promise<constant_tensor_cache_t::cached_t> c_promise;
         constant_tensor_cache_t::value_t cached_value
-                = dnnl_constant_cache_get_or_add(p_engine_, encoded_key,
+                = get_or_add_constant_cache(encoded_key,
                         memory_planner_.total_internal_persistent_size(),
                         c_promise.get_future());
         bool is_from_cache = cached_value.valid();
@@ -429,7 +440,7 @@ status_t larger_partition_kernel_t::ocl_execute_impl(const stream_t *g_stream,
                 = encode_constant_cache_key(inputs, const_md_hash_);
         std::promise<constant_tensor_cache_t::cached_t> c_promise;
         constant_tensor_cache_t::value_t cached_value
-                = dnnl_constant_cache_get_or_add(p_engine_, encoded_key,
+                = get_or_add_constant_cache(encoded_key,
                         memory_planner_.total_internal_persistent_size(),
                         c_promise.get_future());
         bool is_from_cache = cached_value.valid();
@@ -25,6 +25,7 @@
 
 #include "graph/backend/dnnl/kernels/kernel_base.hpp"
 #include "graph/backend/dnnl/kernels/large_partition.hpp"
+#include "graph/backend/dnnl/kernels/sdp_decode_decomp.hpp"
 #include "graph/backend/dnnl/kernels/sdp_decomp.hpp"
 #include "graph/backend/dnnl/kernels/sdp_primitive.hpp"
 #include "graph/backend/dnnl/kernels/sdp_primitive_v1.hpp"
@@ -79,6 +80,14 @@ public:
             ret = kernel->compile_impl(part, g_engine, inputs, outputs);
         }
 
+        // Decoding steps usually have too few (batch, head) pairs to occupy
+        // all threads, so their keys are split over threads instead. Causal
+        // attention skips the blocks of keys which are masked out.
+        if (ret != status::success && enable_decomp && !quantized) {
+            kernel = std::make_shared<sdp_decode_decomp_kernel_t>();
+            ret = kernel->compile_impl(part, g_engine, inputs, outputs);
+        }
+
         if (ret != status::success && enable_decomp) {
             kernel = std::make_shared<sdp_decomp_kernel_t<quantized, dt>>();
             ret = kernel->compile_impl(part, g_engine, inputs, outputs);
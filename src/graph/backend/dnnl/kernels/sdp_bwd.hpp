@@ -0,0 +1,41 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_SDP_BWD_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_SDP_BWD_HPP
+
+#include "graph/backend/dnnl/kernels/decomp_dispatch.hpp"
+#include "graph/backend/dnnl/kernels/sdp_bwd_decomp.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Backward of scaled dot-product attention. The decomposition kernel is used
+// when possible, so that the attention probabilities and their gradient are
+// only computed block by block.
+struct sdp_bwd_base_t : public decomp_dispatch_base_t<sdp_bwd_decomp_kernel_t> {
+    sdp_bwd_base_t()
+        : decomp_dispatch_base_t<sdp_bwd_decomp_kernel_t>(
+                "sdp backward", "GRAPH_SDP_BWD_FORCE_PRIMITIVE") {}
+};
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
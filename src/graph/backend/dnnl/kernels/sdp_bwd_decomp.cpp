@@ -0,0 +1,547 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+
+#include "graph/backend/dnnl/kernels/sdp_bwd_decomp.hpp"
+
+#include "graph/backend/dnnl/common.hpp"
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+#include "cpu/cpu_stream.hpp"
+#include "oneapi/dnnl/dnnl_threadpool.h"
+#endif
+
+#define VCHECK_SDP_BWD_DECOMP(cond, status, msg, ...) \
+    VCONDCHECK(graph, create, check, sdp_bwd_decomp_kernel_t, (cond), status, \
+            msg, ##__VA_ARGS__);
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+using ltw = logical_tensor_wrapper_t;
+
+namespace {
+// Returns true if `lt` is a plain tensor of shape `shape` with dense
+// row-major strides. A tensor with `any` layout is set to such a tensor.
+bool init_dense(logical_tensor_t &lt, const dims &shape) {
+    const int ndims = static_cast<int>(shape.size());
+    if (ltw(lt).is_any()) {
+        lt.ndims = ndims;
+        lt.layout_type = layout_type::strided;
+        dim_t stride = 1;
+        for (int d = ndims - 1; d >= 0; d--) {
+            lt.dims[d] = shape[d];
+            lt.layout.strides[d] = stride;
+            stride *= shape[d];
+        }
+    }
+    const ltw w(lt);
+    if (!w.is_strided() || w.vdims() != shape) return false;
+    const auto strides = w.vstrides();
+    dim_t stride = 1;
+    for (int d = ndims - 1; d >= 0; d--) {
+        if (shape[d] != 1 && strides[d] != stride) return false;
+        stride *= shape[d];
+    }
+    return true;
+}
+
+bool get_transpose(const op_t *op, op_attr_t attr) {
+    return op->has_attr(attr) && op->get_attr<bool>(attr);
+}
+
+// Returns the op producing the input `offset` of `op`, if any.
+op_t *get_producer(const op_t *op, size_t offset) {
+    const auto val = op->get_input_value(offset);
+    return val->has_producer() ? &val->get_producer() : nullptr;
+}
+
+bool is_scale_kind(const op_t *op) {
+    return op->get_kind() == graph::op_kind::Multiply
+            || op->get_kind() == graph::op_kind::Divide;
+}
+} // namespace
+
+status_t sdp_bwd_decomp_kernel_t::compile_impl(
+        const dnnl_partition_impl_t *part, const engine_t *g_engine,
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    VCHECK_SDP_BWD_DECOMP(g_engine->kind() == engine_kind::cpu,
+            status::unimplemented, "only cpu engine is supported");
+
+    p_engine_ = make_dnnl_engine(*g_engine);
+    g_alloc_
+            = reinterpret_cast<graph::allocator_t *>(g_engine->get_allocator());
+
+    // Ops of the partition.
+    std::vector<op_t *> matmuls, scales;
+    op_t *mask = nullptr, *sub = nullptr, *exp_op = nullptr;
+    op_t *softmax_bwd = nullptr;
+    for (const auto &op : part->get_ops()) {
+        switch (op->get_kind()) {
+            case graph::op_kind::MatMul: matmuls.push_back(op.get()); break;
+            case graph::op_kind::Multiply:
+            case graph::op_kind::Divide: scales.push_back(op.get()); break;
+            case graph::op_kind::Add:
+                VCHECK_SDP_BWD_DECOMP(!mask, status::unimplemented,
+                        "only one mask is supported");
+                mask = op.get();
+                break;
+            case graph::op_kind::Subtract: sub = op.get(); break;
+            case graph::op_kind::Exp: exp_op = op.get(); break;
+            case graph::op_kind::SoftMaxBackward:
+                softmax_bwd = op.get();
+                break;
+            default:
+                VCHECK_SDP_BWD_DECOMP(false, status::unimplemented,
+                        "unexpected op %s", op->get_name().c_str());
+        }
+    }
+    VCHECK_SDP_BWD_DECOMP(matmuls.size() == 5 && sub && exp_op && softmax_bwd
+                    && get_producer(exp_op, 0) == sub
+                    && get_producer(softmax_bwd, 1) == exp_op,
+            status::unimplemented, "unexpected attention backward graph");
+
+    // Forward scores: MatMul -> [scale] -> [mask] -> Subtract.
+    op_t *scale = nullptr;
+    op_t *node = get_producer(sub, 0);
+    if (node && node->get_kind() == graph::op_kind::Add) {
+        node = get_producer(node, 0);
+    } else {
+        VCHECK_SDP_BWD_DECOMP(!mask, status::unimplemented,
+                "unexpected add op %s", mask->get_name().c_str());
+    }
+    if (node && is_scale_kind(node)) {
+        scale = node;
+        node = get_producer(node, 0);
+    }
+    op_t *mm_qk = node;
+    op_t *mm_vdo = get_producer(softmax_bwd, 0);
+    op_t *ds = nullptr, *mm_dv = nullptr, *mm_dq = nullptr, *mm_dk = nullptr;
+    for (op_t *op : scales)
+        if (get_producer(op, 0) == softmax_bwd) ds = op;
+    for (op_t *op : matmuls) {
+        const op_t *src = get_producer(op, 0);
+        if (src == exp_op)
+            mm_dv = op;
+        else if (src && src == ds)
+            (get_transpose(op, op_attr::transpose_a) ? mm_dk : mm_dq) = op;
+    }
+    VCHECK_SDP_BWD_DECOMP(mm_qk && mm_qk->get_kind() == graph::op_kind::MatMul
+                    && mm_vdo && mm_vdo->get_kind() == graph::op_kind::MatMul
+                    && ds && mm_dv && mm_dq && mm_dk
+                    && scales.size() == (scale ? 2U : 1U),
+            status::unimplemented, "unexpected attention backward graph");
+
+    // Only the transposes of the usual {mb, heads, seq, head_size} layout of
+    // Q, K, V and dO are supported.
+    const auto check_transposes = [](const op_t *op, bool ta, bool tb) {
+        return get_transpose(op, op_attr::transpose_a) == ta
+                && get_transpose(op, op_attr::transpose_b) == tb;
+    };
+    VCHECK_SDP_BWD_DECOMP(check_transposes(mm_qk, false, true)
+                    && check_transposes(mm_vdo, false, true)
+                    && check_transposes(mm_dv, true, false)
+                    && check_transposes(mm_dq, false, false)
+                    && check_transposes(mm_dk, true, false),
+            status::unimplemented, "unsupported matmul transposes");
+    const int64_t axis = softmax_bwd->has_attr(op_attr::axis)
+            ? softmax_bwd->get_attr<int64_t>(op_attr::axis)
+            : -1;
+    VCHECK_SDP_BWD_DECOMP(axis == -1 || axis == 3, status::unimplemented,
+            "softmax backward is only supported along the keys");
+
+    // Partition inputs and outputs.
+    const auto input_id = [](const op_t *op, size_t offset) {
+        return op->get_input_value(offset)->get_logical_tensor().id;
+    };
+    const auto find_input = [&](const op_t *op, size_t offset, size_t &idx) {
+        const auto id = input_id(op, offset);
+        for (size_t i = 0; i < inputs.size(); i++)
+            if (inputs[i].id == id) {
+                idx = i;
+                return true;
+            }
+        return false;
+    };
+    const auto find_output = [&](const op_t *op, size_t &idx) {
+        const auto id = op->get_output_value(0)->get_logical_tensor().id;
+        for (size_t i = 0; i < outputs.size(); i++)
+            if (outputs[i].id == id) {
+                idx = i;
+                return true;
+            }
+        return false;
+    };
+    size_t scale_idx = 0, mask_idx = 0;
+    VCHECK_SDP_BWD_DECOMP(find_input(mm_qk, 0, q_idx_)
+                    && find_input(mm_qk, 1, k_idx_)
+                    && find_input(mm_vdo, 0, do_idx_)
+                    && find_input(mm_vdo, 1, v_idx_)
+                    && find_input(sub, 1, stats_idx_)
+                    && find_input(ds, 1, ds_scale_idx_)
+                    && (!scale || find_input(scale, 1, scale_idx))
+                    && (!mask || find_input(mask, 1, mask_idx)),
+            status::unimplemented, "inputs of the partition are not given");
+    VCHECK_SDP_BWD_DECOMP(input_id(mm_dq, 1) == input_id(mm_qk, 1)
+                    && input_id(mm_dk, 1) == input_id(mm_qk, 0)
+                    && input_id(mm_dv, 1) == input_id(mm_vdo, 0),
+            status::unimplemented, "unexpected inputs of the gradients");
+    if (scale) scale_idx_ = static_cast<int>(scale_idx);
+    if (mask) mask_idx_ = static_cast<int>(mask_idx);
+    scale_div_ = scale && scale->get_kind() == graph::op_kind::Divide;
+    ds_scale_div_ = ds->get_kind() == graph::op_kind::Divide;
+    VCHECK_SDP_BWD_DECOMP(outputs.size() == 3 && find_output(mm_dq, dq_idx_)
+                    && find_output(mm_dk, dk_idx_)
+                    && find_output(mm_dv, dv_idx_),
+            status::unimplemented, "unsupported outputs of the partition");
+
+    // Shapes.
+    const auto &q_lt = inputs[q_idx_];
+    const auto &k_lt = inputs[k_idx_];
+    VCHECK_SDP_BWD_DECOMP(ltw(q_lt).ndims() == 4 && ltw(k_lt).ndims() == 4,
+            status::unimplemented, "only 4D inputs are supported");
+    const auto q_dims = ltw(q_lt).vdims();
+    mb_ = q_dims[0];
+    heads_ = q_dims[1];
+    lq_ = q_dims[2];
+    d_ = q_dims[3];
+    lk_ = ltw(k_lt).vdims()[2];
+    const dims q_shape {mb_, heads_, lq_, d_}, k_shape {mb_, heads_, lk_, d_};
+
+    // All tensors are accessed as dense ones. The given logical tensors are
+    // only updated once the kernel is known to be supported, so that the
+    // fallback kernel sees them unchanged.
+    std::vector<logical_tensor_t> new_inputs(inputs), new_outputs(outputs);
+    VCHECK_SDP_BWD_DECOMP(init_dense(new_inputs[q_idx_], q_shape)
+                    && init_dense(new_inputs[do_idx_], q_shape)
+                    && init_dense(new_inputs[k_idx_], k_shape)
+                    && init_dense(new_inputs[v_idx_], k_shape)
+                    && init_dense(new_inputs[stats_idx_],
+                            {mb_, heads_, lq_, 1})
+                    && init_dense(new_outputs[dq_idx_], q_shape)
+                    && init_dense(new_outputs[dk_idx_], k_shape)
+                    && init_dense(new_outputs[dv_idx_], k_shape),
+            status::unimplemented,
+            "only dense tensors without broadcast are supported");
+    for (const auto &lt : new_inputs)
+        VCHECK_SDP_BWD_DECOMP(ltw(lt).data_type() == data_type::f32,
+                status::unimplemented, "only f32 is supported");
+    for (const auto &lt : new_outputs)
+        VCHECK_SDP_BWD_DECOMP(ltw(lt).data_type() == data_type::f32,
+                status::unimplemented, "only f32 is supported");
+    for (int idx : {scale_idx_, static_cast<int>(ds_scale_idx_)}) {
+        if (idx < 0) continue;
+        VCHECK_SDP_BWD_DECOMP(ltw(inputs[idx]).nelems() == 1,
+                status::unimplemented, "only scalar scales are supported");
+    }
+    if (mask) {
+        // The mask is broadcast to {mb, heads, lq, lk} from the right.
+        const auto &mask_lt = inputs[mask_idx_];
+        const int ndims = ltw(mask_lt).ndims();
+        VCHECK_SDP_BWD_DECOMP(ndims >= 1 && ndims <= 4, status::unimplemented,
+                "unsupported mask dimensions");
+        dims shape = ltw(mask_lt).vdims();
+        shape.insert(shape.begin(), 4 - ndims, 1);
+        const dims full {mb_, heads_, lq_, lk_};
+        logical_tensor_t lt = mask_lt;
+        VCHECK_SDP_BWD_DECOMP(init_dense(lt, ltw(mask_lt).vdims()),
+                status::unimplemented, "only dense masks are supported");
+        mask_strides_.assign(4, 0);
+        dim_t stride = 1;
+        for (int d = 3; d >= 0; d--) {
+            VCHECK_SDP_BWD_DECOMP(shape[d] == full[d] || shape[d] == 1,
+                    status::unimplemented, "mask can not be broadcast");
+            if (shape[d] != 1) mask_strides_[d] = stride;
+            stride *= shape[d];
+        }
+    }
+
+    // (Batch, head) pairs are distributed over threads, so the decomposition
+    // only pays off when there are enough of them.
+    nthr_ = dnnl_get_current_num_threads();
+    VCHECK_SDP_BWD_DECOMP(mb_ * heads_ >= nthr_, status::unimplemented,
+            "not enough heads for %d threads: batch %ld, heads %ld", nthr_,
+            static_cast<long int>(mb_), static_cast<long int>(heads_));
+
+    // Blocks of 64 queries and keys keep the scores and the blocks of Q, K,
+    // V, dO and of the gradients in the L2 cache for head sizes up to 256.
+    const dim_t block = 64;
+    bq_ = std::min(lq_, block);
+    bk_ = std::min(lk_, block);
+
+    attr_.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+    const auto fpmath = part->get_fpmath_mode();
+    attr_.set_fpmath_mode(
+            static_cast<dnnl::fpmath_mode>(fpmath.mode_), fpmath.apply_to_int_);
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    // Blocks are multiplied inside of a parallel region, so the primitives
+    // are created for a single thread.
+    omp_set_num_threads(1);
+#endif
+    status_t st = status::success;
+    for (int tq = 0; tq < 2 && st == status::success; tq++)
+        for (int tk = 0; tk < 2 && st == status::success; tk++) {
+            const dim_t rows_q = tq ? lq_ % bq_ : bq_;
+            const dim_t rows_k = tk ? lk_ % bk_ : bk_;
+            if (rows_q == 0 || rows_k == 0) continue;
+            st = init_block_prims(rows_q, rows_k, prims_[tq][tk]);
+        }
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    omp_set_num_threads(nthr_);
+#endif
+    CHECK(st);
+
+    for (size_t i = 0; i < outputs.size(); i++)
+        const_cast<logical_tensor_t &>(outputs[i]) = new_outputs[i];
+    return status::success;
+}
+
+status_t sdp_bwd_decomp_kernel_t::init_block_prims(
+        dim_t rows_q, dim_t rows_k, block_prims_t &b) {
+    const auto f32 = memory::data_type::f32;
+    // Blocks of Q, dO and dQ, and blocks of K, V, dK and dV, are read in
+    // place. Scores are stored densely.
+    b.q_md = memory::desc({rows_q, d_}, f32, {d_, 1});
+    b.kt_md = memory::desc({d_, rows_k}, f32, {1, d_});
+    b.kv_md = memory::desc({rows_k, d_}, f32, {d_, 1});
+    b.s_md = memory::desc({rows_q, rows_k}, f32, {rows_k, 1});
+    b.st_md = memory::desc({rows_k, rows_q}, f32, {1, rows_k});
+
+    dnnl::primitive_attr grad_attr = attr_;
+    dnnl::post_ops ops;
+    ops.append_sum();
+    grad_attr.set_post_ops(ops);
+
+    auto scores_pd = matmul::primitive_desc(
+            p_engine_, b.q_md, b.kt_md, b.s_md, attr_, true);
+    auto exp_pd = eltwise_forward::primitive_desc(p_engine_,
+            prop_kind::forward_inference, algorithm::eltwise_exp, b.s_md,
+            b.s_md, 0.f, 0.f, attr_, true);
+    auto grad_kv_pd = matmul::primitive_desc(
+            p_engine_, b.st_md, b.q_md, b.kv_md, grad_attr, true);
+    auto grad_q_pd = matmul::primitive_desc(
+            p_engine_, b.s_md, b.kv_md, b.q_md, grad_attr, true);
+    VCHECK_SDP_BWD_DECOMP(scores_pd && exp_pd && grad_kv_pd && grad_q_pd,
+            status::unimplemented,
+            "failed to create primitives for a %ldx%ld block",
+            static_cast<long int>(rows_q), static_cast<long int>(rows_k));
+
+    for (const auto *pd : {static_cast<const dnnl::primitive_desc *>(
+                                   &scores_pd),
+                 static_cast<const dnnl::primitive_desc *>(&exp_pd),
+                 static_cast<const dnnl::primitive_desc *>(&grad_kv_pd),
+                 static_cast<const dnnl::primitive_desc *>(&grad_q_pd)})
+        scratchpad_size_
+                = std::max(scratchpad_size_, pd->scratchpad_desc().get_size());
+    b.scores = matmul(scores_pd);
+    b.exp = eltwise_forward(exp_pd);
+    b.grad_kv = matmul(grad_kv_pd);
+    b.grad_q = matmul(grad_q_pd);
+    return status::success;
+}
+
+status_t sdp_bwd_decomp_kernel_t::execute_impl(const stream_t *g_stream,
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs) {
+    dnnl::stream strm = make_dnnl_stream(p_engine_, *g_stream);
+
+    int nthr = nthr_;
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    auto *tp_stream
+            = dnnl::impl::utils::downcast<dnnl::impl::cpu::cpu_stream_t *>(
+                    const_cast<stream_t *>(g_stream));
+    tp_stream->before_exec_hook();
+    dnnl_threadpool_interop_get_max_concurrency(&nthr);
+    tp_stream->after_exec_hook();
+#endif
+
+    // Each thread holds the probabilities and their gradient for a block,
+    // the row sums of the softmax backward for all queries and the
+    // scratchpad of the primitives.
+    using dnnl::impl::utils::rnd_up;
+    constexpr size_t align = 64;
+    const size_t block_size = rnd_up(bq_ * bk_ * sizeof(float), align);
+    const size_t rows_size = rnd_up(lq_ * sizeof(float), align);
+    const size_t thr_size = 2 * block_size + rows_size
+            + rnd_up(scratchpad_size_, align);
+    temporary_scratchpad_t scratchpad(nthr * thr_size, p_engine_, *g_alloc_);
+    assertm(scratchpad.size() >= nthr * thr_size,
+            "no enough scratchpad memory");
+    char *buf = scratchpad.get_buffer();
+
+    const auto in_ptr = [&](size_t idx) {
+        return static_cast<float *>(inputs[idx].get_data_handle());
+    };
+    const auto out_ptr = [&](size_t idx) {
+        return static_cast<float *>(outputs[idx].get_data_handle());
+    };
+    const float *q = in_ptr(q_idx_), *k = in_ptr(k_idx_), *v = in_ptr(v_idx_),
+                *d_o = in_ptr(do_idx_), *stats = in_ptr(stats_idx_);
+    const float *mask = mask_idx_ >= 0 ? in_ptr(mask_idx_) : nullptr;
+    float *dq = out_ptr(dq_idx_), *dk = out_ptr(dk_idx_),
+          *dv = out_ptr(dv_idx_);
+
+    float scale = 1.f;
+    if (scale_idx_ >= 0) {
+        const float s = *in_ptr(scale_idx_);
+        scale = scale_div_ ? 1.f / s : s;
+    }
+    const float s = *in_ptr(ds_scale_idx_);
+    const float ds_scale = ds_scale_div_ ? 1.f / s : s;
+
+    const memory::desc scratchpad_md({static_cast<dim_t>(scratchpad_size_)},
+            memory::data_type::u8, memory::format_tag::a);
+
+    const auto loop = [&](int ithr, int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(mb_ * heads_, nthr, ithr, start, end);
+        if (start == end) return;
+
+        char *thr_buf = buf + ithr * thr_size;
+        float *p_buf = reinterpret_cast<float *>(thr_buf);
+        float *dp_buf = reinterpret_cast<float *>(thr_buf + block_size);
+        float *rows_buf
+                = reinterpret_cast<float *>(thr_buf + 2 * block_size);
+        memory prim_scratchpad(scratchpad_md, p_engine_,
+                thr_buf + 2 * block_size + rows_size);
+
+        const auto mem = [&](const memory::desc &md, const float *ptr) {
+            return memory(md, p_engine_, const_cast<float *>(ptr));
+        };
+        const auto exec = [&](const dnnl::primitive &prim, const memory &src,
+                                  const memory &wei, const memory &dst) {
+            prim.execute(strm,
+                    {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                            {DNNL_ARG_DST, dst},
+                            {DNNL_ARG_SCRATCHPAD, prim_scratchpad}});
+        };
+
+        for (dim_t bh = start; bh < end; bh++) {
+            const dim_t n = bh / heads_, h = bh % heads_;
+            const float *q_bh = q + bh * lq_ * d_, *do_bh = d_o + bh * lq_ * d_;
+            const float *k_bh = k + bh * lk_ * d_, *v_bh = v + bh * lk_ * d_;
+            const float *lse = stats + bh * lq_;
+            const float *mask_bh = mask
+                    ? mask + n * mask_strides_[0] + h * mask_strides_[1]
+                    : nullptr;
+            float *dq_bh = dq + bh * lq_ * d_;
+            float *dk_bh = dk + bh * lk_ * d_, *dv_bh = dv + bh * lk_ * d_;
+            std::fill(dq_bh, dq_bh + lq_ * d_, 0.f);
+            std::fill(dk_bh, dk_bh + lk_ * d_, 0.f);
+            std::fill(dv_bh, dv_bh + lk_ * d_, 0.f);
+
+            for (dim_t i0 = 0; i0 < lq_; i0 += bq_) {
+                const dim_t rq = std::min(bq_, lq_ - i0);
+                float *rsum = rows_buf + i0;
+
+                // Computes the probabilities P of the block of keys j0 into
+                // p_buf and the gradient dP into dp_buf.
+                const auto compute_block = [&](const block_prims_t &b,
+                                                   dim_t j0, dim_t rk) {
+                    const memory p_mem = mem(b.s_md, p_buf);
+                    exec(b.scores, mem(b.q_md, q_bh + i0 * d_),
+                            mem(b.kt_md, k_bh + j0 * d_), p_mem);
+                    for (dim_t r = 0; r < rq; r++) {
+                        float *p = p_buf + r * rk;
+                        const float l = lse[i0 + r];
+                        if (mask_bh) {
+                            const float *m = mask_bh
+                                    + (i0 + r) * mask_strides_[2]
+                                    + j0 * mask_strides_[3];
+                            const dim_t ms = mask_strides_[3];
+                            PRAGMA_OMP_SIMD()
+                            for (dim_t c = 0; c < rk; c++)
+                                p[c] = p[c] * scale + m[c * ms] - l;
+                        } else {
+                            PRAGMA_OMP_SIMD()
+                            for (dim_t c = 0; c < rk; c++)
+                                p[c] = p[c] * scale - l;
+                        }
+                    }
+                    b.exp.execute(strm,
+                            {{DNNL_ARG_SRC, p_mem}, {DNNL_ARG_DST, p_mem},
+                                    {DNNL_ARG_SCRATCHPAD, prim_scratchpad}});
+                    exec(b.scores, mem(b.q_md, do_bh + i0 * d_),
+                            mem(b.kt_md, v_bh + j0 * d_),
+                            mem(b.s_md, dp_buf));
+                };
+
+                // Row sums of P * dP over all keys.
+                std::fill(rsum, rsum + rq, 0.f);
+                for (dim_t j0 = 0; j0 < lk_; j0 += bk_) {
+                    const dim_t rk = std::min(bk_, lk_ - j0);
+                    compute_block(prims_[rq != bq_][rk != bk_], j0, rk);
+                    for (dim_t r = 0; r < rq; r++) {
+                        const float *p = p_buf + r * rk, *dp = dp_buf + r * rk;
+                        float acc = 0.f;
+                        PRAGMA_OMP_SIMD(reduction(+ : acc))
+                        for (dim_t c = 0; c < rk; c++)
+                            acc += p[c] * dp[c];
+                        rsum[r] += acc;
+                    }
+                }
+
+                // Gradients of the blocks.
+                for (dim_t j0 = 0; j0 < lk_; j0 += bk_) {
+                    const dim_t rk = std::min(bk_, lk_ - j0);
+                    const auto &b = prims_[rq != bq_][rk != bk_];
+                    compute_block(b, j0, rk);
+                    // dS = P * (dP - rowsum(P * dP)) * scale, in place of dP.
+                    for (dim_t r = 0; r < rq; r++) {
+                        const float *p = p_buf + r * rk;
+                        float *dp = dp_buf + r * rk;
+                        const float rs = rsum[r];
+                        PRAGMA_OMP_SIMD()
+                        for (dim_t c = 0; c < rk; c++)
+                            dp[c] = p[c] * (dp[c] - rs) * ds_scale;
+                    }
+                    exec(b.grad_kv, mem(b.st_md, p_buf),
+                            mem(b.q_md, do_bh + i0 * d_),
+                            mem(b.kv_md, dv_bh + j0 * d_));
+                    exec(b.grad_kv, mem(b.st_md, dp_buf),
+                            mem(b.q_md, q_bh + i0 * d_),
+                            mem(b.kv_md, dk_bh + j0 * d_));
+                    exec(b.grad_q, mem(b.s_md, dp_buf),
+                            mem(b.kv_md, k_bh + j0 * d_),
+                            mem(b.q_md, dq_bh + i0 * d_));
+                }
+            }
+        }
+    };
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    tp_stream->before_exec_hook();
+#endif
+    parallel(nthr, loop);
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    tp_stream->after_exec_hook();
+#endif
+    return status::success;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
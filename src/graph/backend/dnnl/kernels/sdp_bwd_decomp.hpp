@@ -0,0 +1,140 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_SDP_BWD_DECOMP_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_SDP_BWD_DECOMP_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "graph/backend/dnnl/kernels/kernel_base.hpp"
+
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+#include "graph/backend/dnnl/scratchpad.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Backward of scaled dot-product attention, decomposed into blocks of
+// queries and keys in the way of flash attention.
+//
+// The attention probabilities of a block are recomputed from the scores of
+// the block and the logsumexp of the forward pass instead of being read from
+// memory, so neither the probabilities nor their gradient are ever
+// materialized for the whole sequence. Each thread processes whole (batch,
+// head) pairs: a first sweep over the blocks computes the row sums of the
+// softmax backward, and a second sweep computes the gradients of the blocks
+// and accumulates them into dQ, dK and dV. Blocks are multiplied by
+// single-threaded matmul primitives created for each distinct block shape.
+struct sdp_bwd_decomp_kernel_t : public kernel_base_t {
+private:
+    allocator_t *g_alloc_ = nullptr;
+
+    int nthr_ = 1;
+
+    // Shapes: Q and dO are {mb, heads, lq, d}, K and V are {mb, heads, lk, d}.
+    dim_t mb_ = 0, heads_ = 0, lq_ = 0, lk_ = 0, d_ = 0;
+    // Block sizes along the queries and the keys.
+    dim_t bq_ = 0, bk_ = 0;
+
+    // Positions of the partition inputs.
+    size_t q_idx_ = 0, k_idx_ = 0, v_idx_ = 0, do_idx_ = 0, stats_idx_ = 0,
+           ds_scale_idx_ = 0;
+    int scale_idx_ = -1, mask_idx_ = -1;
+    // Whether the scales divide instead of multiplying.
+    bool scale_div_ = false, ds_scale_div_ = false;
+    // Positions of the partition outputs.
+    size_t dq_idx_ = 0, dk_idx_ = 0, dv_idx_ = 0;
+
+    // Strides of the additive mask over {mb, heads, lq, lk}, which are zero
+    // along broadcast dimensions.
+    dims mask_strides_;
+
+    // Primitives for a block of queries and keys.
+    struct block_prims_t {
+        // S = Q K^T and dP = dO V^T.
+        dnnl::primitive scores;
+        // P = exp(S), in place.
+        dnnl::primitive exp;
+        // dV += P^T dO and dK += dS^T Q.
+        dnnl::primitive grad_kv;
+        // dQ += dS K.
+        dnnl::primitive grad_q;
+        memory::desc q_md, kt_md, s_md, st_md, kv_md;
+    };
+    // Indexed by whether the block is the last, partial, one along the
+    // queries and the keys.
+    block_prims_t prims_[2][2];
+
+    dnnl::primitive_attr attr_;
+    size_t scratchpad_size_ = 0;
+
+    status_t init_block_prims(dim_t rows_q, dim_t rows_k, block_prims_t &b);
+
+public:
+    status_t compile_impl(const dnnl_partition_impl_t *part,
+            const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) override;
+
+    status_t execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override;
+
+#ifdef DNNL_WITH_SYCL
+    status_t sycl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(sycl_deps);
+        UNUSED(sycl_event);
+        return status::unimplemented;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    status_t ocl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<cl_event> &cl_deps,
+            cl_event *ret_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(cl_deps);
+        UNUSED(ret_event);
+        return status::unimplemented;
+    }
+#endif
+
+    DEF_KERNEL_METHOD_STR(sdp_bwd_decomp_kernel_t)
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,702 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "graph/backend/dnnl/kernels/sdp_decode_decomp.hpp"
+
+#include "graph/backend/dnnl/common.hpp"
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+#include "cpu/cpu_stream.hpp"
+#include "oneapi/dnnl/dnnl_threadpool.h"
+#endif
+
+#define VCHECK_SDP_DECODE_DECOMP(cond, status, msg, ...) \
+    VCONDCHECK(graph, create, check, sdp_decode_decomp_kernel_t, (cond), \
+            status, msg, ##__VA_ARGS__);
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+using ltw = logical_tensor_wrapper_t;
+
+namespace {
+// Returns true if `lt` is a strided tensor. A tensor with `any` layout is set
+// to a dense row-major one.
+bool init_strided(logical_tensor_t &lt) {
+    if (ltw(lt).is_any()) {
+        lt.layout_type = layout_type::strided;
+        dim_t stride = 1;
+        for (int d = lt.ndims - 1; d >= 0; d--) {
+            lt.layout.strides[d] = stride;
+            stride *= lt.dims[d];
+        }
+    }
+    return ltw(lt).is_strided();
+}
+
+bool get_transpose(const op_t *op, op_attr_t attr) {
+    return op->has_attr(attr) && op->get_attr<bool>(attr);
+}
+
+// Returns the op producing the input `offset` of `op`, if any.
+op_t *get_producer(const op_t *op, size_t offset) {
+    const auto val = op->get_input_value(offset);
+    return val->has_producer() ? &val->get_producer() : nullptr;
+}
+
+bool is_op_kind(const op_t *op, op_kind_t kind) {
+    return op && op->get_kind() == kind;
+}
+
+bool is_float_dt(data_type_t dt) {
+    return dnnl::impl::utils::one_of(dt, graph::data_type::f32,
+            graph::data_type::bf16, graph::data_type::f16);
+}
+} // namespace
+
+status_t sdp_decode_decomp_kernel_t::compile_impl(
+        const dnnl_partition_impl_t *part, const engine_t *g_engine,
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    VCHECK_SDP_DECODE_DECOMP(g_engine->kind() == engine_kind::cpu,
+            status::unimplemented, "only cpu engine is supported");
+
+    p_engine_ = make_dnnl_engine(*g_engine);
+    g_alloc_
+            = reinterpret_cast<graph::allocator_t *>(g_engine->get_allocator());
+
+    const auto find_input = [&](const op_t *op, size_t offset, size_t &idx) {
+        const auto id = op->get_input_value(offset)->get_logical_tensor().id;
+        for (size_t i = 0; i < inputs.size(); i++)
+            if (inputs[i].id == id) {
+                idx = i;
+                return true;
+            }
+        return false;
+    };
+
+    // Ops of the partition:
+    // MatMul -> [scale] -> [causal mask] -> [mask] -> SoftMax -> MatMul.
+    std::vector<op_t *> matmuls;
+    op_t *softmax = nullptr;
+    for (const auto &op : part->get_ops()) {
+        if (op->get_kind() == graph::op_kind::MatMul)
+            matmuls.push_back(op.get());
+        else if (op->get_kind() == graph::op_kind::SoftMax)
+            softmax = op.get();
+    }
+    VCHECK_SDP_DECODE_DECOMP(matmuls.size() == 2 && softmax
+                    && softmax->num_outputs() == 1,
+            status::unimplemented, "unexpected attention graph");
+    size_t num_ops = 3;
+    op_t *node = get_producer(softmax, 0);
+    op_t *mask = nullptr, *select = nullptr, *scale = nullptr;
+    if (is_op_kind(node, graph::op_kind::Add)) {
+        mask = node;
+        node = get_producer(node, 0);
+        num_ops++;
+    }
+    if (is_op_kind(node, graph::op_kind::Select)) {
+        select = node;
+        node = get_producer(node, 1);
+    }
+    if (is_op_kind(node, graph::op_kind::Multiply)
+            || is_op_kind(node, graph::op_kind::Divide)) {
+        scale = node;
+        node = get_producer(node, 0);
+        num_ops++;
+    }
+    op_t *mm_qk = node, *mm_pv = nullptr;
+    for (op_t *op : matmuls)
+        if (get_producer(op, 0) == softmax) mm_pv = op;
+    VCHECK_SDP_DECODE_DECOMP(mm_pv && mm_pv != mm_qk
+                    && is_op_kind(mm_qk, graph::op_kind::MatMul),
+            status::unimplemented, "unexpected attention graph");
+
+    if (select) {
+        // An implicit causal mask compares the row and column indices of the
+        // scores generated by GenIndex ops.
+        const auto is_gen_index = [&](const op_t *op, int64_t axis) {
+            if (!is_op_kind(op, graph::op_kind::GenIndex)
+                    || op->get_input_value(0) != select->get_input_value(1))
+                return false;
+            const int64_t a = op->get_attr<int64_t>(op_attr::axis);
+            return a == axis || a + 4 == axis;
+        };
+        const op_t *ge = get_producer(select, 0);
+        VCHECK_SDP_DECODE_DECOMP(is_op_kind(ge, graph::op_kind::GreaterEqual)
+                        && is_gen_index(get_producer(ge, 1), 3)
+                        && find_input(select, 2, causal_value_idx_),
+                status::unimplemented, "only implicit causal masks are "
+                                       "supported by select");
+        const op_t *row = get_producer(ge, 0);
+        if (is_gen_index(row, 2)) {
+            causal_ = attn_mask_type::top_left;
+            num_ops += 4;
+        } else {
+            // (row + s_kv) - s_q >= col.
+            const op_t *add = is_op_kind(row, graph::op_kind::Subtract)
+                    ? get_producer(row, 0)
+                    : nullptr;
+            VCHECK_SDP_DECODE_DECOMP(is_op_kind(add, graph::op_kind::Add),
+                    status::unimplemented, "unsupported causal mask");
+            const size_t row_offset
+                    = is_gen_index(get_producer(add, 0), 2) ? 0 : 1;
+            size_t s_kv_idx = 0, s_q_idx = 0;
+            VCHECK_SDP_DECODE_DECOMP(
+                    is_gen_index(get_producer(add, row_offset), 2)
+                            && find_input(add, 1 - row_offset, s_kv_idx)
+                            && find_input(row, 1, s_q_idx)
+                            && ltw(inputs[s_kv_idx]).data_type()
+                                    == graph::data_type::s32
+                            && ltw(inputs[s_q_idx]).data_type()
+                                    == graph::data_type::s32,
+                    status::unimplemented, "unsupported causal mask");
+            causal_ = attn_mask_type::bottom_right;
+            s_kv_idx_ = static_cast<int>(s_kv_idx);
+            s_q_idx_ = static_cast<int>(s_q_idx);
+            num_ops += 6;
+        }
+        VCHECK_SDP_DECODE_DECOMP(
+                is_float_dt(ltw(inputs[causal_value_idx_]).data_type()),
+                status::unimplemented, "unsupported causal mask value");
+    }
+    VCHECK_SDP_DECODE_DECOMP(part->get_ops().size() == num_ops,
+            status::unimplemented, "unexpected ops in the attention graph");
+
+    const bool transpose_k = get_transpose(mm_qk, op_attr::transpose_b);
+    VCHECK_SDP_DECODE_DECOMP(!get_transpose(mm_qk, op_attr::transpose_a)
+                    && !get_transpose(mm_pv, op_attr::transpose_a)
+                    && !get_transpose(mm_pv, op_attr::transpose_b),
+            status::unimplemented, "unsupported matmul transposes");
+    const int64_t axis = softmax->has_attr(op_attr::axis)
+            ? softmax->get_attr<int64_t>(op_attr::axis)
+            : -1;
+    VCHECK_SDP_DECODE_DECOMP(axis == -1 || axis == 3, status::unimplemented,
+            "softmax is only supported along the keys");
+    const std::string mode = softmax->has_attr(op_attr::mode)
+            ? softmax->get_attr<std::string>(op_attr::mode)
+            : "none";
+    inf_as_zero_ = mode == "inf_as_zero";
+
+    // Partition inputs and outputs.
+    size_t scale_idx = 0, mask_idx = 0;
+    VCHECK_SDP_DECODE_DECOMP(find_input(mm_qk, 0, q_idx_)
+                    && find_input(mm_qk, 1, k_idx_)
+                    && find_input(mm_pv, 1, v_idx_)
+                    && (!scale || find_input(scale, 1, scale_idx))
+                    && (!mask || find_input(mask, 1, mask_idx)),
+            status::unimplemented, "inputs of the partition are not given");
+    VCHECK_SDP_DECODE_DECOMP(outputs.size() == 1
+                    && outputs[0].id
+                            == mm_pv->get_output_value(0)
+                                       ->get_logical_tensor()
+                                       .id,
+            status::unimplemented, "unsupported outputs of the partition");
+    if (scale) scale_idx_ = static_cast<int>(scale_idx);
+    if (mask) mask_idx_ = static_cast<int>(mask_idx);
+    scale_div_ = scale && scale->get_kind() == graph::op_kind::Divide;
+
+    // Shapes and strides.
+    std::vector<logical_tensor_t> new_outputs(outputs);
+    const auto &q_lt = inputs[q_idx_];
+    const auto &k_lt = inputs[k_idx_];
+    const auto &v_lt = inputs[v_idx_];
+    auto &dst_lt = new_outputs[0];
+    VCHECK_SDP_DECODE_DECOMP(ltw(q_lt).ndims() == 4 && ltw(k_lt).ndims() == 4
+                    && ltw(v_lt).ndims() == 4 && ltw(dst_lt).ndims() == 4,
+            status::unimplemented, "only 4D tensors are supported");
+    VCHECK_SDP_DECODE_DECOMP(ltw(q_lt).is_strided() && ltw(k_lt).is_strided()
+                    && ltw(v_lt).is_strided() && init_strided(dst_lt),
+            status::unimplemented, "only strided tensors are supported");
+    const auto q_dims = ltw(q_lt).vdims();
+    mb_ = q_dims[0];
+    heads_ = q_dims[1];
+    lq_ = q_dims[2];
+    dk_ = q_dims[3];
+    q_strides_ = ltw(q_lt).vstrides();
+    dims k_dims = ltw(k_lt).vdims();
+    k_strides_ = ltw(k_lt).vstrides();
+    if (!transpose_k) {
+        std::swap(k_dims[2], k_dims[3]);
+        std::swap(k_strides_[2], k_strides_[3]);
+    }
+    const dims v_dims = ltw(v_lt).vdims();
+    v_strides_ = ltw(v_lt).vstrides();
+    lk_ = k_dims[2];
+    dv_ = v_dims[3];
+    dst_strides_ = ltw(dst_lt).vstrides();
+    for (int d = 0; d < 2; d++) {
+        const dim_t full = d == 0 ? mb_ : heads_;
+        VCHECK_SDP_DECODE_DECOMP(dnnl::impl::utils::one_of(k_dims[d], 1, full)
+                        && dnnl::impl::utils::one_of(v_dims[d], 1, full),
+                status::unimplemented, "key and value can not be broadcast");
+        if (k_dims[d] == 1) k_strides_[d] = 0;
+        if (v_dims[d] == 1) v_strides_[d] = 0;
+    }
+    VCHECK_SDP_DECODE_DECOMP(k_dims[3] == dk_ && v_dims[2] == lk_
+                    && ltw(dst_lt).vdims() == dims({mb_, heads_, lq_, dv_}),
+            status::unimplemented, "inconsistent attention shapes");
+
+    const auto q_dt = ltw(q_lt).data_type();
+    VCHECK_SDP_DECODE_DECOMP(is_float_dt(q_dt) && ltw(k_lt).data_type() == q_dt
+                    && ltw(v_lt).data_type() == q_dt
+                    && is_float_dt(ltw(dst_lt).data_type()),
+            status::unimplemented,
+            "only floating-point query, key and value of the same data type "
+            "are supported");
+    if (scale) {
+        const auto &scale_lt = inputs[scale_idx_];
+        scale_dt_ = ltw(scale_lt).data_type();
+        VCHECK_SDP_DECODE_DECOMP(
+                ltw(scale_lt).nelems() == 1 && is_float_dt(scale_dt_),
+                status::unimplemented, "only scalar scales are supported");
+    }
+    if (mask) {
+        // The mask is broadcast to {mb, heads, lq, lk} from the right.
+        const auto &mask_lt = inputs[mask_idx_];
+        const int ndims = ltw(mask_lt).ndims();
+        mask_dt_ = ltw(mask_lt).data_type();
+        VCHECK_SDP_DECODE_DECOMP(ndims >= 1 && ndims <= 4
+                        && ltw(mask_lt).is_strided() && is_float_dt(mask_dt_),
+                status::unimplemented, "unsupported mask");
+        dims shape = ltw(mask_lt).vdims();
+        mask_strides_ = ltw(mask_lt).vstrides();
+        shape.insert(shape.begin(), 4 - ndims, 1);
+        mask_strides_.insert(mask_strides_.begin(), 4 - ndims, 0);
+        const dims full {mb_, heads_, lq_, lk_};
+        for (int d = 0; d < 4; d++) {
+            VCHECK_SDP_DECODE_DECOMP(shape[d] == full[d] || shape[d] == 1,
+                    status::unimplemented, "mask can not be broadcast");
+            if (shape[d] == 1) mask_strides_[d] = 0;
+        }
+    }
+
+    // Blocks of 64 queries keep the scores of a block in the L2 cache. The
+    // few queries of a decoding step use longer blocks of keys to amortize
+    // the calls to the primitives.
+    using dnnl::impl::utils::div_up;
+    using dnnl::impl::utils::rnd_up;
+    bq_ = std::min<dim_t>(lq_, 64);
+    bk_ = std::min(lk_, std::max<dim_t>(128, std::min<dim_t>(512, 8192 / bq_)));
+
+    // The keys are split so that every thread gets work, but chunks are kept
+    // long enough to amortize the merge of their partial outputs. The length
+    // of the chunks can be set by an internal env var, so that the split is
+    // tested with any number of threads.
+    nthr_ = dnnl_get_current_num_threads();
+    const dim_t nqb = div_up(lq_, bq_), min_chunk = 256;
+    const dim_t forced_chunk
+            = graph::utils::getenv_int_internal("GRAPH_SDPA_FLASH_CHUNK", 0);
+    const dim_t chunk = forced_chunk > 0
+            ? forced_chunk
+            : std::max(min_chunk,
+                    div_up(lk_, div_up(nthr_, mb_ * heads_ * nqb)));
+    chunk_ = std::min(rnd_up(lk_, bk_), rnd_up(chunk, bk_));
+    nchunks_ = div_up(lk_, chunk_);
+
+    // Other attention is left to the decomposition over (batch, head) pairs
+    // unless it has a causal mask.
+    const dim_t max_lq = 16;
+    const bool is_decode = lq_ <= max_lq && nchunks_ > 1;
+    VCHECK_SDP_DECODE_DECOMP(causal_ != attn_mask_type::undef || is_decode,
+            status::unimplemented,
+            "neither causal nor decoding attention: %ld queries, %ld keys, "
+            "batch %ld, heads %ld, %d threads",
+            static_cast<long int>(lq_), static_cast<long int>(lk_),
+            static_cast<long int>(mb_), static_cast<long int>(heads_), nthr_);
+
+    attr_.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+    const auto fpmath = part->get_fpmath_mode();
+    attr_.set_fpmath_mode(
+            static_cast<dnnl::fpmath_mode>(fpmath.mode_), fpmath.apply_to_int_);
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    // Blocks are processed inside of a parallel region, so the primitives
+    // are created for a single thread.
+    omp_set_num_threads(1);
+#endif
+    const auto dt = static_cast<memory::data_type>(q_dt);
+    const auto dst_dt = static_cast<memory::data_type>(
+            ltw(dst_lt).data_type());
+    status_t st = status::success;
+    for (int tq = 0; tq < 2 && st == status::success; tq++) {
+        const dim_t rows_q = tq ? lq_ % bq_ : bq_;
+        if (rows_q == 0) continue;
+        for (int tk = 0; tk < 2 && st == status::success; tk++) {
+            const dim_t rows_k = tk ? lk_ % bk_ : bk_;
+            if (rows_k == 0) continue;
+            st = init_block_prims(rows_q, rows_k, dt, prims_[tq][tk]);
+        }
+        if (st != status::success) break;
+        dst_md_[tq] = memory::desc(
+                {rows_q, dv_}, dst_dt, {dst_strides_[2], dst_strides_[3]});
+        const auto &o_md = prims_[tq][0].o_md;
+        auto dst_pd = reorder::primitive_desc(
+                p_engine_, o_md, p_engine_, dst_md_[tq], attr_, true);
+        if (!dst_pd) {
+            st = status::unimplemented;
+            break;
+        }
+        scratchpad_size_ = std::max(
+                scratchpad_size_, dst_pd.scratchpad_desc().get_size());
+        dst_reorder_[tq] = reorder(dst_pd);
+    }
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    omp_set_num_threads(nthr_);
+#endif
+    VCHECK_SDP_DECODE_DECOMP(st == status::success, st,
+            "failed to create primitives for blocks of %ldx%ld",
+            static_cast<long int>(bq_), static_cast<long int>(bk_));
+
+    const_cast<logical_tensor_t &>(outputs[0]) = dst_lt;
+    return status::success;
+}
+
+status_t sdp_decode_decomp_kernel_t::init_block_prims(
+        dim_t rows_q, dim_t rows_k, memory::data_type dt, block_prims_t &b) {
+    const auto f32 = memory::data_type::f32;
+    // Blocks of Q, K and V are read in place. Scores and partial outputs are
+    // stored densely.
+    b.q_md = memory::desc({rows_q, dk_}, dt, {q_strides_[2], q_strides_[3]});
+    b.k_md = memory::desc({dk_, rows_k}, dt, {k_strides_[3], k_strides_[2]});
+    b.v_md = memory::desc({rows_k, dv_}, dt, {v_strides_[2], v_strides_[3]});
+    b.s_md = memory::desc({rows_q, rows_k}, f32, {rows_k, 1});
+    b.p_md = memory::desc({rows_q, rows_k}, dt, {rows_k, 1});
+    b.o_md = memory::desc({rows_q, dv_}, f32, {dv_, 1});
+
+    dnnl::primitive_attr pv_attr = attr_;
+    dnnl::post_ops ops;
+    ops.append_sum();
+    pv_attr.set_post_ops(ops);
+
+    auto scores_pd = matmul::primitive_desc(
+            p_engine_, b.q_md, b.k_md, b.s_md, attr_, true);
+    auto exp_pd = eltwise_forward::primitive_desc(p_engine_,
+            prop_kind::forward_inference, algorithm::eltwise_exp, b.s_md,
+            b.s_md, 0.f, 0.f, attr_, true);
+    auto pv_pd = matmul::primitive_desc(
+            p_engine_, b.p_md, b.v_md, b.o_md, pv_attr, true);
+    if (!scores_pd || !exp_pd || !pv_pd) return status::unimplemented;
+    for (const auto *pd : {static_cast<const dnnl::primitive_desc *>(
+                                   &scores_pd),
+                 static_cast<const dnnl::primitive_desc *>(&exp_pd),
+                 static_cast<const dnnl::primitive_desc *>(&pv_pd)})
+        scratchpad_size_
+                = std::max(scratchpad_size_, pd->scratchpad_desc().get_size());
+
+    if (dt != f32) {
+        auto to_v_dt_pd = reorder::primitive_desc(
+                p_engine_, b.s_md, p_engine_, b.p_md, attr_, true);
+        if (!to_v_dt_pd) return status::unimplemented;
+        scratchpad_size_ = std::max(
+                scratchpad_size_, to_v_dt_pd.scratchpad_desc().get_size());
+        b.to_v_dt = reorder(to_v_dt_pd);
+    }
+    b.scores = matmul(scores_pd);
+    b.exp = eltwise_forward(exp_pd);
+    b.pv = matmul(pv_pd);
+    return status::success;
+}
+
+status_t sdp_decode_decomp_kernel_t::execute_impl(const stream_t *g_stream,
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs) {
+    dnnl::stream strm = make_dnnl_stream(p_engine_, *g_stream);
+
+    int nthr = nthr_;
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    auto *tp_stream
+            = dnnl::impl::utils::downcast<dnnl::impl::cpu::cpu_stream_t *>(
+                    const_cast<stream_t *>(g_stream));
+    tp_stream->before_exec_hook();
+    dnnl_threadpool_interop_get_max_concurrency(&nthr);
+    tp_stream->after_exec_hook();
+#endif
+
+    // Work items are chunks of keys of blocks of queries of (batch, head)
+    // pairs. Each thread holds the scores of a block, their conversion to
+    // the data type of V and the scratchpad of the primitives. The partial
+    // outputs and the row maximums and sums of all work items are shared.
+    using dnnl::impl::utils::rnd_up;
+    constexpr size_t align = 64;
+    const dim_t nqb = dnnl::impl::utils::div_up(lq_, bq_);
+    const dim_t pairs = mb_ * heads_, work = pairs * nqb * nchunks_;
+    const auto &b0 = prims_[0][0];
+    const size_t s_size = rnd_up(b0.s_md.get_size(), align);
+    const size_t p_size = b0.to_v_dt ? rnd_up(b0.p_md.get_size(), align) : 0;
+    const size_t thr_size
+            = s_size + p_size + rnd_up(scratchpad_size_, align);
+    const size_t o_size = rnd_up(work * bq_ * dv_ * sizeof(float), align);
+    const size_t stats_size = rnd_up(work * bq_ * sizeof(float), align);
+    const size_t size = nthr * thr_size + o_size + 2 * stats_size;
+    temporary_scratchpad_t scratchpad(size, p_engine_, *g_alloc_);
+    assertm(scratchpad.size() >= size, "no enough scratchpad memory");
+    char *buf = scratchpad.get_buffer();
+    float *o_buf = reinterpret_cast<float *>(buf + nthr * thr_size);
+    float *max_buf = reinterpret_cast<float *>(buf + nthr * thr_size + o_size);
+    float *sum_buf = max_buf + stats_size / sizeof(float);
+
+    const auto in_ptr = [&](size_t idx) {
+        return static_cast<const char *>(inputs[idx].get_data_handle());
+    };
+    const char *q = in_ptr(q_idx_), *k = in_ptr(k_idx_), *v = in_ptr(v_idx_);
+    const char *mask = mask_idx_ >= 0 ? in_ptr(mask_idx_) : nullptr;
+    char *dst = static_cast<char *>(outputs[0].get_data_handle());
+    const size_t dt_size = memory::data_type_size(b0.q_md.get_data_type());
+    const size_t dst_dt_size
+            = memory::data_type_size(dst_md_[0].get_data_type());
+
+    float scale = 1.f;
+    if (scale_idx_ >= 0) {
+        const float s
+                = cpu::io::load_float_value(scale_dt_, in_ptr(scale_idx_), 0);
+        scale = scale_div_ ? 1.f / s : s;
+    }
+
+    // The key j is masked out for the query i when j > i + causal_shift.
+    const float inf = std::numeric_limits<float>::infinity();
+    const bool is_causal = causal_ != attn_mask_type::undef;
+    dim_t causal_shift = 0;
+    float causal_value = -inf;
+    if (causal_ == attn_mask_type::bottom_right) {
+        const auto load = [&](int idx) {
+            return cpu::io::load_int_value(
+                    inputs[idx].get_logical_tensor().data_type, in_ptr(idx),
+                    0);
+        };
+        causal_shift = load(s_kv_idx_) - load(s_q_idx_);
+    }
+    if (is_causal)
+        causal_value = cpu::io::load_float_value(
+                inputs[causal_value_idx_].get_logical_tensor().data_type,
+                in_ptr(causal_value_idx_), 0);
+    // Masked scores only vanish when they are set to -inf.
+    const bool skip_masked = is_causal && causal_value == -inf;
+
+    const memory::desc scratchpad_md({static_cast<dim_t>(scratchpad_size_)},
+            memory::data_type::u8, memory::format_tag::a);
+    const auto mem = [&](const memory::desc &md, const void *ptr) {
+        return memory(md, p_engine_, const_cast<void *>(ptr));
+    };
+
+    // Partial outputs of the work items, with their row maximums and sums.
+    const auto block_loop = [&](int ithr, int nthr) {
+        char *thr_buf = buf + ithr * thr_size;
+        float *s_buf = reinterpret_cast<float *>(thr_buf);
+        memory prim_scratchpad(
+                scratchpad_md, p_engine_, thr_buf + s_size + p_size);
+
+        // Work items are distributed cyclically, so that the work saved on
+        // the masked blocks of causal attention is shared by all threads.
+        for (dim_t w = ithr; w < work; w += nthr) {
+            const dim_t bh = w / (nqb * nchunks_);
+            const dim_t i0 = (w / nchunks_) % nqb * bq_;
+            const dim_t c0 = w % nchunks_ * chunk_;
+            const dim_t n = bh / heads_, h = bh % heads_;
+            const dim_t rq = std::min(bq_, lq_ - i0);
+
+            float *o_w = o_buf + w * bq_ * dv_;
+            float *max_w = max_buf + w * bq_, *sum_w = sum_buf + w * bq_;
+            std::fill(o_w, o_w + rq * dv_, 0.f);
+            std::fill(max_w, max_w + rq, -inf);
+            std::fill(sum_w, sum_w + rq, 0.f);
+
+            const char *q_i = q
+                    + (n * q_strides_[0] + h * q_strides_[1]
+                              + i0 * q_strides_[2])
+                            * dt_size;
+            const dim_t c_end = std::min(lk_, c0 + chunk_);
+            for (dim_t j0 = c0; j0 < c_end; j0 += bk_) {
+                // The first and the last keys that are visible to all and to
+                // some queries of the block.
+                const dim_t all_end = i0 + causal_shift + 1;
+                const dim_t some_end = all_end + rq - 1;
+                if (skip_masked && j0 >= some_end) break;
+                const dim_t rk = std::min(bk_, lk_ - j0);
+                const bool partly_masked = is_causal && j0 + rk > all_end;
+                const auto &b = prims_[rq != bq_][rk != bk_];
+
+                const char *k_j = k
+                        + (n * k_strides_[0] + h * k_strides_[1]
+                                  + j0 * k_strides_[2])
+                                * dt_size;
+                const char *v_j = v
+                        + (n * v_strides_[0] + h * v_strides_[1]
+                                  + j0 * v_strides_[2])
+                                * dt_size;
+
+                const memory s_mem = mem(b.s_md, s_buf);
+                b.scores.execute(strm,
+                        {{DNNL_ARG_SRC, mem(b.q_md, q_i)},
+                                {DNNL_ARG_WEIGHTS, mem(b.k_md, k_j)},
+                                {DNNL_ARG_DST, s_mem},
+                                {DNNL_ARG_SCRATCHPAD, prim_scratchpad}});
+                for (dim_t r = 0; r < rq; r++) {
+                    float *s = s_buf + r * rk;
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t i = 0; i < rk; i++)
+                        s[i] *= scale;
+                    if (partly_masked) {
+                        const dim_t visible = std::max<dim_t>(0,
+                                std::min(rk, all_end + r - j0));
+                        std::fill(s + visible, s + rk, causal_value);
+                    }
+                    if (mask) {
+                        const dim_t off = n * mask_strides_[0]
+                                + h * mask_strides_[1]
+                                + (i0 + r) * mask_strides_[2]
+                                + j0 * mask_strides_[3];
+                        for (dim_t i = 0; i < rk; i++)
+                            s[i] += cpu::io::load_float_value(
+                                    mask_dt_, mask, off + i * mask_strides_[3]);
+                    }
+
+                    // Online softmax: the partial output and sum are rescaled
+                    // to the new row maximum.
+                    float mx = max_w[r];
+                    PRAGMA_OMP_SIMD(reduction(max : mx))
+                    for (dim_t i = 0; i < rk; i++)
+                        mx = std::max(mx, s[i]);
+                    // Rows with all keys masked out so far contribute nothing.
+                    if (std::isinf(mx)) continue;
+                    const float alpha = std::exp(max_w[r] - mx);
+                    max_w[r] = mx;
+                    sum_w[r] *= alpha;
+                    float *o = o_w + r * dv_;
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t i = 0; i < dv_; i++)
+                        o[i] *= alpha;
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t i = 0; i < rk; i++)
+                        s[i] -= mx;
+                }
+                b.exp.execute(strm,
+                        {{DNNL_ARG_SRC, s_mem}, {DNNL_ARG_DST, s_mem},
+                                {DNNL_ARG_SCRATCHPAD, prim_scratchpad}});
+                for (dim_t r = 0; r < rq; r++) {
+                    float *p = s_buf + r * rk;
+                    if (std::isinf(max_w[r])) {
+                        std::fill(p, p + rk, 0.f);
+                        continue;
+                    }
+                    float acc = 0.f;
+                    PRAGMA_OMP_SIMD(reduction(+ : acc))
+                    for (dim_t i = 0; i < rk; i++)
+                        acc += p[i];
+                    sum_w[r] += acc;
+                }
+
+                memory p_mem = s_mem;
+                if (b.to_v_dt) {
+                    p_mem = mem(b.p_md, thr_buf + s_size);
+                    b.to_v_dt.execute(strm,
+                            {{DNNL_ARG_FROM, s_mem}, {DNNL_ARG_TO, p_mem},
+                                    {DNNL_ARG_SCRATCHPAD, prim_scratchpad}});
+                }
+                b.pv.execute(strm,
+                        {{DNNL_ARG_SRC, p_mem},
+                                {DNNL_ARG_WEIGHTS, mem(b.v_md, v_j)},
+                                {DNNL_ARG_DST, mem(b.o_md, o_w)},
+                                {DNNL_ARG_SCRATCHPAD, prim_scratchpad}});
+            }
+        }
+    };
+
+    // Merge of the partial outputs of the chunks of each block of queries
+    // into the partial output of its first chunk, which is then converted to
+    // the output.
+    const auto merge_loop = [&](int ithr, int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(pairs * nqb, nthr, ithr, start, end);
+        if (start == end) return;
+
+        memory prim_scratchpad(scratchpad_md, p_engine_,
+                buf + ithr * thr_size + s_size + p_size);
+        for (dim_t bq = start; bq < end; bq++) {
+            const dim_t bh = bq / nqb, i0 = bq % nqb * bq_;
+            const dim_t n = bh / heads_, h = bh % heads_;
+            const dim_t rq = std::min(bq_, lq_ - i0);
+            const dim_t w0 = bq * nchunks_;
+            for (dim_t r = 0; r < rq; r++) {
+                float *o = o_buf + (w0 * bq_ + r) * dv_;
+                float mx = -inf;
+                for (dim_t ic = 0; ic < nchunks_; ic++)
+                    mx = std::max(mx, max_buf[(w0 + ic) * bq_ + r]);
+                if (std::isinf(mx)) {
+                    // Softmax over keys which are all masked out.
+                    std::fill(o, o + dv_,
+                            inf_as_zero_
+                                    ? 0.f
+                                    : std::numeric_limits<float>::quiet_NaN());
+                    continue;
+                }
+                float total = 0.f;
+                for (dim_t ic = 0; ic < nchunks_; ic++) {
+                    const dim_t idx = (w0 + ic) * bq_ + r;
+                    max_buf[idx] = std::exp(max_buf[idx] - mx);
+                    total += max_buf[idx] * sum_buf[idx];
+                }
+                const float w0_scale = max_buf[w0 * bq_ + r] / total;
+                PRAGMA_OMP_SIMD()
+                for (dim_t i = 0; i < dv_; i++)
+                    o[i] *= w0_scale;
+                for (dim_t ic = 1; ic < nchunks_; ic++) {
+                    const float wc = max_buf[(w0 + ic) * bq_ + r] / total;
+                    const float *o_c = o + ic * bq_ * dv_;
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t i = 0; i < dv_; i++)
+                        o[i] += wc * o_c[i];
+                }
+            }
+            const int tq = rq != bq_;
+            char *dst_i = dst
+                    + (n * dst_strides_[0] + h * dst_strides_[1]
+                              + i0 * dst_strides_[2])
+                            * dst_dt_size;
+            dst_reorder_[tq].execute(strm,
+                    {{DNNL_ARG_FROM,
+                             mem(prims_[tq][0].o_md, o_buf + w0 * bq_ * dv_)},
+                            {DNNL_ARG_TO, mem(dst_md_[tq], dst_i)},
+                            {DNNL_ARG_SCRATCHPAD, prim_scratchpad}});
+        }
+    };
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    tp_stream->before_exec_hook();
+#endif
+    parallel(nthr, block_loop);
+    parallel(nthr, merge_loop);
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    tp_stream->after_exec_hook();
+#endif
+    return status::success;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
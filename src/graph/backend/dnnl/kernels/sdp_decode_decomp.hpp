@@ -0,0 +1,166 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_SDP_DECODE_DECOMP_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_SDP_DECODE_DECOMP_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "common/sdpa_types.hpp"
+
+#include "graph/backend/dnnl/kernels/kernel_base.hpp"
+
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+#include "graph/backend/dnnl/scratchpad.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Scaled dot-product attention decomposed into blocks of queries and keys in
+// the way of flash attention.
+//
+// The keys of a block of queries are processed block by block with an online
+// softmax: the partial output is rescaled whenever the running row maximum
+// grows, so the scores are never materialized beyond a block. When there are
+// fewer blocks of queries than threads, as in the decode phase of LLMs, the
+// keys are also split into chunks which are processed by different threads
+// in the way of flash decoding. The partial outputs of the chunks are then
+// rescaled by their maximums and merged into the output.
+//
+// Implicit causal masks are applied while computing the scores, and the
+// blocks of keys which are masked out for a whole block of queries are
+// skipped, which halves the work of causal attention. Blocks are processed
+// by single-threaded primitives created for each distinct block shape.
+struct sdp_decode_decomp_kernel_t : public kernel_base_t {
+private:
+    allocator_t *g_alloc_ = nullptr;
+
+    int nthr_ = 1;
+
+    // Q is {mb, heads, lq, dk}, K is {mb, heads, lk, dk} once transposed, V
+    // is {mb, heads, lk, dv} and the output is {mb, heads, lq, dv}.
+    dim_t mb_ = 0, heads_ = 0, lq_ = 0, lk_ = 0, dk_ = 0, dv_ = 0;
+    // Block sizes along the queries and the keys.
+    dim_t bq_ = 0, bk_ = 0;
+    // Number of keys in a chunk, a multiple of the key blocks, and number of
+    // chunks.
+    dim_t chunk_ = 0, nchunks_ = 0;
+
+    // Positions of the partition inputs.
+    size_t q_idx_ = 0, k_idx_ = 0, v_idx_ = 0;
+    int scale_idx_ = -1, mask_idx_ = -1;
+    // Whether the scale divides instead of multiplying.
+    bool scale_div_ = false;
+    // Whether rows with all keys masked out produce zeros.
+    bool inf_as_zero_ = false;
+
+    // Implicit causal mask, if any. The query i attends to the key j when
+    // i + s_kv - s_q >= j, where s_kv and s_q are scalar inputs for
+    // bottom-right masks and zero for top-left ones. Masked scores are set to
+    // the value of the input `causal_value_idx_`.
+    attn_mask_type_t causal_ = attn_mask_type::undef;
+    int s_kv_idx_ = -1, s_q_idx_ = -1;
+    size_t causal_value_idx_ = 0;
+
+    // Strides of Q, K, V, the output and the additive mask in the order of
+    // the shapes above. They are zero along the broadcast dimensions of K, V
+    // and the mask.
+    dims q_strides_, k_strides_, v_strides_, dst_strides_, mask_strides_;
+    data_type_t scale_dt_ = graph::data_type::undef,
+                mask_dt_ = graph::data_type::undef;
+
+    // Primitives for a block of queries and keys.
+    struct block_prims_t {
+        // S = Q K^T.
+        dnnl::primitive scores;
+        // P = exp(S), in place.
+        dnnl::primitive exp;
+        // Conversion of P to the data type of V, if different.
+        dnnl::primitive to_v_dt;
+        // O += P V.
+        dnnl::primitive pv;
+        memory::desc q_md, k_md, s_md, p_md, v_md, o_md;
+    };
+    // Indexed by whether the block is the last, partial, one along the
+    // queries and the keys.
+    block_prims_t prims_[2][2];
+
+    // Conversions of the merged output of a block of queries to the layout
+    // of the partition output.
+    dnnl::primitive dst_reorder_[2];
+    memory::desc dst_md_[2];
+
+    dnnl::primitive_attr attr_;
+    size_t scratchpad_size_ = 0;
+
+    status_t init_block_prims(dim_t rows_q, dim_t rows_k,
+            memory::data_type dt, block_prims_t &b);
+
+public:
+    status_t compile_impl(const dnnl_partition_impl_t *part,
+            const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) override;
+
+    status_t execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override;
+
+#ifdef DNNL_WITH_SYCL
+    status_t sycl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(sycl_deps);
+        UNUSED(sycl_event);
+        return status::unimplemented;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    status_t ocl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<cl_event> &cl_deps,
+            cl_event *ret_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(cl_deps);
+        UNUSED(ret_event);
+        return status::unimplemented;
+    }
+#endif
+
+    DEF_KERNEL_METHOD_STR(sdp_decode_decomp_kernel_t)
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -1662,6 +1662,98 @@ status_t layout_propagator_for_gen_index(std::shared_ptr<op_t> &op,
     return status;
 }
 
+status_t layout_propagator_for_embedding_bag(op_ptr &op,
+        const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+        pd_cache_t &pd_cache, subgraph_rewriter_t &rewriter) {
+    status_t status = status::success;
+
+    // Rows of the table are looked up as contiguous chunks of memory.
+    auto table_md = make_dnnl_memory_desc(
+            op->get_input_value(0)->get_logical_tensor());
+    const auto plain_table_md = dnnl::memory::desc(table_md.get_dims(),
+            table_md.get_data_type(), dnnl::memory::format_tag::ab);
+    if (table_md != plain_table_md) {
+        insert_reorder_before(
+                op, 0, plain_table_md, p_engine, mgr, pd_cache, rewriter);
+    }
+
+    const auto &pd = embedding_bag_executable_t::create_desc(
+            op, p_engine, mgr, pd_cache);
+
+    insert_reorder_after(
+            op, 0, pd.dst_desc(), p_engine, mgr, pd_cache, rewriter);
+    value_ptr dst = op->get_output_value(0);
+    status = fill_layout_info(dst, pd.dst_desc());
+    VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
+            "failed to fill layout info for reorder after embedding bag dst");
+
+    value_ptr scratchpad_val = op->get_output_value(1);
+    status = fill_layout_info(scratchpad_val, pd.scratchpad_desc());
+    return status;
+}
+
+status_t layout_propagator_for_topk(op_ptr &op, const dnnl::engine &p_engine,
+        fusion_info_mgr_t &mgr, pd_cache_t &pd_cache,
+        subgraph_rewriter_t &rewriter) {
+    status_t status = status::success;
+
+    // The selection is made over plain rows.
+    auto src_md = make_dnnl_memory_desc(
+            op->get_input_value(0)->get_logical_tensor());
+    const auto plain_src_md = dnnl::memory::desc(src_md.get_dims(),
+            src_md.get_data_type(), get_ncx_format(src_md.get_ndims()));
+    if (src_md != plain_src_md) {
+        insert_reorder_before(
+                op, 0, plain_src_md, p_engine, mgr, pd_cache, rewriter);
+    }
+
+    const auto &pd
+            = topk_executable_t::create_desc(op, p_engine, mgr, pd_cache);
+
+    insert_reorder_after(
+            op, 0, pd.dst_desc(0), p_engine, mgr, pd_cache, rewriter);
+    value_ptr dst = op->get_output_value(0);
+    status = fill_layout_info(dst, pd.dst_desc(0));
+    VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
+            "failed to fill layout info for reorder after topk dst");
+
+    insert_reorder_after(
+            op, 1, pd.dst_desc(1), p_engine, mgr, pd_cache, rewriter);
+    value_ptr indices = op->get_output_value(1);
+    status = fill_layout_info(indices, pd.dst_desc(1));
+    VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
+            "failed to fill layout info for reorder after topk indices");
+
+    value_ptr scratchpad_val = op->get_output_value(2);
+    status = fill_layout_info(scratchpad_val, pd.scratchpad_desc());
+    return status;
+}
+
+status_t layout_propagator_for_slice(op_ptr &op, const dnnl::engine &p_engine,
+        fusion_info_mgr_t &mgr, pd_cache_t &pd_cache,
+        subgraph_rewriter_t &rewriter) {
+    // A slice is addressed with the strides of its input, which requires a
+    // plain input.
+    value_ptr src = op->get_input_value(0);
+    if (!ltw(src->get_logical_tensor()).is_strided()) {
+        auto src_md = make_dnnl_memory_desc(src->get_logical_tensor());
+        const auto plain_src_md = dnnl::memory::desc(src_md.get_dims(),
+                src_md.get_data_type(), get_ncx_format(src_md.get_ndims()));
+        insert_reorder_before(
+                op, 0, plain_src_md, p_engine, mgr, pd_cache, rewriter);
+        src = op->get_input_value(0);
+    }
+
+    // The output is a view into the input buffer. A user given layout is kept
+    // and the slice is copied into it.
+    value_ptr dst = op->get_output_value(0);
+    if (ltw(dst->get_logical_tensor()).is_any()) {
+        dst->set_layout_type(layout_type::strided);
+        dst->set_strides(ltw(src->get_logical_tensor()).vstrides());
+    }
+    return status::success;
+}
+
 status_t layout_propagator_for_groupnorm(op_ptr &op,
         const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
         pd_cache_t &pd_cache, subgraph_rewriter_t &rewriter) {
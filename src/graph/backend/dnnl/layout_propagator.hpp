@@ -92,6 +92,9 @@ DECLARE_LAYOUT_PROPAGATOR(sub_zps);
 DECLARE_LAYOUT_PROPAGATOR(add_zps);
 DECLARE_LAYOUT_PROPAGATOR(groupnorm);
 DECLARE_LAYOUT_PROPAGATOR(gen_index);
+DECLARE_LAYOUT_PROPAGATOR(embedding_bag);
+DECLARE_LAYOUT_PROPAGATOR(topk);
+DECLARE_LAYOUT_PROPAGATOR(slice);
 DECLARE_LAYOUT_PROPAGATOR(mask);
 DECLARE_LAYOUT_PROPAGATOR(sdpa);
 DECLARE_LAYOUT_PROPAGATOR(host_scalar);
@@ -26,6 +26,7 @@
 #include <graph/utils/utils.hpp>
 
 #include "common/dnnl_thread.hpp"
+#include "common/primitive_desc_iface.hpp"
 #include "common/stream.hpp"
 
 #include "graph/backend/dnnl/common.hpp"
@@ -1487,6 +1488,99 @@ reduction_executable_t::desc_t reduction_executable_t::create_desc(
     return {pd, false};
 }
 
+embedding_bag_executable_t::desc_t embedding_bag_executable_t::create_desc(
+        std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+        fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
+    // first look up the cache
+    if (pd_cache.find(op.get()) != pd_cache.end()) {
+        auto pd = graph::utils::any_cast<dnnl::primitive_desc>(
+                pd_cache.at(op.get()));
+        return {pd, true};
+    }
+
+    dnnl::primitive_attr prm_attr;
+    if (op->has_attr(op_attr::fusion_info_key)
+            && op->get_attr<int64_t>(op_attr::fusion_info_key) != -1) {
+        int64_t key = op->get_attr<int64_t>(op_attr::fusion_info_key);
+        prm_attr = make_dnnl_primitive_attr(op, mgr.get_info(key));
+    }
+    prm_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+
+    const auto alg = static_cast<alg_kind_t>(
+            op->get_attr<int64_t>(op_attr::alg_kind));
+    const bool with_offsets = op->get_attr<bool>(op_attr::with_offsets);
+
+    auto table = make_dnnl_memory_desc(
+            op->get_input_value(0)->get_logical_tensor());
+    auto indices = make_dnnl_memory_desc(
+            op->get_input_value(1)->get_logical_tensor());
+    dnnl::memory::desc offsets;
+    if (with_offsets)
+        offsets = make_dnnl_memory_desc(
+                op->get_input_value(2)->get_logical_tensor());
+    auto dst = make_dnnl_memory_desc(
+            op->get_output_value(0)->get_logical_tensor());
+    dst = to_format_any(dst);
+
+    const auto gather_desc = create_gather_desc(
+            table.get(), indices.get(), offsets.get(), dst.get(), alg);
+    dnnl_primitive_desc_t c_pd = nullptr;
+    const status_t status = primitive_desc_create(&c_pd, p_engine.get(),
+            (const op_desc_t *)&gather_desc, nullptr, prm_attr.get());
+    dnnl::error::wrap_c_api(status,
+            "could not create a primitive descriptor for an embedding bag "
+            "primitive");
+    dnnl::primitive_desc pd(c_pd);
+
+    pd_cache.insert({op.get(), pd});
+
+    return {pd, false};
+}
+
+topk_executable_t::desc_t topk_executable_t::create_desc(
+        std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+        fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
+    // first look up the cache
+    if (pd_cache.find(op.get()) != pd_cache.end()) {
+        auto pd = graph::utils::any_cast<dnnl::primitive_desc>(
+                pd_cache.at(op.get()));
+        return {pd, true};
+    }
+
+    dnnl::primitive_attr prm_attr;
+    prm_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+
+    const auto alg = static_cast<alg_kind_t>(
+            op->get_attr<int64_t>(op_attr::alg_kind));
+    const auto k = op->get_attr<int64_t>(op_attr::k);
+    const bool with_softmax = op->get_attr<bool>(op_attr::with_softmax);
+
+    auto src = make_dnnl_memory_desc(
+            op->get_input_value(0)->get_logical_tensor());
+    auto axis = op->get_attr<int64_t>(op_attr::axis);
+    if (axis < 0) axis += src.get_ndims();
+    auto dst = make_dnnl_memory_desc(
+            op->get_output_value(0)->get_logical_tensor());
+    dst = to_format_any(dst);
+    auto indices = make_dnnl_memory_desc(
+            op->get_output_value(1)->get_logical_tensor());
+    indices = to_format_any(indices);
+
+    const auto topk_desc = create_topk_desc(src.get(), dst.get(),
+            indices.get(), alg, static_cast<int>(axis), k, with_softmax);
+    dnnl_primitive_desc_t c_pd = nullptr;
+    const status_t status = primitive_desc_create(&c_pd, p_engine.get(),
+            (const op_desc_t *)&topk_desc, nullptr, prm_attr.get());
+    dnnl::error::wrap_c_api(
+            status, "could not create a primitive descriptor for a topk "
+                    "primitive");
+    dnnl::primitive_desc pd(c_pd);
+
+    pd_cache.insert({op.get(), pd});
+
+    return {pd, false};
+}
+
 reorder_executable_t::desc_t reorder_executable_t::create_desc(
         std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
         fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
@@ -1983,6 +2077,15 @@ arg_indices_t memory_reparser_t::get_arg_indices(
     return arg_indices;
 }
 
+arg_indices_t slice_view_t::get_arg_indices(
+        const op_t *op, fusion_info_mgr_t &mgr) {
+    UNUSED(mgr);
+    arg_indices_t arg_indices;
+    arg_indices.insert({DNNL_ARG_FROM, indices_t {input, 0}});
+    arg_indices.insert({DNNL_ARG_TO, indices_t {output, 0}});
+    return arg_indices;
+}
+
 // for single-input-single-output op
 static arg_indices_t get_arg_indices_for_siso_op(
         const op_t *op, fusion_info_mgr_t &mgr) {
@@ -2043,6 +2146,52 @@ arg_indices_t reduction_executable_t::get_arg_indices(
     return get_arg_indices_for_siso_op(op, mgr);
 }
 
+arg_indices_t embedding_bag_executable_t::get_arg_indices(
+        const op_t *op, fusion_info_mgr_t &mgr) {
+    arg_indices_t arg_indices;
+
+    // add input args
+    size_t index = 0;
+    arg_indices.insert({DNNL_ARG_TABLE, indices_t {input, index++}});
+    arg_indices.insert({DNNL_ARG_INDICES, indices_t {input, index++}});
+    if (op->get_attr<bool>(op_attr::with_offsets)) {
+        arg_indices.insert({DNNL_ARG_OFFSETS, indices_t {input, index++}});
+    }
+
+    const fusion_info_t &fusion_info
+            = (op->has_attr(op_attr::fusion_info_key)
+                      && op->get_attr<int64_t>(op_attr::fusion_info_key) != -1)
+            ? mgr.get_info(op->get_attr<int64_t>(op_attr::fusion_info_key))
+            : fusion_info_t();
+
+    if (fusion_info.with_runtime_scales(true, 0)) {
+        arg_indices.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_TABLE,
+                indices_t {input, index++}});
+    }
+
+    get_arg_indices_for_post_ops(op, mgr, arg_indices, index);
+
+    // add output args
+    arg_indices.insert({DNNL_ARG_DST, indices_t {output, 0}});
+    arg_indices.insert({DNNL_ARG_SCRATCHPAD, indices_t {output, 1}});
+    return arg_indices;
+}
+
+arg_indices_t topk_executable_t::get_arg_indices(
+        const op_t *op, fusion_info_mgr_t &mgr) {
+    UNUSED(op);
+    UNUSED(mgr);
+    arg_indices_t arg_indices;
+
+    arg_indices.insert({DNNL_ARG_SRC, indices_t {input, 0}});
+
+    // add output args
+    arg_indices.insert({DNNL_ARG_DST, indices_t {output, 0}});
+    arg_indices.insert({DNNL_ARG_DST_INDICES, indices_t {output, 1}});
+    arg_indices.insert({DNNL_ARG_SCRATCHPAD, indices_t {output, 2}});
+    return arg_indices;
+}
+
 arg_indices_t resampling_executable_t::get_arg_indices(
         const op_t *op, fusion_info_mgr_t &mgr) {
     return get_arg_indices_for_siso_op(op, mgr);
@@ -24,8 +24,10 @@
 #include <type_traits>
 #include <unordered_map>
 
+#include "common/gather_utils.hpp"
 #include "common/primitive.hpp"
 #include "common/sdpa_utils.hpp"
+#include "common/topk_utils.hpp"
 
 #include "oneapi/dnnl/dnnl.hpp"
 #ifdef DNNL_WITH_SYCL
@@ -306,6 +308,79 @@ struct memory_reparser_t : public dummy_impl_t {
 #endif
 };
 
+// Memory planning binds the output of a slice to its place in the input
+// buffer, in which case there is nothing to do. Otherwise (e.g. the output is
+// a user buffer) the slice is copied. Slices are only created for CPU engines.
+struct slice_view_t : public dummy_impl_t {
+    DECLARE_ARG_INDICES_GETTER;
+
+    slice_view_t(std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+            fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
+        UNUSED(mgr);
+        UNUSED(pd_cache);
+        const auto src_md = make_dnnl_memory_desc(
+                op->get_input_value(0)->get_logical_tensor());
+        const auto dst_md = make_dnnl_memory_desc(
+                op->get_output_value(0)->get_logical_tensor());
+        auto axis = op->get_attr<int64_t>(op_attr::axis);
+        if (axis < 0) axis += src_md.get_ndims();
+        offset_ = op->get_attr<int64_t>(op_attr::slice_begin)
+                * src_md.get_strides()[axis]
+                * memory::data_type_size(src_md.get_data_type());
+        // the slice as seen through the input strides
+        view_md_ = memory::desc(dst_md.get_dims(), dst_md.get_data_type(),
+                src_md.get_strides());
+        // the copy for an unaliased output is created once at compilation
+        copy_ = dnnl::reorder(dnnl::reorder::primitive_desc(
+                p_engine, view_md_, p_engine, dst_md));
+    }
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override {
+        auto from = args.find(DNNL_ARG_FROM);
+        auto to = args.find(DNNL_ARG_TO);
+        if (from == args.end() || to == args.end()) return;
+
+        char *view_handle
+                = static_cast<char *>(from->second.get_data_handle()) + offset_;
+        if (view_handle == to->second.get_data_handle()) {
+            dummy_impl_t::execute(stream, args);
+        } else {
+            const memory view_mem = make_dnnl_memory(
+                    view_md_, from->second.get_engine(), view_handle);
+            copy_.execute(stream,
+                    {{DNNL_ARG_FROM, view_mem}, {DNNL_ARG_TO, to->second}});
+        }
+    }
+
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps) const override {
+        auto from = args.find(DNNL_ARG_FROM);
+        auto to = args.find(DNNL_ARG_TO);
+        if (from == args.end() || to == args.end()) return {};
+
+        char *view_handle
+                = static_cast<char *>(from->second.get_data_handle()) + offset_;
+        if (view_handle == to->second.get_data_handle())
+            return dummy_impl_t::execute_sycl(stream, args, deps);
+
+        const memory view_mem = make_dnnl_memory(
+                view_md_, from->second.get_engine(), view_handle);
+        auto e = dnnl::sycl_interop::execute(copy_, stream,
+                {{DNNL_ARG_FROM, view_mem}, {DNNL_ARG_TO, to->second}}, deps);
+        if (stream.get_engine().get_kind() == engine::kind::cpu) e.wait();
+        return e;
+    }
+#endif
+
+private:
+    size_t offset_ = 0;
+    memory::desc view_md_;
+    dnnl::reorder copy_;
+};
+
 template <op_attr_t attr_name, typename attr_dt, typename target_dt>
 struct const_memory_filler_t : public op_executable_t {
     static arg_indices_t get_arg_indices(
@@ -1170,12 +1245,24 @@ struct concat_executable_t : public op_executable_t {
 
     concat_executable_t(std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
             fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
+        // all the inputs were already written into the output buffer by their
+        // producers, so there is nothing left to copy
+        if (op->has_attr(op_attr::is_zero_copy)
+                && op->get_attr<bool>(op_attr::is_zero_copy)) {
+            is_dummy_ = true;
+            return;
+        }
+
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
         prim_ = dnnl::concat(desc);
     }
 
     void execute(const stream &stream,
             const std::unordered_map<int, memory> &args) const override {
+        if (is_dummy_) {
+            dummy_impl_.execute(stream, args);
+            return;
+        }
         prim_.execute(stream, args);
     }
 
@@ -1183,6 +1270,7 @@ struct concat_executable_t : public op_executable_t {
     ::sycl::event execute_sycl(const stream &stream,
             const std::unordered_map<int, memory> &args,
             const std::vector<::sycl::event> &deps) const override {
+        if (is_dummy_) { return dummy_impl_.execute_sycl(stream, args, deps); }
         auto e = dnnl::sycl_interop::execute(prim_, stream, args, deps);
         if (stream.get_engine().get_kind() == engine::kind::cpu) e.wait();
         return e;
@@ -1193,6 +1281,7 @@ struct concat_executable_t : public op_executable_t {
     cl_event execute_ocl(const stream &stream,
             const std::unordered_map<int, memory> &args,
             const std::vector<cl_event> &deps) const override {
+        if (is_dummy_) { return dummy_impl_.execute_ocl(stream, args, deps); }
         auto e = dnnl::ocl_interop::execute(prim_, stream, args, deps);
         return e;
     }
@@ -1200,6 +1289,8 @@ struct concat_executable_t : public op_executable_t {
 
 private:
     dnnl::concat prim_;
+    bool is_dummy_ {false};
+    dummy_impl_t dummy_impl_;
 };
 
 struct shuffle_executable_t : public op_executable_t {
@@ -2592,6 +2683,129 @@ private:
     bool with_sum_ {false};
 };
 
+// The gather primitive is internal and has no C++ API class, so the executable
+// holds a generic dnnl::primitive created from its primitive descriptor.
+struct embedding_bag_executable_t : public op_executable_t {
+    DECLARE_DESC_CLASS_AND_CREATOR(dnnl::primitive_desc);
+    DECLARE_ARG_INDICES_GETTER;
+
+    embedding_bag_executable_t(std::shared_ptr<op_t> &op,
+            const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+            pd_cache_t &pd_cache) {
+        auto desc = create_desc(op, p_engine, mgr, pd_cache);
+        prim_ = dnnl::primitive(desc);
+
+        if (op->has_attr(op_attr::with_sum))
+            with_sum_ = op->get_attr<bool>(op_attr::with_sum);
+    }
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override {
+        if (with_sum_) {
+            const memory &psrc_mem = args.find(DNNL_GRAPH_ARG_POST_SRC)->second;
+            const memory &dst_mem = args.find(DNNL_ARG_DST)->second;
+            if (psrc_mem.get_data_handle() != dst_mem.get_data_handle()) {
+                dnnl::reorder(psrc_mem, dst_mem)
+                        .execute(stream, const_cast<memory &>(psrc_mem),
+                                const_cast<memory &>(dst_mem));
+            }
+        }
+
+        prim_.execute(stream, args);
+    }
+
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps) const override {
+        auto sycl_deps = deps;
+        if (with_sum_) {
+            const memory &psrc_mem = args.find(DNNL_GRAPH_ARG_POST_SRC)->second;
+            const memory &dst_mem = args.find(DNNL_ARG_DST)->second;
+            if (psrc_mem.get_data_handle() != dst_mem.get_data_handle()) {
+                auto prim = dnnl::reorder(psrc_mem, dst_mem);
+                auto e = dnnl::sycl_interop::execute(prim, stream,
+                        {{DNNL_ARG_FROM, const_cast<memory &>(psrc_mem)},
+                                {DNNL_ARG_TO, const_cast<memory &>(dst_mem)}},
+                        sycl_deps);
+                sycl_deps = {e};
+            }
+        }
+
+        auto e = dnnl::sycl_interop::execute(prim_, stream, args, sycl_deps);
+        if (stream.get_engine().get_kind() == engine::kind::cpu) e.wait();
+        return e;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps) const override {
+        auto ocl_deps = deps;
+        if (with_sum_) {
+            const memory &psrc_mem = args.find(DNNL_GRAPH_ARG_POST_SRC)->second;
+            const memory &dst_mem = args.find(DNNL_ARG_DST)->second;
+            if (psrc_mem.get_data_handle() != dst_mem.get_data_handle()) {
+                auto prim = dnnl::reorder(psrc_mem, dst_mem);
+                auto e = dnnl::ocl_interop::execute(prim, stream,
+                        {{DNNL_ARG_FROM, const_cast<memory &>(psrc_mem)},
+                                {DNNL_ARG_TO, const_cast<memory &>(dst_mem)}},
+                        ocl_deps);
+                ocl_deps = {e};
+            }
+        }
+
+        auto e = dnnl::ocl_interop::execute(prim_, stream, args, ocl_deps);
+        return e;
+    }
+#endif
+
+private:
+    dnnl::primitive prim_;
+    bool with_sum_ {false};
+};
+
+// Like the gather primitive, top-k is internal and executed through a generic
+// dnnl::primitive.
+struct topk_executable_t : public op_executable_t {
+    DECLARE_DESC_CLASS_AND_CREATOR(dnnl::primitive_desc);
+    DECLARE_ARG_INDICES_GETTER;
+
+    topk_executable_t(std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+            fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
+        auto desc = create_desc(op, p_engine, mgr, pd_cache);
+        prim_ = dnnl::primitive(desc);
+    }
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override {
+        prim_.execute(stream, args);
+    }
+
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps) const override {
+        auto e = dnnl::sycl_interop::execute(prim_, stream, args, deps);
+        if (stream.get_engine().get_kind() == engine::kind::cpu) e.wait();
+        return e;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps) const override {
+        auto e = dnnl::ocl_interop::execute(prim_, stream, args, deps);
+        return e;
+    }
+#endif
+
+private:
+    dnnl::primitive prim_;
+};
+
 struct groupnorm_executable_t : public op_executable_t {
     DECLARE_DESC_CLASS_AND_CREATOR(
             dnnl::group_normalization_forward::primitive_desc);
@@ -14,8 +14,11 @@
  * limitations under the License.
  *******************************************************************************/
 
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "oneapi/dnnl/dnnl.hpp"
@@ -25,6 +28,7 @@
 
 #include "graph/backend/dnnl/common.hpp"
 #include "graph/backend/dnnl/layout_propagator.hpp"
+#include "graph/backend/dnnl/passes/transform.hpp"
 
 #define VCHECK_LAYOUT_PROPAGATION(cond, status, msg, ...) \
     VCONDCHECK(graph, create, check, layout_propagation, (cond), status, msg, \
@@ -182,6 +186,149 @@ status_t layout_propagation(std::shared_ptr<subgraph_t> &sg) {
     return status::success;
 }
 
+namespace {
+
+// The layouts assigned to a copy of a subgraph, with their cost in bytes.
+struct layout_trial_t {
+    // Bytes read and written by the reorders which are executed for each
+    // execution, plus the penalty of the pinned ops.
+    size_t cost = 0;
+    // Description of the reorders, for debugging.
+    std::string reorders;
+    // Convolutions of the original subgraph which write their output in a
+    // blocked layout.
+    std::vector<op_t *> candidates;
+};
+
+bool is_pinnable(const op_t *op, const fusion_info_mgr_t &mgr) {
+    if (op->get_kind() != op_kind::dnnl_convolution) return false;
+    // The base convolution dst of a fused depthwise convolution is not in the
+    // subgraph.
+    if (op->has_attr(op_attr::fusion_info_key)
+            && op->get_attr<int64_t>(op_attr::fusion_info_key) != -1
+            && mgr.get_info(op->get_attr<int64_t>(op_attr::fusion_info_key))
+                       .has_post_dw_conv())
+        return false;
+    const auto dst = op->get_output_value(0);
+    return !dst->get_consumers().empty()
+            && ltw(dst->get_logical_tensor()).is_any();
+}
+
+// Makes the op write its output in plain nxc layout. Convolutions then use
+// the optimal src layout together with the plain dst.
+void pin_plain_output(op_t *op) {
+    const auto dst = op->get_output_value(0);
+    dst->set_strides(get_nxc_strides(ltw(dst->get_logical_tensor()).vdims()));
+}
+
+size_t get_size(const value_t *val) {
+    return make_dnnl_memory_desc(val->get_logical_tensor()).get_size();
+}
+
+// Propagates the layouts on a copy of the subgraph where the ops in `pinned`
+// write their output in plain layout, and fuses the adjacent reorders.
+status_t try_layouts(const std::shared_ptr<subgraph_t> &sg,
+        const std::unordered_set<op_t *> &pinned, layout_trial_t &trial) {
+    const auto &ops = sg->get_ops();
+    const auto copied_ops = graph_t::deep_copy(ops);
+    auto copy = std::make_shared<subgraph_t>(copied_ops, *(sg->p_engine_),
+            sg->get_fpmath_mode(),
+            sg->fusion_info_mgr_.get_use_blocked_layout(), false);
+    copy->fusion_info_mgr_.copy_info_from(sg->fusion_info_mgr_);
+    copy->ins_ = sg->ins_;
+    copy->outs_ = sg->outs_;
+
+    std::unordered_map<const op_t *, op_t *> origin;
+    for (size_t i = 0; i < ops.size(); i++) {
+        origin[copied_ops[i].get()] = ops[i].get();
+        if (pinned.count(ops[i].get())) {
+            pin_plain_output(copied_ops[i].get());
+            // Writing a plain output is assumed to cost the kernel of a
+            // compute bound op one more pass over its output.
+            trial.cost += get_size(copied_ops[i]->get_output_value(0).get());
+        }
+    }
+    CHECK(layout_propagation(copy));
+    CHECK(fuse_adjacent_reorders(copy));
+
+    return topo_order_visit(copy->get_output_ops(), [&](op_t *op) {
+        const auto it = origin.find(op);
+        if (it != origin.end()
+                && is_pinnable(it->second, sg->fusion_info_mgr_)
+                && !pinned.count(it->second)
+                && !is_plain(make_dnnl_memory_desc(
+                        op->get_output_value(0)->get_logical_tensor())))
+            trial.candidates.push_back(it->second);
+
+        if (op->get_kind() != op_kind::dnnl_reorder) return status::success;
+        // Reorders of constant tensors are cached and executed once.
+        const auto src = op->get_input_value(0);
+        if (ltw(src->get_logical_tensor()).property_type()
+                == property_type::constant)
+            return status::success;
+        const auto dst = op->get_output_value(0);
+        const size_t bytes = get_size(src.get()) + get_size(dst.get());
+        trial.cost += bytes;
+        const auto src_md = make_dnnl_memory_desc(src->get_logical_tensor());
+        const auto dst_md = make_dnnl_memory_desc(dst->get_logical_tensor());
+        const auto tag = [](const dnnl::memory::desc &md) {
+            return md.get_format_kind() == format_kind::blocked
+                    ? get_format_tag_str(md)
+                    : std::string("opaque");
+        };
+        trial.reorders += " " + op->get_name() + ":" + tag(src_md) + "->"
+                + tag(dst_md) + ":" + std::to_string(bytes);
+        return status::success;
+    });
+}
+} // namespace
+
+status_t layout_assignment(std::shared_ptr<subgraph_t> &sg) {
+    // The trials copy the subgraph and propagate the layouts over it, which
+    // is only worth it when some output can be pinned to a plain layout.
+    const auto &ops = sg->get_ops();
+    if (std::none_of(ops.begin(), ops.end(),
+                [&](const std::shared_ptr<op_t> &op) {
+                    return is_pinnable(op.get(), sg->fusion_info_mgr_);
+                }))
+        return layout_propagation(sg);
+
+    std::unordered_set<op_t *> pinned;
+    layout_trial_t best;
+    // Errors are reported by the propagation on the subgraph itself.
+    if (try_layouts(sg, pinned, best) != status::success)
+        return layout_propagation(sg);
+    const std::string greedy_reorders = best.reorders;
+    const size_t greedy_cost = best.cost;
+
+    // The choices are made one convolution at a time in topological order:
+    // each trial propagates the layouts over the whole subgraph, so that the
+    // reorders which the choice adds downstream are accounted for. The number
+    // of trials is bounded to keep the compilation time in check.
+    const size_t max_trials = 16;
+    const std::vector<op_t *> candidates = best.candidates;
+    for (size_t i = 0; i < candidates.size() && i < max_trials; i++) {
+        pinned.insert(candidates[i]);
+        layout_trial_t trial;
+        if (try_layouts(sg, pinned, trial) == status::success
+                && trial.cost < best.cost) {
+            best = trial;
+            continue;
+        }
+        pinned.erase(candidates[i]);
+    }
+
+    VDEBUGINFO(1, graph, layout_assignment, "before,cost:%zu,reorders:%s",
+            greedy_cost, greedy_reorders.c_str());
+    VDEBUGINFO(1, graph, layout_assignment,
+            "after,cost:%zu,plain_outputs:%zu,reorders:%s", best.cost,
+            pinned.size(), best.reorders.c_str());
+
+    for (op_t *op : pinned)
+        pin_plain_output(op);
+    return layout_propagation(sg);
+}
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
@@ -33,6 +33,14 @@ namespace dnnl_impl {
 
 status_t layout_propagation(std::shared_ptr<subgraph_t> &sg);
 
+/// This pass chooses the layouts of a subgraph over the whole subgraph instead
+/// of op by op. Layout propagation picks the optimal layout of each compute
+/// bound op, which may cost more in reorders than it saves in kernel time. The
+/// pass tries writing the output of convolutions in plain layout on copies of
+/// the subgraph, keeps the choices which reduce the cost, and then propagates
+/// the chosen layouts in the subgraph.
+status_t layout_assignment(std::shared_ptr<subgraph_t> &sg);
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
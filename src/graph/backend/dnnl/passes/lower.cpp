@@ -884,6 +884,46 @@ static status_t gen_index_handler(
     return status::success;
 }
 
+static status_t embedding_bag_handler(
+        const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
+    auto new_op = std::make_shared<op_t>(op_kind::dnnl_embedding_bag);
+    new_op->merge_attributes(op->get_attributes());
+
+    const std::string mode = op->has_attr(op_attr::mode)
+            ? op->get_attr<std::string>(op_attr::mode)
+            : "sum";
+    dnnl::algorithm alg = dnnl::algorithm::reduction_sum;
+    if (mode == "mean")
+        alg = dnnl::algorithm::reduction_mean;
+    else if (mode == "max")
+        alg = dnnl::algorithm::reduction_max;
+    new_op->set_attr<int64_t>(op_attr::alg_kind, static_cast<int64_t>(alg));
+    // Offsets are optional and the number of inputs changes once scales and
+    // post-ops are fused, so record their presence explicitly.
+    new_op->set_attr<bool>(op_attr::with_offsets, op->num_inputs() == 3);
+
+    rewriter.replace_op(op, new_op);
+    insert_empty_scratchpad(new_op);
+    return status::success;
+}
+
+static status_t topk_handler(
+        const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
+    auto new_op = std::make_shared<op_t>(op_kind::dnnl_topk);
+    new_op->merge_attributes(op->get_attributes());
+
+    const std::string mode = op->has_attr(op_attr::mode)
+            ? op->get_attr<std::string>(op_attr::mode)
+            : "max";
+    const dnnl::algorithm alg = mode == "min" ? dnnl::algorithm::reduction_min
+                                              : dnnl::algorithm::reduction_max;
+    new_op->set_attr<int64_t>(op_attr::alg_kind, static_cast<int64_t>(alg));
+
+    rewriter.replace_op(op, new_op);
+    insert_empty_scratchpad(new_op);
+    return status::success;
+}
+
 #define ITEM(kind, func) \
     { \
         graph::op_kind::kind, handler_func { (func) } \
@@ -996,6 +1036,8 @@ static const std::unordered_map<graph::op_kind_t, handler_func> handler_table {
         ITEM(SquaredDifference, squared_difference_handler),
         ITEM(Select, select_handler),
         ITEM(GenIndex, gen_index_handler),
+        ITEM(EmbeddingBag, embedding_bag_handler),
+        ITEM(TopK, topk_handler),
         // utility
         ITEM(Wildcard, dummy_handler),
         ITEM(End, dummy_handler),
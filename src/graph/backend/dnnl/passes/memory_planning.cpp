@@ -232,6 +232,14 @@ std::shared_ptr<execution_args_set_t> execution_args_set_t::clone() const {
                 mem_offkey.second);
     }
 
+    ret->mems_use_sub_buffers_.reserve(mems_use_sub_buffers_.size());
+    for (const auto &info : mems_use_sub_buffers_) {
+        ret->mems_use_sub_buffers_.push_back(
+                {ret->value_mem_map_.at(find_val(info.mem)),
+                        ret->value_mem_map_.at(find_val(info.base)),
+                        info.offset});
+    }
+
     ret->topo_ordered_exec_args_.reserve(topo_ordered_exec_args_.size());
     for (const auto &args : topo_ordered_exec_args_) {
         std::unordered_map<int, memory> new_args;
@@ -256,6 +264,7 @@ void execution_args_set_t::clear() {
     mems_use_external_outputs_.clear();
     mems_use_internal_temporary_.clear();
     mems_use_internal_persistent_.clear();
+    mems_use_sub_buffers_.clear();
     value_mem_map_.clear();
     topo_ordered_exec_args_.clear();
     host_scalar_infos_.clear();
@@ -330,6 +339,142 @@ std::vector<const value_t *> alias_analyzer_t::get_all_aliases(
     return ret;
 }
 
+// Bind the output of slice ops to its place in the slice input buffer, so that
+// the slice doesn't need to copy anything. The output is described with the
+// input strides, and a view is only created when nothing else may take the
+// output buffer as a whole: the output must not be aliased. As for concat
+// slices, this is only valid for CPU memory.
+status_t memory_planner_t::plan_slice_views(std::shared_ptr<subgraph_t> &sg) {
+    if (sg->p_engine_->get_kind() != dnnl::engine::kind::cpu)
+        return status::success;
+
+    for (auto &cur_op : sg->get_ops()) {
+        if (cur_op->get_kind() != op_kind::dnnl_slice) continue;
+
+        value_t *src = cur_op->get_input_value(0).get();
+        value_t *dst = cur_op->get_output_value(0).get();
+        const logical_tensor_t src_lt = src->get_logical_tensor();
+        const logical_tensor_t dst_lt = dst->get_logical_tensor();
+        if (!ltw(src_lt).is_strided() || !ltw(dst_lt).is_strided()) continue;
+        // views are bound after their bases, so a base can't be a view
+        const bool src_is_view = src->has_producer()
+                && src->get_producer().get_kind() == op_kind::dnnl_slice;
+        if (src_is_view || !alias_analyzer_.get_alias_outputs(dst).empty())
+            continue;
+
+        const auto res = utils::try_reverse_axis(
+                cur_op->get_attr<int64_t>(op_attr::axis), src_lt.ndims);
+        if (!res.first) continue;
+        const auto axis = res.second;
+
+        // the layout propagator gives the output the input strides
+        if (ltw(src_lt).vstrides() != ltw(dst_lt).vstrides()) continue;
+
+        const size_t offset = cur_op->get_attr<int64_t>(op_attr::slice_begin)
+                * src_lt.layout.strides[axis]
+                * dnnl::memory::data_type_size(
+                        static_cast<dnnl::memory::data_type>(src_lt.data_type));
+        views_[dst] = {src, offset};
+    }
+    return status::success;
+}
+
+// Find concat ops whose inputs can all be written by their producers directly
+// into the corresponding slices of the concat output buffer, so that the concat
+// itself doesn't need to copy anything. This is possible when:
+// - the inputs are internal edges only consumed by the concat, and are not
+//   sharing buffers with other edges (alias or inplace),
+// - the concat output has a plain strided layout, so every slice can be
+//   described with the output strides and a byte offset,
+// - the producers can write a slice: either the slice has the same strides as
+//   the producer output already (e.g. concat on the outermost dimension), or
+//   the producer is a reorder which handles arbitrary strides.
+// Slices are bound with a pointer offset into the concat output buffer, which
+// is only valid for CPU memory.
+status_t memory_planner_t::plan_concat_slices(
+        std::shared_ptr<subgraph_t> &sg, fusion_info_mgr_t &mgr) {
+    if (sg->p_engine_->get_kind() != dnnl::engine::kind::cpu)
+        return status::success;
+
+    const auto sg_outputs = sg->get_output_values();
+    auto is_constant_op = [](const op_t &op) {
+        return op.has_attr(op_attr::is_constant)
+                && op.get_attr<bool>(op_attr::is_constant);
+    };
+
+    for (auto &cur_op : sg->get_ops()) {
+        if (cur_op->get_kind() != op_kind::dnnl_concat) continue;
+        cur_op->set_attr<bool>(op_attr::is_zero_copy, false);
+        if (is_constant_op(*cur_op)) continue;
+        if (cur_op->has_attr(op_attr::fusion_info_key)
+                && cur_op->get_attr<int64_t>(op_attr::fusion_info_key) != -1)
+            continue;
+
+        value_t *dst = cur_op->get_output_value(0).get();
+        const logical_tensor_t dst_lt = dst->get_logical_tensor();
+        if (!ltw(dst_lt).is_strided() || ltw(dst_lt).has_zero_dim()) continue;
+
+        const auto res = utils::try_reverse_axis(
+                cur_op->get_attr<int64_t>(op_attr::axis), dst_lt.ndims);
+        if (!res.first) continue;
+        const auto axis = res.second;
+
+        const auto dst_strides = ltw(dst_lt).vstrides();
+        const size_t axis_stride_bytes = dst_strides[axis]
+                * dnnl::memory::data_type_size(
+                        static_cast<dnnl::memory::data_type>(dst_lt.data_type));
+
+        bool ok = true;
+        std::vector<bool> need_restride(cur_op->num_inputs(), false);
+        for (size_t i = 0; i < cur_op->num_inputs() && ok; ++i) {
+            value_t *src = cur_op->get_input_value(i).get();
+            const logical_tensor_t src_lt = src->get_logical_tensor();
+            ok = src->has_producer() && src->get_consumers().size() == 1
+                    && std::find(sg_outputs.begin(), sg_outputs.end(), src)
+                            == sg_outputs.end()
+                    && ltw(src_lt).is_strided()
+                    && src_lt.data_type == dst_lt.data_type
+                    && alias_analyzer_.get_alias_input(src) == nullptr
+                    && alias_analyzer_.get_alias_outputs(src).empty()
+                    && views_.count(src) == 0;
+            if (!ok) break;
+
+            op_t &producer = src->get_producer();
+            ok = !is_constant_op(producer);
+            for (const auto &pair : get_op_inplace_pairs(producer, mgr)) {
+                if (pair.out_idx_ == src->get_offset()) ok = false;
+            }
+            if (!ok) break;
+
+            // strides of unit dimensions don't affect addressing
+            const auto src_dims = ltw(src_lt).vdims();
+            const auto src_strides = ltw(src_lt).vstrides();
+            for (int d = 0; d < dst_lt.ndims; ++d) {
+                if (src_dims[d] != 1 && src_strides[d] != dst_strides[d])
+                    need_restride[i] = true;
+            }
+            ok = !need_restride[i]
+                    || producer.get_kind() == op_kind::dnnl_reorder;
+        }
+        if (!ok) continue;
+
+        size_t offset = 0;
+        for (size_t i = 0; i < cur_op->num_inputs(); ++i) {
+            value_t *src = cur_op->get_input_value(i).get();
+            if (need_restride[i]) {
+                src->set_strides(dst_strides);
+                // the reorder was created for the dense layout during layout
+                // propagation
+                sg->pd_cache_.erase(&src->get_producer());
+            }
+            views_[src] = {dst, offset};
+            offset += src->get_logical_tensor().dims[axis] * axis_stride_bytes;
+        }
+        cur_op->set_attr<bool>(op_attr::is_zero_copy, true);
+    }
+    return status::success;
+}
+
 // Assign partition's input edges to user given external inputs buffer. Those
 // external inputs buffers may be used by other partition (which is under the
 // control of user), so we can't reuse them.
@@ -533,6 +678,8 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
                 value_t *in = op->get_input_value(pair.in_idx_).get();
                 assign_info_t info = buffer_assignments_.at(in);
                 if (info.kind_ != internal_temporary) continue;
+                // the output would be bound to the start of the buffer
+                if (views_.count(in)) continue;
 
                 bool reuse_in_buffer
                         = temporary_buffer_ref_count[info.index_] == 1;
@@ -552,6 +699,29 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
             // already assigned buffer, skip it
             if (buffer_assignments_.count(out.get())) continue;
 
+            // a view shares the buffer of its base. For concat slices, it is
+            // requested when the first slice is produced so that it stays
+            // alive while the other slices are written
+            auto view = views_.find(out.get());
+            if (view != views_.end()) {
+                value_t *base = const_cast<value_t *>(view->second.base_);
+                if (!buffer_assignments_.count(base)) {
+                    size_t idx = temporary_buffer_assigner_.request(
+                            make_dnnl_memory_desc(base->get_logical_tensor())
+                                    .get_size());
+                    buffer_assignments_.insert(std::make_pair(
+                            base, assign_info_t(internal_temporary, idx)));
+                    temporary_buffer_ref_count[idx] = edge_ref_count.at(base);
+                }
+                assign_info_t info = buffer_assignments_.at(base);
+                buffer_assignments_.insert(std::make_pair(out.get(), info));
+                if (info.kind_ == internal_temporary) {
+                    temporary_buffer_ref_count[info.index_]
+                            += edge_ref_count.at(out.get());
+                }
+                continue;
+            }
+
             // this output need a new buffer, record it
             auto lt = out->get_logical_tensor();
             size_t idx = temporary_buffer_assigner_.request(
@@ -752,6 +922,10 @@ status_t memory_planner_t::prepare_execution_args_set(
 
     auto classify_mem = [&, this](const dnnl::memory &mem, const value_t *val) {
         const assign_info_t &info = buffer_assignments_.at(val);
+        // views are bound after their bases, see below
+        if (views_.count(val)
+                && buffer_assignments_.at(views_.at(val).base_) == info)
+            return;
         switch (info.kind_) {
             case external_input:
                 exec_args_set_.add_mem_use_external_inputs({mem, info.index_});
@@ -805,6 +979,20 @@ status_t memory_planner_t::prepare_execution_args_set(
     VCHECK_MEMORY_PLANNING(
             ret == status::success, ret, "prepare memory failed");
 
+    // a view which didn't end up in the buffer of its base (e.g. a slice
+    // output given to the user) has its own buffer and is copied
+    for (const auto &view : views_) {
+        if (buffer_assignments_.at(view.first)
+                != buffer_assignments_.at(view.second.base_))
+            continue;
+        dnnl::memory mem, base;
+        exec_args_set_.find_value_mem_map(
+                const_cast<value_t *>(view.first), mem);
+        exec_args_set_.find_value_mem_map(
+                const_cast<value_t *>(view.second.base_), base);
+        exec_args_set_.add_mem_use_sub_buffer({mem, base, view.second.offset_});
+    }
+
     // construct the dnnl execution args for each op
     ret = topo_order_visit(sg->get_output_ops(), [&](op_t *op) {
         const op_schema_t *opm
@@ -858,6 +1046,7 @@ status_t memory_planner_t::prepare_execution_args_set(
 // In this function, we will do the following things:
 // - Build the alias map. both the key and value in the map are edges. the key
 //   is the alias of value.
+// - Find concat inputs that can be written directly into the concat output.
 // - Count the reference count of each edges. the reference count will be used
 //   during assign temporary buffer to determine which edge's buffer can be
 //   reused since it ref count reduce to zero.
@@ -900,6 +1089,11 @@ status_t memory_planner_t::run(std::shared_ptr<subgraph_t> &sg) {
         }
     }
 
+    // Let slice outputs point into the slice inputs, and producers of concat
+    // inputs write directly into the concat output
+    CHECK(plan_slice_views(sg));
+    CHECK(plan_concat_slices(sg, mgr));
+
     // Assign external_input buffers to subgraph's inputs and their alias
     CHECK(assign_external_inputs_buffer(sg, inputs));
 
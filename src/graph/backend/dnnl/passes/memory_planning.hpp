@@ -51,6 +51,17 @@ struct host_scalar_info_t {
     memory::desc md;
 };
 
+// info needed to bind a memory which is a view into another buffer, such as a
+// concat input written directly into its slice of the concat output
+struct sub_buffer_info_t {
+    // the memory object of the view
+    memory mem;
+    // the memory object of the buffer the view points into
+    memory base;
+    // byte offset of the view from the start of the base buffer
+    size_t offset;
+};
+
 // This execution_args_set_t class is used to hold the dnnl memory objects which
 // are used when executing a compiled subgraph in a thread. This class should
 // only be generated by the memory_planner_t class. When executing subgraph in
@@ -102,6 +113,12 @@ public:
         return mems_use_internal_persistent_;
     }
 
+    // The data handles of these memories should be updated after all the
+    // other ones since they are computed from the handles of their bases.
+    const std::vector<sub_buffer_info_t> &get_mems_use_sub_buffers() const {
+        return mems_use_sub_buffers_;
+    }
+
     std::vector<dnnl::memory::desc> get_persistent_mem_desc_list() const {
         std::vector<dnnl::memory::desc> mds;
         mds.reserve(mems_use_internal_persistent_.size());
@@ -157,6 +174,10 @@ public:
         mems_use_internal_persistent_.emplace_back(mem_offkey);
     }
 
+    void add_mem_use_sub_buffer(const sub_buffer_info_t &info) {
+        mems_use_sub_buffers_.emplace_back(info);
+    }
+
     // finders
     bool find_value_mem_map(value_t *key, memory &mem) const {
         auto pos = value_mem_map_.find(key);
@@ -178,6 +199,8 @@ private:
     // memory <-> offset key of used underlying buffer in the internal
     // persistent registry
     std::vector<std::pair<dnnl::memory, size_t>> mems_use_internal_persistent_;
+    // memories which are views into the buffers of other memories
+    std::vector<sub_buffer_info_t> mems_use_sub_buffers_;
     // value pointer -> memory
     std::unordered_map<value_t *, memory> value_mem_map_;
     // execution args for each op in the subgraph
@@ -420,6 +443,14 @@ private:
         size_t end_;
     };
 
+    // A value which lives in a part of the buffer of another value: a concat
+    // input written by its producer directly into the concat output, or the
+    // output of a slice pointing into the slice input.
+    struct view_t {
+        const value_t *base_; // the value owning the buffer
+        size_t offset_; // byte offset of the view in the base buffer
+    };
+
     void clear() {
         alias_analyzer_.clear();
         buffer_assignments_.clear();
@@ -430,8 +461,14 @@ private:
         temporary_registry_.clear();
         external_inputs_live_range_.clear();
         inplace_pairs_.clear();
+        views_.clear();
     }
 
+    status_t plan_slice_views(std::shared_ptr<subgraph_t> &sg);
+
+    status_t plan_concat_slices(
+            std::shared_ptr<subgraph_t> &sg, fusion_info_mgr_t &mgr);
+
     status_t assign_external_inputs_buffer(std::shared_ptr<subgraph_t> &sg,
             const std::vector<logical_tensor_t> &inputs);
 
@@ -467,6 +504,7 @@ private:
     std::unordered_map<const assign_info_t *, time_bound_t>
             external_inputs_live_range_;
     std::vector<inplace_pair_t> inplace_pairs_;
+    std::unordered_map<const value_t *, view_t> views_;
 };
 
 } // namespace dnnl_impl
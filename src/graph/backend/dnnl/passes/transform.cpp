@@ -33,6 +33,7 @@
 #include "graph/interface/shape_infer.hpp"
 #include "graph/utils/utils.hpp"
 
+#include "graph/backend/dnnl/dnnl_constant_tensor_cache.hpp"
 #include "graph/backend/dnnl/fusion_info.hpp"
 #include "graph/backend/dnnl/internal_attrs.hpp"
 #include "graph/backend/dnnl/op_executable.hpp"
@@ -810,6 +811,202 @@ status_t fuse_to_shuffle(std::shared_ptr<subgraph_t> &sg) {
     return status::success;
 }
 
+status_t fuse_softmax_to_topk(std::shared_ptr<subgraph_t> &sg) {
+    std::vector<std::pair<op_t *, op_t *>> fusion_groups;
+    for (const auto &cur_op : sg->get_ops()) {
+        if (cur_op->get_kind() != op_kind::dnnl_topk) continue;
+
+        auto values = cur_op->get_output_value(0);
+        if (values->get_consumers().size() != 1) continue;
+        auto &next_op = values->get_consumers()[0].get_op();
+        if (next_op.get_kind() != op_kind::dnnl_softmax) continue;
+        // Only a plain softmax over the selected values can be fused.
+        if (next_op.num_inputs() != 1 || next_op.num_outputs() != 2
+                || next_op.get_attr<std::string>(op_attr::mode) != "none"
+                || (next_op.has_attr(op_attr::fusion_info_key)
+                        && next_op.get_attr<int64_t>(op_attr::fusion_info_key)
+                                != -1)
+                || cur_op->get_attr<std::string>(op_attr::mode) != "max")
+            continue;
+
+        const auto ndims = ltw(values->get_logical_tensor()).ndims();
+        auto topk_axis = cur_op->get_attr<int64_t>(op_attr::axis);
+        auto softmax_axis = next_op.get_attr<int64_t>(op_attr::axis);
+        if (topk_axis < 0) topk_axis += ndims;
+        if (softmax_axis < 0) softmax_axis += ndims;
+        if (topk_axis != softmax_axis) continue;
+
+        fusion_groups.emplace_back(cur_op.get(), &next_op);
+    }
+
+    subgraph_rewriter_t rewriter(sg);
+    for (auto &fusion_group : fusion_groups) {
+        op_t *topk = fusion_group.first;
+        op_t *softmax = fusion_group.second;
+
+        topk->get_output_value(0)->remove_consumer(*softmax, 0);
+        auto softmax_dst = softmax->get_output_value(0);
+        topk->connect_output(0, softmax_dst);
+        topk->set_attr<bool>(op_attr::with_softmax, true);
+
+        rewriter.to_remove(softmax->shared_from_this());
+    }
+
+    rewriter.run();
+    return status::success;
+}
+
+status_t fuse_parallel_matmuls(std::shared_ptr<subgraph_t> &sg) {
+    // The outputs are split with slice views, which are only bound in place
+    // for CPU memory. Concatenating weights at each execution would cost
+    // more than it saves, so the weights have to be cached.
+    if (sg->get_engine_kind() != engine_kind::cpu
+            || !is_constant_cache_enabled(*sg->p_engine_))
+        return status::success;
+
+    const auto sg_outputs = sg->get_output_values();
+    auto is_constant_param = [](const value_ptr &val) {
+        return !val->has_producer()
+                && ltw(val->get_logical_tensor()).is_constant();
+    };
+    auto get_flag = [](const op_t *op, op_attr_t attr) {
+        return op->has_attr(attr) && op->get_attr<bool>(attr);
+    };
+
+    // matmuls which only differ in their weights (and bias), grouped by src
+    std::map<value_t *, std::vector<op_t *>> groups;
+    std::vector<value_t *> srcs;
+    for (const auto &cur_op : sg->get_ops()) {
+        if (cur_op->get_kind() != op_kind::dnnl_matmul) continue;
+        if (cur_op->has_attr(op_attr::fusion_info_key)
+                && cur_op->get_attr<int64_t>(op_attr::fusion_info_key) != -1)
+            continue;
+
+        const auto src_lt = cur_op->get_input_value(0)->get_logical_tensor();
+        const auto wei = cur_op->get_input_value(1);
+        const auto wei_lt = wei->get_logical_tensor();
+        if (src_lt.ndims < 2 || wei_lt.ndims != 2 || !is_constant_param(wei)
+                || ltw(wei_lt).has_zero_dim()
+                || ltw(wei_lt).is_shape_unknown())
+            continue;
+        if (cur_op->num_inputs() == 3) {
+            const auto bias = cur_op->get_input_value(2);
+            if (bias->get_logical_tensor().ndims != 1
+                    || !is_constant_param(bias))
+                continue;
+        }
+
+        const auto dst = cur_op->get_output_value(0);
+        if (dst->get_consumers().empty()
+                || std::find(sg_outputs.begin(), sg_outputs.end(), dst.get())
+                        != sg_outputs.end())
+            continue;
+
+        value_t *src = cur_op->get_input_value(0).get();
+        if (!groups.count(src)) srcs.emplace_back(src);
+        groups[src].emplace_back(cur_op.get());
+    }
+
+    subgraph_rewriter_t rewriter(sg);
+    for (value_t *src : srcs) {
+        const auto &candidates = groups.at(src);
+        if (candidates.size() < 2) continue;
+
+        // members have to agree on everything but the N dimension
+        const op_t *first = candidates[0];
+        const bool trans_b = get_flag(first, op_attr::transpose_b);
+        const auto first_wei_lt
+                = first->get_input_value(1)->get_logical_tensor();
+        const int k_axis = trans_b ? 1 : 0;
+        std::vector<op_t *> members;
+        for (op_t *op : candidates) {
+            const auto wei_lt = op->get_input_value(1)->get_logical_tensor();
+            const bool ok = get_flag(op, op_attr::transpose_a)
+                            == get_flag(first, op_attr::transpose_a)
+                    && get_flag(op, op_attr::transpose_b) == trans_b
+                    && wei_lt.dims[k_axis] == first_wei_lt.dims[k_axis]
+                    && wei_lt.data_type == first_wei_lt.data_type
+                    && op->num_inputs() == first->num_inputs()
+                    && (op->num_inputs() < 3
+                            || op->get_input_value(2)
+                                            ->get_logical_tensor()
+                                            .data_type
+                                    == first->get_input_value(2)
+                                               ->get_logical_tensor()
+                                               .data_type)
+                    && op->get_output_value(0)->get_logical_tensor().data_type
+                            == first->get_output_value(0)
+                                       ->get_logical_tensor()
+                                       .data_type;
+            if (ok) members.emplace_back(op);
+        }
+        if (members.size() < 2) continue;
+
+        // concatenate weights (and biases) along N, they are constant and
+        // computed once into the constant cache
+        const bool with_bias = first->num_inputs() == 3;
+        std::vector<op_ptr> concats;
+        for (size_t i = 1; i < first->num_inputs(); ++i) {
+            op_ptr concat_op = std::make_shared<op_t>(op_kind::dnnl_concat);
+            concat_op->set_attr<int64_t>(
+                    op_attr::axis, i == 1 ? 1 - k_axis : 0);
+            for (size_t j = 0; j < members.size(); ++j) {
+                auto in = members[j]->get_input_value(i);
+                in->remove_consumer(*members[j], i);
+                concat_op->connect_input(j, in);
+            }
+            auto out = std::make_shared<value_t>(*concat_op, 0,
+                    empty_logical_tensor_with_default_id(), true);
+            out->set_data_type(concat_op->get_input_value(0)
+                                       ->get_logical_tensor()
+                                       .data_type);
+            out->set_property(property_type::constant);
+            concat_op->add_output(out);
+            insert_empty_scratchpad(concat_op);
+            rewriter.to_insert(concat_op);
+            concats.emplace_back(concat_op);
+        }
+
+        op_ptr matmul_op = std::make_shared<op_t>(op_kind::dnnl_matmul);
+        matmul_op->merge_attributes(first->get_attributes());
+        auto src_val = first->get_input_value(0);
+        for (op_t *op : members)
+            src_val->remove_consumer(*op, 0);
+        matmul_op->connect_input(0, src_val);
+        matmul_op->connect_input(1, concats[0]->get_output_value(0));
+        if (with_bias)
+            matmul_op->connect_input(2, concats[1]->get_output_value(0));
+        auto fused_dst = std::make_shared<value_t>(*matmul_op, 0,
+                empty_logical_tensor_with_default_id(), true);
+        fused_dst->set_data_type(
+                first->get_output_value(0)->get_logical_tensor().data_type);
+        matmul_op->add_output(fused_dst);
+        insert_empty_scratchpad(matmul_op);
+        rewriter.to_insert(matmul_op);
+
+        // every original output becomes a view of its columns in the fused
+        // output
+        int64_t begin = 0;
+        for (op_t *op : members) {
+            const auto wei_lt = op->get_input_value(1)->get_logical_tensor();
+            const int64_t n = wei_lt.dims[1 - k_axis];
+            op_ptr slice_op = std::make_shared<op_t>(op_kind::dnnl_slice);
+            slice_op->set_attr<int64_t>(op_attr::axis, -1);
+            slice_op->set_attr<int64_t>(op_attr::slice_begin, begin);
+            slice_op->set_attr<int64_t>(op_attr::slice_size, n);
+            slice_op->connect_input(0, fused_dst);
+            auto dst = op->get_output_value(0);
+            slice_op->connect_output(0, dst);
+            rewriter.to_insert(slice_op);
+            rewriter.to_remove(op->shared_from_this());
+            begin += n;
+        }
+    }
+
+    rewriter.run();
+    return infer_shape(sg);
+}
+
 status_t fuse_post_ops(std::shared_ptr<subgraph_t> &sg) {
     // lambda function to fuse one post op into base primitive
     auto fuse_post_ops_func = [&](bool &changed) -> status_t {
@@ -1283,11 +1480,15 @@ status_t fuse_src_scales(std::shared_ptr<subgraph_t> &sg) {
         if (consumers.empty()) continue;
         if (!impl::utils::one_of(consumers[0].get_op().get_kind(),
                     op_kind::dnnl_matmul, op_kind::dnnl_convolution,
-                    op_kind::dnnl_convtranspose, op_kind::dnnl_reorder))
+                    op_kind::dnnl_convtranspose, op_kind::dnnl_reorder,
+                    op_kind::dnnl_embedding_bag))
             continue;
 
         auto &next_op = consumers[0].get_op();
         auto offset = consumers[0].get_offset();
+        // Only the table of an embedding bag can be dequantized.
+        if (next_op.get_kind() == op_kind::dnnl_embedding_bag && offset != 0)
+            continue;
         if (offset == 0 || offset == 1) {
             // Matmul only support applying scale per channel along the last
             // dimension for DNNL_ARG_WEIGHTS.
@@ -60,6 +60,13 @@ status_t fuse_dst_zero_points(std::shared_ptr<subgraph_t> &sg);
 
 status_t fuse_reciprocal_mul_to_div(std::shared_ptr<subgraph_t> &sg);
 
+/// Fuses a softmax over the values selected by a topk into the topk
+status_t fuse_softmax_to_topk(std::shared_ptr<subgraph_t> &sg);
+
+/// Merges matmuls sharing the same src into a single matmul over the
+/// concatenated weights, whose output is split back with slice views
+status_t fuse_parallel_matmuls(std::shared_ptr<subgraph_t> &sg);
+
 status_t insert_bn_folding(std::shared_ptr<subgraph_t> &sg);
 
 status_t conv_bwd_data_canonicalization(std::shared_ptr<subgraph_t> &sg);
@@ -26,6 +26,7 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include "graph/interface/partition_hashing.hpp"
 #include "graph/interface/shape_infer.hpp"
 #include "graph/interface/value.hpp"
 #include "graph/utils/debug.hpp"
@@ -191,6 +192,81 @@ std::vector<value_t *> get_constant_block_output_values(
     return ret;
 }
 
+size_t get_constant_subgraph_key(
+        size_t part_id, const std::shared_ptr<subgraph_t> &sg) {
+    using ltw = logical_tensor_wrapper_t;
+    // the hash of a logical tensor without its id, which is unique in a graph
+    auto get_lt_hash = [](const value_t &val) {
+        logical_tensor_t lt = val.get_logical_tensor();
+        lt.id = 0;
+        return ltw(lt).hash();
+    };
+
+    std::unordered_map<const op_t *, size_t> positions;
+    size_t key = 0;
+    bool identified = true;
+    auto func = [&](op_t *op) {
+        if (!op->has_attr(op_attr::is_constant)
+                || !op->get_attr<bool>(op_attr::is_constant))
+            return status::success;
+        // the fused ops are not hashed with the op attributes
+        if (op->has_attr(op_attr::fusion_info_key)
+                && op->get_attr<int64_t>(op_attr::fusion_info_key) != -1) {
+            identified = false;
+            return status::success;
+        }
+
+        key = hash_combine(key, static_cast<size_t>(op->get_kind()));
+        key = hash_combine(key,
+                partition_hashing::get_attributes_hash(
+                        op->get_attributes()));
+        for (const auto &in : op->get_input_values()) {
+            if (in->has_producer()) {
+                auto pos = positions.find(&in->get_producer());
+                if (pos == positions.end()) {
+                    identified = false;
+                    return status::success;
+                }
+                key = hash_combine(key, pos->second);
+                key = hash_combine(key, in->get_offset());
+            } else {
+                // a partition input is identified by its index, which the
+                // input buffer is encoded with at execution
+                const size_t id = in->get_logical_tensor().id;
+                auto pos = std::find_if(sg->ins_.begin(), sg->ins_.end(),
+                        [&](const logical_tensor_t &lt) {
+                            return lt.id == id;
+                        });
+                if (pos == sg->ins_.end()) {
+                    identified = false;
+                    return status::success;
+                }
+                key = hash_combine(key,
+                        static_cast<size_t>(
+                                std::distance(sg->ins_.begin(), pos)));
+            }
+            key = hash_combine(key, get_lt_hash(*in));
+        }
+        for (const auto &out : op->get_output_values())
+            key = hash_combine(key, get_lt_hash(*out));
+
+        const size_t position = positions.size();
+        positions[op] = position;
+        return status::success;
+    };
+    status_t status = topo_order_visit(sg->get_output_ops(), func);
+    if (status != status::success || !identified || positions.empty())
+        return part_id;
+
+    // the order of the constant block outputs decides their placement in the
+    // cached buffer
+    for (const auto *val : get_constant_block_output_values(sg)) {
+        key = hash_combine(key, positions.at(&val->get_producer()));
+        key = hash_combine(key, val->get_offset());
+    }
+    return key;
+}
+
 status_t infer_shape(std::shared_ptr<subgraph_t> &sg) {
     // workaround: the conv output shape will be impacted if the post-op is a
     // k3s2p1 dw conv. but with current shape infer functions' implementation,
@@ -523,6 +599,7 @@ get_post_ops_fusible_map() {
                     {dnnl_softmax, {dnnl_eltwise, dnnl_binary}},
                     {dnnl_layernorm, {dnnl_eltwise, dnnl_binary}},
                     {dnnl_groupnorm, {dnnl_eltwise, dnnl_binary}},
+                    {dnnl_embedding_bag, {dnnl_eltwise, dnnl_binary}},
             };
     return fusible_map;
 }
@@ -326,6 +326,14 @@ inline bool is_reduction_kind(op_kind_t kind) {
 std::vector<value_t *> get_constant_block_output_values(
         const std::shared_ptr<subgraph_t> &sg);
 
+// Get a key identifying the computation of the constant blocks of a subgraph
+// from the partition inputs. Subgraphs of different partitions computing the
+// same constant tensors get the same key, so that they can share the cached
+// constant tensors. The partition id is returned if the computation cannot be
+// identified.
+size_t get_constant_subgraph_key(
+        size_t part_id, const std::shared_ptr<subgraph_t> &sg);
+
 status_t infer_shape(std::shared_ptr<subgraph_t> &sg);
 
 const std::map<op_kind_t, dnnl::algorithm> &get_binary_alg_map();
@@ -16,6 +16,7 @@
 
 #include "graph/backend/dnnl/internal_ops.hpp"
 #include "graph/backend/dnnl/kernels/batch_norm.hpp"
+#include "graph/backend/dnnl/kernels/conv_bnorm.hpp"
 #include "graph/backend/dnnl/patterns/fusions.hpp"
 #include "graph/backend/dnnl/patterns/pattern_matcher_pass.hpp"
 #include "graph/backend/dnnl/patterns/utils.hpp"
@@ -105,6 +106,51 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, s8f32s8_bnorm)
     })
 
 #if BUILD_TRAINING
+/*
+            \   /
+            conv
+              |
+    BatchNormForwardTraining
+              |
+            [ReLU]
+              |
+*/
+// The convolution output is kept as an output of the partition when it is
+// needed by the backward pass. The decomposition kernel runs on the OMP and
+// threadpool runtimes only.
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP \
+        || DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, fp_conv_bnorm_train)
+        .set_priority(10.1f)
+        .set_engine_kind(engine_kind::cpu)
+        .set_kind(partition_kind_t::convolution_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    auto conv = pgraph->append_op(graph::op_kind::Convolution);
+                    conv->append_decision_function(
+                            check_input_dtype<impl::data_type::f32>);
+                    conv->append_decision_function(check_nxc_data_format);
+                    conv->allow_external_outputs();
+
+                    auto bn = pgraph->append_op(
+                            graph::op_kind::BatchNormForwardTraining,
+                            {in_edge(0, conv, 0)});
+                    bn->append_decision_function(
+                            check_input_dtype_from_offset<impl::data_type::f32,
+                                    1>);
+                    bn->append_decision_function(check_nxc_data_format);
+
+                    auto relu_graph = std::make_shared<pb_graph_t>();
+                    auto relu = relu_graph->append_op(graph::op_kind::ReLU);
+                    relu_graph->create_input_port(0, relu, 0);
+                    relu_graph->create_output_port(0, relu, 0);
+                    pgraph->append_optional(relu_graph, {in_edge(0, bn, 0)});
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<conv_bnorm_base_t>();
+        });
+#endif
+
 DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, fp_bnorm_bwd_relu_bwd)
         .set_priority(8.8f)
         .set_kind(partition_kind_t::misc_post_ops)
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include "graph/backend/dnnl/kernels/conv.hpp"
+#include "graph/backend/dnnl/kernels/conv_pool.hpp"
 #include "graph/backend/dnnl/patterns/fusions.hpp"
 #include "graph/backend/dnnl/patterns/pattern_matcher_pass.hpp"
 #include "graph/backend/dnnl/patterns/utils.hpp"
@@ -776,6 +777,52 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, fp_conv_post_ops)
             return std::make_shared<float_conv_fwd>();
         });
 
+/*
+Pooling is computed while the convolution output is still in cache, so the
+pre-pooling activation is not written to memory.
+                |
+              conv
+                |
+          [bias_add]*
+                |
+        [unary]*[0,MAX_REPETITION)
+                |
+        [AvgPool/MaxPool]
+                |
+The decomposition kernel runs on the OMP and threadpool runtimes only.
+*/
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP \
+        || DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, fp_conv_pool)
+        .set_priority(10.f)
+        .set_engine_kind(engine_kind::cpu)
+        .set_kind(partition_kind_t::convolution_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    pm::pb_op_t *conv
+                            = pgraph->append_op(graph::op_kind::Convolution);
+                    conv->append_decision_function(check_nxc_data_format);
+                    auto popt_bias = optional_bias_add(pgraph, conv, false);
+
+                    auto alt_graph = std::make_shared<pb_graph_t>();
+                    auto palt = alt_graph->append_alternation(get_unary_ops());
+                    alt_graph->create_input_port(0, palt, 0);
+                    alt_graph->create_output_port(0, palt, 0);
+                    auto prep = pgraph->append_repetition(alt_graph, {0, 0}, 0,
+                            MAX_REPETITION,
+                            in_edges_t {in_edge(0, popt_bias, 0)});
+
+                    auto ppool = pgraph->append_alternation(
+                            {graph::op_kind::AvgPool, graph::op_kind::MaxPool},
+                            in_edges_t {in_edge(0, prep, 0)});
+                    ppool->append_decision_function(check_avgpool_attributes);
+                    ppool->append_decision_function(check_nxc_data_format);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<conv_pool_base_t>();
+        });
+#endif
+
 /*
               \   /
               conv
@@ -0,0 +1,139 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "graph/backend/dnnl/kernels/large_partition.hpp"
+#include "graph/backend/dnnl/patterns/fusions.hpp"
+#include "graph/backend/dnnl/patterns/pattern_matcher_pass.hpp"
+#include "graph/backend/dnnl/patterns/utils.hpp"
+
+#include "graph/utils/pm/pbuilder.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+namespace pattern {
+
+namespace pm = graph::utils::pm;
+using in_edges_t = pm::in_edges_t;
+using pb_graph_t = pm::pb_graph_t;
+using FCreatePattern = graph::pass::FCreatePattern;
+
+namespace {
+// The lookup dequantizes the table rows it reads, which is only possible for
+// scales applied to the whole table or to each of its rows.
+bool check_table_dequantize(op_t *op) {
+    VCHECK_PATTERN_UTILS(op->num_inputs() == 2, false,
+            "zero points are not supported for the embedding table");
+    const auto &qtype = op->get_attr<std::string>(op_attr::qtype);
+    if (qtype == "per_tensor") return true;
+    VCHECK_PATTERN_UTILS(qtype == "per_channel", false,
+            "unsupported qtype %s for the embedding table", qtype.c_str());
+    const auto axis = op->get_attr<int64_t>(op_attr::axis);
+    VCHECK_PATTERN_UTILS(axis == 0 || axis == -2, false,
+            "embedding table can only be dequantized per row, but got axis "
+            "%ld",
+            static_cast<long int>(axis));
+    return true;
+}
+
+// [DynamicDequantize]* - EmbeddingBag - [unary/binary]*
+pm::pb_node_t *embedding_bag_post_ops(
+        const std::shared_ptr<pb_graph_t> &pgraph) {
+    auto popt_graph = std::make_shared<pb_graph_t>();
+    pm::pb_op_t *pdequant
+            = popt_graph->append_op(graph::op_kind::DynamicDequantize);
+    pdequant->append_decision_function(check_table_dequantize);
+    popt_graph->create_input_port(0, pdequant, 0);
+    popt_graph->create_output_port(0, pdequant, 0);
+    auto popt = pgraph->append_optional(popt_graph);
+
+    pm::pb_op_t *pembedding = pgraph->append_op(graph::op_kind::EmbeddingBag,
+            in_edges_t {in_edge(0, popt, 0)});
+
+    auto postop_graph = std::make_shared<pb_graph_t>();
+    pm::pb_op_t *pop = postop_graph->append_alternation(get_unary_binary_ops());
+    pop->allow_internal_inputs();
+    postop_graph->create_input_port(0, pop, 0);
+    postop_graph->create_input_port(1, pop, 1);
+    postop_graph->create_output_port(0, pop, 0);
+
+    return pgraph->append_repetition(postop_graph, {0, 0}, 0, MAX_REPETITION,
+            in_edges_t {in_edge(0, pembedding, 0)});
+}
+} // namespace
+
+DNNL_BACKEND_REGISTER_PATTERN_DEF_BEGIN(embedding_bag_fusion)
+
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, embedding_bag_post_ops)
+        .set_priority(8.4f)
+        .set_kind(partition_kind_t::misc_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    embedding_bag_post_ops(pgraph);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<larger_partition_kernel_t>();
+        });
+
+/*
+Keeps the pooled embeddings of recommendation models (e.g. the bottom of a
+DLRM interaction or a feature projection) inside the partition: they are
+consumed by the following MatMul without leaving the library.
+
+    [DynamicDequantize]*
+            |
+       EmbeddingBag
+            |
+     [unary/binary]*
+            |
+          MatMul  (weights)
+            |
+     [unary/binary]*
+*/
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, embedding_bag_matmul_fusion)
+        .set_priority(8.5f)
+        .set_kind(partition_kind_t::misc_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    auto prep = embedding_bag_post_ops(pgraph);
+                    pm::pb_op_t *pmatmul
+                            = pgraph->append_op(graph::op_kind::MatMul,
+                                    in_edges_t {in_edge(0, prep, 0)});
+
+                    auto postop_graph = std::make_shared<pb_graph_t>();
+                    pm::pb_op_t *pop = postop_graph->append_alternation(
+                            get_unary_binary_ops());
+                    pop->allow_internal_inputs();
+                    postop_graph->create_input_port(0, pop, 0);
+                    postop_graph->create_input_port(1, pop, 1);
+                    postop_graph->create_output_port(0, pop, 0);
+
+                    pgraph->append_repetition(postop_graph, {0, 0}, 0,
+                            MAX_REPETITION,
+                            in_edges_t {in_edge(0, pmatmul, 0)});
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<larger_partition_kernel_t>();
+        });
+
+DNNL_BACKEND_REGISTER_PATTERN_DEF_END
+
+} // namespace pattern
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
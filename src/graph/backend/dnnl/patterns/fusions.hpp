@@ -35,6 +35,8 @@ DNNL_BACKEND_REGISTER_PATTERN_DECLARE(binary_fusion)
 DNNL_BACKEND_REGISTER_PATTERN_DECLARE(bn_fusion)
 DNNL_BACKEND_REGISTER_PATTERN_DECLARE(convtranspose_fusion)
 DNNL_BACKEND_REGISTER_PATTERN_DECLARE(eltwise_fusion)
+DNNL_BACKEND_REGISTER_PATTERN_DECLARE(embedding_bag_fusion)
+DNNL_BACKEND_REGISTER_PATTERN_DECLARE(topk_fusion)
 DNNL_BACKEND_REGISTER_PATTERN_DECLARE(interpolate_fusion)
 DNNL_BACKEND_REGISTER_PATTERN_DECLARE(pool_post_ops)
 DNNL_BACKEND_REGISTER_PATTERN_DECLARE(quantize_fusion)
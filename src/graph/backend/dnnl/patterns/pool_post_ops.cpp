@@ -32,17 +32,6 @@ using in_edges_t = pm::in_edges_t;
 using pb_graph_t = pm::pb_graph_t;
 using FCreatePattern = graph::pass::FCreatePattern;
 
-bool check_avgpool_attributes(op_t *op) {
-    bool result = !(op->get_kind() == graph::op_kind::AvgPool
-            && op->get_attr<std::string>(graph::op_attr::rounding_type)
-                    == "ceil"
-            && op->get_attr<bool>(graph::op_attr::exclude_pad) == false);
-    VCHECK_PATTERN_UTILS(result, result,
-            "unsupported avgpool attributes combination: ceil rounding type "
-            "and exclude_pad=false");
-    return result;
-}
-
 DNNL_BACKEND_REGISTER_PATTERN_DEF_BEGIN(pool_post_ops)
 
 DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, fp_avg_pool)
@@ -0,0 +1,134 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "graph/backend/dnnl/kernels/large_partition.hpp"
+#include "graph/backend/dnnl/patterns/fusions.hpp"
+#include "graph/backend/dnnl/patterns/pattern_matcher_pass.hpp"
+#include "graph/backend/dnnl/patterns/utils.hpp"
+
+#include "graph/utils/pm/pbuilder.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+namespace pattern {
+
+namespace pm = graph::utils::pm;
+using in_edges_t = pm::in_edges_t;
+using pb_graph_t = pm::pb_graph_t;
+using FCreatePattern = graph::pass::FCreatePattern;
+
+namespace {
+// The softmax is only fused when it normalizes the selected values, i.e. runs
+// along the topk axis of a `max` selection.
+bool check_topk_softmax(op_t *op) {
+    VCHECK_PATTERN_UTILS(op->num_outputs() == 1, false,
+            "softmax stats are not supported after topk");
+    auto in_value = op->get_input_value(0);
+    if (!in_value->has_producer()) return false;
+    const op_t &topk = in_value->get_producer();
+    VCHECK_PATTERN_UTILS(topk.get_attr<std::string>(op_attr::mode) == "max",
+            false, "softmax can only be fused to a max topk");
+    const auto ndims = in_value->get_logical_tensor().ndims;
+    if (ndims < 0) return true;
+    auto topk_axis = topk.get_attr<int64_t>(op_attr::axis);
+    auto softmax_axis = op->get_attr<int64_t>(op_attr::axis);
+    if (topk_axis < 0) topk_axis += ndims;
+    if (softmax_axis < 0) softmax_axis += ndims;
+    VCHECK_PATTERN_UTILS(topk_axis == softmax_axis, false,
+            "softmax axis %ld does not match topk axis %ld",
+            static_cast<long int>(softmax_axis),
+            static_cast<long int>(topk_axis));
+    return true;
+}
+
+// TopK - [SoftMax]*
+void topk_softmax(const std::shared_ptr<pb_graph_t> &pgraph, pm::pb_node_t *in,
+        bool with_input) {
+    pm::pb_op_t *ptopk = with_input
+            ? pgraph->append_op(
+                    graph::op_kind::TopK, in_edges_t {in_edge(0, in, 0)})
+            : pgraph->append_op(graph::op_kind::TopK);
+
+    auto popt_graph = std::make_shared<pb_graph_t>();
+    pm::pb_op_t *psoftmax = popt_graph->append_op(graph::op_kind::SoftMax);
+    psoftmax->append_decision_function(check_topk_softmax);
+    popt_graph->create_input_port(0, psoftmax, 0);
+    popt_graph->create_output_port(0, psoftmax, 0);
+    pgraph->append_optional(popt_graph, in_edges_t {in_edge(0, ptopk, 0)});
+}
+} // namespace
+
+DNNL_BACKEND_REGISTER_PATTERN_DEF_BEGIN(topk_fusion)
+
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, topk_softmax_fusion)
+        .set_priority(8.4f)
+        .set_kind(partition_kind_t::misc_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    topk_softmax(pgraph, nullptr, false);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<larger_partition_kernel_t>();
+        });
+
+/*
+Selects the candidates of a sampling or retrieval head (e.g. the vocabulary
+logits of a language model or the scores of a recommendation model) in the
+partition which computes them, so that the full score tensor never leaves the
+library. A following softmax is applied to the selected values only.
+
+          MatMul
+            |
+     [unary/binary]*
+            |
+          TopK
+            |
+        [SoftMax]*
+*/
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, matmul_topk_fusion)
+        .set_priority(8.5f)
+        .set_kind(partition_kind_t::misc_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    pm::pb_op_t *pmatmul
+                            = pgraph->append_op(graph::op_kind::MatMul);
+
+                    auto postop_graph = std::make_shared<pb_graph_t>();
+                    pm::pb_op_t *pop = postop_graph->append_alternation(
+                            get_unary_binary_ops());
+                    pop->allow_internal_inputs();
+                    postop_graph->create_input_port(0, pop, 0);
+                    postop_graph->create_input_port(1, pop, 1);
+                    postop_graph->create_output_port(0, pop, 0);
+
+                    auto prep = pgraph->append_repetition(postop_graph, {0, 0},
+                            0, MAX_REPETITION,
+                            in_edges_t {in_edge(0, pmatmul, 0)});
+                    topk_softmax(pgraph, prep, true);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<larger_partition_kernel_t>();
+        });
+
+DNNL_BACKEND_REGISTER_PATTERN_DEF_END
+
+} // namespace pattern
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
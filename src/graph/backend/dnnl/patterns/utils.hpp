@@ -149,6 +149,25 @@ inline bool check_begin_norm_axis_attr(const op_t *op) {
     return true;
 }
 
+inline bool check_avgpool_attributes(op_t *op) {
+    bool result = !(op->get_kind() == graph::op_kind::AvgPool
+            && op->get_attr<std::string>(graph::op_attr::rounding_type)
+                    == "ceil"
+            && op->get_attr<bool>(graph::op_attr::exclude_pad) == false);
+    VCHECK_PATTERN_UTILS(result, result,
+            "unsupported avgpool attributes combination: ceil rounding type "
+            "and exclude_pad=false");
+    return result;
+}
+
+// The decomposition kernels on CPU only compute channels-last tensors.
+inline bool check_nxc_data_format(op_t *op) {
+    const bool result = !op->has_attr(graph::op_attr::data_format)
+            || op->get_attr<std::string>(graph::op_attr::data_format) == "NXC";
+    VCHECK_PATTERN_UTILS(result, result, "only NXC data format is supported");
+    return result;
+}
+
 // min <= input[offset]->ndims() <= max
 template <size_t OFFSET, int32_t MIN, int32_t MAX>
 inline bool check_input_ndim_from_offset(const op_t *op) {
@@ -54,6 +54,32 @@ status_t DNNL_API dnnl_graph_allocator_create(allocator_t **allocator,
 #endif
 }
 
+status_t DNNL_API dnnl_graph_allocator_create_with_arena(
+        allocator_t **allocator) {
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
+    UNUSED(allocator);
+    return status::invalid_arguments;
+#else
+    if (allocator == nullptr) return status::invalid_arguments;
+    *allocator = new dnnl_graph_allocator(
+            std::make_shared<utils::host_arena_t>());
+    return status::success;
+#endif
+}
+
+status_t DNNL_API dnnl_graph_allocator_get_arena_stats(
+        const allocator_t *allocator, size_t *num_requests, size_t *num_hits,
+        size_t *resident_size) {
+    if (utils::any_null(allocator, num_requests, num_hits, resident_size))
+        return status::invalid_arguments;
+    const auto *arena = allocator->get_arena();
+    if (arena == nullptr) return status::invalid_arguments;
+    *num_requests = arena->get_num_requests();
+    *num_hits = arena->get_num_hits();
+    *resident_size = arena->get_resident_size();
+    return status::success;
+}
+
 status_t DNNL_API dnnl_graph_sycl_interop_allocator_create(
         allocator_t **allocator, sycl_allocate_f sycl_malloc,
         sycl_deallocate_f sycl_free) {
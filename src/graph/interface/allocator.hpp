@@ -17,6 +17,9 @@
 #ifndef GRAPH_INTERFACE_ALLOCATOR_HPP
 #define GRAPH_INTERFACE_ALLOCATOR_HPP
 
+#include <memory>
+#include <utility>
+
 #include "oneapi/dnnl/dnnl_graph.h"
 
 #include "graph/interface/c_types_map.hpp"
@@ -41,6 +44,12 @@ public:
             dnnl_graph_host_deallocate_f host_free)
         : host_malloc_(host_malloc), host_free_(host_free) {}
 
+    // The host temporary buffers are served by the arena, and the other
+    // buffers by the default functions
+    dnnl_graph_allocator(
+            std::shared_ptr<dnnl::impl::graph::utils::host_arena_t> arena)
+        : arena_(std::move(arena)) {}
+
 #ifdef DNNL_WITH_SYCL
     dnnl_graph_allocator(dnnl_graph_sycl_allocate_f sycl_malloc,
             dnnl_graph_sycl_deallocate_f sycl_free)
@@ -72,6 +81,10 @@ public:
     };
 
     void *allocate(size_t size, mem_attr_t attr = {}) const {
+        if (arena_ && attr.type_ == mem_type_t::temp) {
+            void *buffer = arena_->malloc(size, attr.alignment_);
+            if (buffer) return buffer;
+        }
         void *buffer = host_malloc_(size, attr.alignment_);
         return buffer;
     }
@@ -122,6 +135,7 @@ public:
 #endif
 
     void deallocate(void *buffer) const {
+        if (arena_ && arena_->free(buffer)) return;
         if (buffer) { host_free_(buffer); }
     }
 
@@ -146,11 +160,17 @@ public:
     }
 #endif
 
+    const dnnl::impl::graph::utils::host_arena_t *get_arena() const {
+        return arena_.get();
+    }
+
 private:
     dnnl_graph_host_allocate_f host_malloc_ {
             dnnl::impl::graph::utils::cpu_allocator_t::malloc};
     dnnl_graph_host_deallocate_f host_free_ {
             dnnl::impl::graph::utils::cpu_allocator_t::free};
+    // shared by the copies of the allocator, like the one held by an engine
+    std::shared_ptr<dnnl::impl::graph::utils::host_arena_t> arena_;
 
 #ifdef DNNL_WITH_SYCL
     dnnl_graph_sycl_allocate_f sycl_malloc_ {
@@ -0,0 +1,344 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <numeric>
+
+#include "oneapi/dnnl/dnnl_graph.h"
+
+#include "common/stream.hpp"
+#include "common/utils.hpp"
+#include "common/verbose.hpp"
+
+#include "graph/interface/c_types_map.hpp"
+#include "graph/interface/compiled_graph.hpp"
+#include "graph/interface/graph.hpp"
+#include "graph/interface/logical_tensor.hpp"
+#include "graph/interface/partition.hpp"
+#include "graph/interface/tensor.hpp"
+
+#include "graph/utils/utils.hpp"
+
+using namespace dnnl::impl::graph;
+
+namespace {
+// alignment of the intermediate tensors in the buffer
+const size_t buffer_alignment = 64;
+} // namespace
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+
+size_t plan_buffer_slots(std::vector<buffer_slot_t> &slots, size_t alignment) {
+    std::vector<size_t> order(slots.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return slots[a].size > slots[b].size;
+    });
+
+    size_t total = 0;
+    std::vector<size_t> placed;
+    placed.reserve(slots.size());
+    for (size_t idx : order) {
+        auto &slot = slots[idx];
+        // the placed slots whose lifetime overlaps with the current one
+        std::vector<const buffer_slot_t *> alive;
+        for (size_t p : placed) {
+            const auto &other = slots[p];
+            if (other.first <= slot.last && slot.first <= other.last)
+                alive.push_back(&other);
+        }
+        std::sort(alive.begin(), alive.end(),
+                [](const buffer_slot_t *a, const buffer_slot_t *b) {
+                    return a->offset < b->offset;
+                });
+
+        size_t offset = 0;
+        for (const auto *other : alive) {
+            if (offset + slot.size <= other->offset) break;
+            offset = std::max(offset,
+                    dnnl::impl::utils::rnd_up(
+                            other->offset + other->size, alignment));
+        }
+        slot.offset = offset;
+        total = std::max(total, offset + slot.size);
+        placed.push_back(idx);
+    }
+    return dnnl::impl::utils::rnd_up(total, alignment);
+}
+
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+status_t dnnl_graph_compiled_graph::init(const graph_t &agraph,
+        const engine_t *aengine,
+        const std::vector<const logical_tensor_t *> &inputs,
+        const std::vector<const logical_tensor_t *> &outputs) {
+    // the graph must have been partitioned
+    if (!agraph.is_finalized() || agraph.get_num_partitions() == 0)
+        return status::invalid_graph;
+    if (aengine->kind() != agraph.get_engine_kind())
+        return status::invalid_arguments;
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    // OpenCL buffers cannot be offset by the tensors placed in the buffer
+    if (aengine->kind() == engine_kind::gpu) return status::unimplemented;
+#endif
+    engine_ = aengine;
+
+    const size_t num_parts = agraph.get_num_partitions();
+    std::vector<partition_t *> parts;
+    parts.reserve(num_parts);
+    for (size_t i = 0; i < num_parts; ++i) {
+        partitions_.emplace_back(new partition_t());
+        parts.push_back(partitions_.back().get());
+    }
+    CHECK(agraph.get_ordered_partitions(parts));
+
+    for (const auto *lt : inputs)
+        input_lts_[lt->id] = *lt;
+    for (const auto *lt : outputs)
+        output_lts_[lt->id] = *lt;
+
+    // the compiled logical tensors of all partition outputs
+    std::unordered_map<size_t, logical_tensor_t> produced;
+    // the indices of the producer and of the last consumer of each output
+    std::unordered_map<size_t, std::pair<size_t, size_t>> lifetimes;
+
+    for (size_t i = 0; i < num_parts; ++i) {
+        const auto *part = parts[i];
+        if (!part->is_supported()) return status::unimplemented;
+
+        std::vector<const logical_tensor_t *> in_lts;
+        for (const auto &port : part->get_inputs()) {
+            auto in_it = input_lts_.find(port.id);
+            if (in_it != input_lts_.end()) {
+                in_lts.push_back(&in_it->second);
+                continue;
+            }
+            auto prod_it = produced.find(port.id);
+            // the input is neither given nor produced by a former partition
+            if (prod_it == produced.end()) return status::invalid_arguments;
+            in_lts.push_back(&prod_it->second);
+            lifetimes[port.id].second = i;
+        }
+
+        // the outputs which are not outputs of the graph are compiled with
+        // the layout chosen by the library
+        std::vector<logical_tensor_t> inner_lts;
+        inner_lts.reserve(part->get_outputs_num());
+        std::vector<const logical_tensor_t *> out_lts;
+        for (const auto &port : part->get_outputs()) {
+            auto out_it = output_lts_.find(port.id);
+            if (out_it != output_lts_.end()) {
+                out_lts.push_back(&out_it->second);
+                continue;
+            }
+            inner_lts.push_back(port);
+            inner_lts.back().layout_type = layout_type::any;
+            out_lts.push_back(&inner_lts.back());
+        }
+
+        compiled_partitions_.emplace_back(new compiled_partition_t(*part));
+        auto *cp = compiled_partitions_.back().get();
+        std::pair<compiled_partition_t *, dnnl::impl::cache_state_t> cp_pair {
+                cp, dnnl::impl::cache_state_t::compiled_partition_hit};
+        CHECK(part->compile(cp_pair, in_lts, out_lts, engine_));
+
+        for (const auto &port : part->get_outputs()) {
+            logical_tensor_t lt;
+            CHECK(cp->query_logical_tensor(port.id, &lt));
+            produced[port.id] = lt;
+            lifetimes[port.id] = {i, i};
+            auto out_it = output_lts_.find(port.id);
+            if (out_it != output_lts_.end()) out_it->second = lt;
+        }
+    }
+
+    for (const auto &out : output_lts_) {
+        if (!produced.count(out.first)) return status::invalid_arguments;
+    }
+
+    // plan the tensors which are neither inputs nor outputs of the graph
+    std::vector<buffer_slot_t> slots;
+    std::unordered_map<size_t, size_t> slot_of;
+    for (const auto &prod : produced) {
+        if (output_lts_.count(prod.first)) continue;
+        const auto &lifetime = lifetimes.at(prod.first);
+        slot_of[prod.first] = slots.size();
+        const size_t size = logical_tensor_wrapper_t(prod.second).size();
+        slots.push_back(
+                {prod.first, size, lifetime.first, lifetime.second, 0});
+    }
+    mem_size_ = plan_buffer_slots(slots, buffer_alignment);
+
+    char *base = nullptr;
+    if (mem_size_ > 0) {
+        logical_tensor_t buf_lt = empty_logical_tensor_with_default_id();
+        buf_lt.data_type = data_type::u8;
+        buf_lt.ndims = 1;
+        buf_lt.dims[0] = static_cast<dim_t>(mem_size_);
+        buf_lt.layout_type = layout_type::strided;
+        buf_lt.layout.strides[0] = 1;
+        buf_lt.property = property_type::variable;
+        buffer_ = std::make_shared<tensor_t>(
+                buf_lt, engine_, DNNL_MEMORY_ALLOCATE);
+        base = static_cast<char *>(buffer_->get_data_handle());
+        if (!base) return status::out_of_memory;
+    }
+
+    // bind the arguments of each compiled partition
+    args_.resize(num_parts);
+    for (size_t i = 0; i < num_parts; ++i) {
+        const auto *cp = compiled_partitions_[i].get();
+        auto &args = args_[i];
+        auto bind = [&](const std::vector<logical_tensor_t> &lts,
+                            std::vector<tensor_t> &tensors,
+                            std::vector<std::pair<size_t, size_t>> &user) {
+            for (const auto &lt : lts) {
+                auto slot_it = slot_of.find(lt.id);
+                if (slot_it == slot_of.end()) {
+                    user.emplace_back(tensors.size(), lt.id);
+                    tensors.emplace_back();
+                } else {
+                    const auto &slot = slots[slot_it->second];
+                    tensors.emplace_back(lt, engine_, base + slot.offset);
+                }
+            }
+        };
+        bind(cp->get_inputs(), args.inputs, args.user_inputs);
+        bind(cp->get_outputs(), args.outputs, args.user_outputs);
+    }
+
+    return status::success;
+}
+
+status_t dnnl_graph_compiled_graph::execute(stream_t *astream,
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs) const {
+    if (astream->engine()->kind() != engine_->kind())
+        return status::invalid_arguments;
+
+    std::unordered_map<size_t, const tensor_t *> user_tensors;
+    for (const auto &t : inputs)
+        user_tensors[t.get_logical_tensor().id] = &t;
+    for (const auto &t : outputs)
+        user_tensors[t.get_logical_tensor().id] = &t;
+    for (const auto *lts : {&input_lts_, &output_lts_}) {
+        for (const auto &lt : *lts) {
+            if (!user_tensors.count(lt.first)) return status::invalid_arguments;
+        }
+    }
+
+    const bool profile = get_verbose(dnnl::impl::verbose_t::exec_profile,
+            dnnl::impl::component_t::graph);
+    for (size_t i = 0; i < compiled_partitions_.size(); ++i) {
+        const auto *cp = compiled_partitions_[i].get();
+        std::vector<tensor_t> ins = args_[i].inputs;
+        std::vector<tensor_t> outs = args_[i].outputs;
+        for (const auto &pos : args_[i].user_inputs)
+            ins[pos.first] = *user_tensors.at(pos.second);
+        for (const auto &pos : args_[i].user_outputs)
+            outs[pos.first] = *user_tensors.at(pos.second);
+
+        if (profile) {
+            astream->wait();
+            double start_ms = dnnl::impl::get_msec();
+            CHECK(cp->execute(astream, ins, outs));
+            astream->wait();
+            double duration_ms = dnnl::impl::get_msec() - start_ms;
+            VPROF(start_ms, graph, exec, VERBOSE_profile, cp->info(),
+                    duration_ms);
+        } else {
+            CHECK(cp->execute(astream, ins, outs));
+        }
+    }
+    return status::success;
+}
+
+status_t dnnl_graph_compiled_graph::query_logical_tensor(
+        size_t tid, logical_tensor_t *lt) const {
+    for (const auto *lts : {&input_lts_, &output_lts_}) {
+        auto it = lts->find(tid);
+        if (it != lts->end()) {
+            *lt = it->second;
+            return status::success;
+        }
+    }
+    return status::invalid_arguments;
+}
+
+status_t DNNL_API dnnl_graph_compiled_graph_create(
+        compiled_graph_t **compiled_graph, graph_t *graph, engine_t *engine,
+        size_t num_inputs, const logical_tensor_t **inputs, size_t num_outputs,
+        const logical_tensor_t **outputs) {
+    if (utils::any_null(compiled_graph, graph, engine)
+            || (num_inputs > 0 && inputs == nullptr)
+            || (num_outputs > 0 && outputs == nullptr)) {
+        return status::invalid_arguments;
+    }
+
+    std::vector<const logical_tensor_t *> in {inputs, inputs + num_inputs};
+    std::vector<const logical_tensor_t *> out {outputs, outputs + num_outputs};
+
+    std::unique_ptr<compiled_graph_t> cg(new compiled_graph_t());
+    CHECK(cg->init(*graph, engine, in, out));
+    *compiled_graph = cg.release();
+    return status::success;
+}
+
+status_t DNNL_API dnnl_graph_compiled_graph_execute(
+        const compiled_graph_t *compiled_graph, stream_t *stream,
+        size_t num_inputs, const tensor_t **inputs, size_t num_outputs,
+        const tensor_t **outputs) {
+    if (utils::any_null(stream, compiled_graph, outputs)
+            || (num_inputs > 0 && inputs == nullptr)) {
+        return status::invalid_arguments;
+    }
+
+    std::vector<tensor_t> ins, outs;
+    ins.reserve(num_inputs);
+    outs.reserve(num_outputs);
+    for (size_t i = 0; i < num_inputs; ++i) {
+        ins.emplace_back(**(inputs + i));
+    }
+    for (size_t i = 0; i < num_outputs; ++i) {
+        outs.emplace_back(**(outputs + i));
+    }
+
+    return compiled_graph->execute(stream, ins, outs);
+}
+
+status_t DNNL_API dnnl_graph_compiled_graph_query_logical_tensor(
+        const compiled_graph_t *compiled_graph, size_t tid,
+        logical_tensor_t *lt) {
+    if (utils::any_null(compiled_graph, lt)) return status::invalid_arguments;
+    return compiled_graph->query_logical_tensor(tid, lt);
+}
+
+status_t DNNL_API dnnl_graph_compiled_graph_get_memory_size(
+        const compiled_graph_t *compiled_graph, size_t *size) {
+    if (utils::any_null(compiled_graph, size)) return status::invalid_arguments;
+    *size = compiled_graph->get_memory_size();
+    return status::success;
+}
+
+status_t DNNL_API dnnl_graph_compiled_graph_destroy(
+        compiled_graph_t *compiled_graph) {
+    delete compiled_graph;
+    return status::success;
+}
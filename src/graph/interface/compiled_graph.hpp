@@ -0,0 +1,122 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_INTERFACE_COMPILED_GRAPH_HPP
+#define GRAPH_INTERFACE_COMPILED_GRAPH_HPP
+
+#include <memory>
+#include <utility>
+#include <vector>
+#include <unordered_map>
+
+#include "graph/interface/c_types_map.hpp"
+#include "graph/interface/graph.hpp"
+#include "graph/interface/logical_tensor.hpp"
+#include "graph/interface/partition.hpp"
+#include "graph/interface/tensor.hpp"
+
+#include "graph/utils/id.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+
+// The intermediate tensors of a compiled graph which are placed in its
+// buffer. Each tensor is alive from the partition producing it to the last
+// partition consuming it, both given by their index in execution order.
+struct buffer_slot_t {
+    size_t tid;
+    size_t size;
+    size_t first;
+    size_t last;
+    size_t offset;
+};
+
+// Assigns the offsets of the slots so that the slots alive at the same time
+// do not overlap, and returns the size of the buffer. Larger slots are placed
+// first, each at the lowest aligned offset which fits between the slots
+// already placed.
+size_t plan_buffer_slots(std::vector<buffer_slot_t> &slots, size_t alignment);
+
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+///
+/// \brief dnnl_graph_compiled_graph_t
+///
+struct dnnl_graph_compiled_graph : public dnnl::impl::graph::utils::id_t {
+public:
+    dnnl_graph_compiled_graph() = default;
+
+    // disable copy and assign
+    dnnl_graph_compiled_graph(const dnnl_graph_compiled_graph &) = delete;
+    dnnl_graph_compiled_graph &operator=(const dnnl_graph_compiled_graph &)
+            = delete;
+
+    ~dnnl_graph_compiled_graph() = default;
+
+    dnnl::impl::graph::status_t init(const dnnl::impl::graph::graph_t &agraph,
+            const dnnl::impl::graph::engine_t *aengine,
+            const std::vector<const dnnl::impl::graph::logical_tensor_t *>
+                    &inputs,
+            const std::vector<const dnnl::impl::graph::logical_tensor_t *>
+                    &outputs);
+
+    dnnl::impl::graph::status_t execute(dnnl::impl::graph::stream_t *astream,
+            const std::vector<dnnl::impl::graph::tensor_t> &inputs,
+            const std::vector<dnnl::impl::graph::tensor_t> &outputs) const;
+
+    dnnl::impl::graph::status_t query_logical_tensor(
+            size_t tid, dnnl::impl::graph::logical_tensor_t *lt) const;
+
+    size_t get_memory_size() const { return mem_size_; }
+
+    size_t num_partitions() const { return compiled_partitions_.size(); }
+
+    const dnnl::impl::graph::engine_t *get_engine() const { return engine_; }
+
+private:
+    // The arguments of a compiled partition. The intermediate tensors are
+    // bound to the buffer when the graph is compiled, while the positions of
+    // the inputs and outputs of the graph are filled with the user tensors on
+    // each execution.
+    struct args_t {
+        std::vector<dnnl::impl::graph::tensor_t> inputs;
+        std::vector<dnnl::impl::graph::tensor_t> outputs;
+        // pairs of {position, tensor id}
+        std::vector<std::pair<size_t, size_t>> user_inputs;
+        std::vector<std::pair<size_t, size_t>> user_outputs;
+    };
+
+    const dnnl::impl::graph::engine_t *engine_ {nullptr};
+
+    std::vector<std::unique_ptr<dnnl::impl::graph::partition_t>> partitions_;
+    std::vector<std::unique_ptr<dnnl::impl::graph::compiled_partition_t>>
+            compiled_partitions_;
+    std::vector<args_t> args_;
+
+    // the logical tensors of the inputs and outputs of the graph
+    std::unordered_map<size_t, dnnl::impl::graph::logical_tensor_t> input_lts_;
+    std::unordered_map<size_t, dnnl::impl::graph::logical_tensor_t>
+            output_lts_;
+
+    // the buffer holding all the intermediate tensors
+    std::shared_ptr<dnnl::impl::graph::tensor_t> buffer_;
+    size_t mem_size_ {0};
+};
+
+#endif
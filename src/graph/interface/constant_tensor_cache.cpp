@@ -157,7 +157,8 @@ c_key_t constant_tensor_cache_t::combine_key(
 }
 
 c_value_t constant_tensor_cache_t::get_or_add(c_key_t backend_id,
-        c_key_t backend_specific_key, size_t size, const c_value_t &value) {
+        c_key_t backend_specific_key, size_t size, const c_value_t &value,
+        const void *requester) {
     if (!size) { return c_value_t(); }
 
     c_key_t key = combine_key(backend_id, backend_specific_key);
@@ -171,7 +172,7 @@ c_value_t constant_tensor_cache_t::get_or_add(c_key_t backend_id,
     }
     // Check if the requested entry is present in the cache (likely cache_hit)
     auto e = get(key);
-    if (e.valid()) {
+    if (e.valid() && has_requester(key, requester)) {
         unlock_read();
         return e;
     }
@@ -195,7 +196,10 @@ c_value_t constant_tensor_cache_t::get_or_add(c_key_t backend_id,
     e = get(key);
     if (!e.valid()) {
         // If the entry is missing in the cache then add it (cache_miss)
-        add(key, size, value);
+        add(key, size, value, requester);
+    } else if (!has_requester(key, requester)) {
+        // The entry was added by another requester, which shares it now
+        constant_map().at(key).requesters_.push_back(requester);
     }
     unlock_write();
     return e;
@@ -220,6 +224,17 @@ void constant_tensor_cache_t::remove_if_exist(
     }
 }
 
+void constant_tensor_cache_t::remove_requester(const void *requester) {
+    lock_write();
+    for (auto &pair : constant_map()) {
+        auto &requesters = pair.second.requesters_;
+        requesters.erase(
+                std::remove(requesters.begin(), requesters.end(), requester),
+                requesters.end());
+    }
+    unlock_write();
+}
+
 // Get the total size of all cached buffers
 size_t constant_tensor_cache_t::get_size() const {
     size_t total_size = 0;
@@ -229,8 +244,28 @@ size_t constant_tensor_cache_t::get_size() const {
     return total_size;
 }
 
-void constant_tensor_cache_t::add(
-        const c_key_t &key, size_t size, const c_value_t &constant) {
+size_t constant_tensor_cache_t::get_shared_size() {
+    lock_read();
+    size_t shared_size = 0;
+    for (const auto &pair : constant_map()) {
+        const size_t num_requesters = pair.second.requesters_.size();
+        if (num_requesters > 1)
+            shared_size += (num_requesters - 1) * pair.second.size_;
+    }
+    unlock_read();
+    return shared_size;
+}
+
+bool constant_tensor_cache_t::has_requester(
+        const c_key_t &key, const void *requester) const {
+    if (!requester) return true;
+    const auto &requesters = constant_map().at(key).requesters_;
+    return std::find(requesters.begin(), requesters.end(), requester)
+            != requesters.end();
+}
+
+void constant_tensor_cache_t::add(const c_key_t &key, size_t size,
+        const c_value_t &constant, const void *requester) {
     size_t current_size = get_size();
 
     // No enough capacity to cache the new tensor, ignore the new tensor
@@ -242,7 +277,7 @@ void constant_tensor_cache_t::add(
 
     auto res = constant_map().emplace(std::piecewise_construct,
             std::forward_as_tuple(key),
-            std::forward_as_tuple(constant, timestamp));
+            std::forward_as_tuple(constant, timestamp, size, requester));
     UNUSED(res);
     assert(res.second);
 }
@@ -519,3 +554,17 @@ dnnl::impl::graph::status_t dnnl_graph_get_constant_tensor_cache_capacity(
 
     return dnnl::impl::graph::status::success;
 }
+
+dnnl::impl::graph::status_t dnnl_graph_get_constant_tensor_cache_shared_size(
+        dnnl_engine_kind_t eng_kind, size_t *size) {
+    if (size == nullptr) return dnnl::impl::graph::status::invalid_arguments;
+    *size = 0;
+    auto &caches = dnnl::impl::graph::global_cache_manager_t::get_instance()
+                           .get_caches();
+    if (caches.count(eng_kind)) {
+        for (auto &cache : caches.at(eng_kind)) {
+            if (cache) *size += cache->get_shared_size();
+        }
+    }
+    return dnnl::impl::graph::status::success;
+}
@@ -22,6 +22,7 @@
 #include <limits>
 #include <memory>
 #include <type_traits>
+#include <vector>
 #include <unordered_map>
 
 #include "common/c_types_map.hpp"
@@ -108,12 +109,24 @@ struct constant_tensor_cache_t {
     status_t set_capacity(size_t capacity);
     size_t get_capacity();
 
+    // The requester identifies the object asking for the buffer, like a
+    // kernel. A buffer requested by several requesters is shared by them
+    // instead of being created by each of them.
     value_t get_or_add(key_t backend_id, key_t backend_specific_key,
-            size_t size, const value_t &value);
+            size_t size, const value_t &value,
+            const void *requester = nullptr);
     void remove_if_exist(key_t backend_id, key_t backend_specific_key);
 
+    // Stop sharing the cached buffers with the requester, for example when
+    // the kernel which requested them is destroyed. The buffers stay cached.
+    void remove_requester(const void *requester);
+
     size_t get_size() const;
 
+    // Get the size of the buffers which would be held in addition if each
+    // requester had its own copy of the cached buffers
+    size_t get_shared_size();
+
     // The key_t is composed of two parts: backend id and backend specific key.
     // The backend id occupies 4 bits, and the backend specific key occupies the
     // remained 60 bits. So backends should ensure not encode any information in
@@ -125,7 +138,9 @@ struct constant_tensor_cache_t {
 private:
     void evict(size_t n);
     value_t get(const key_t &key);
-    void add(const key_t &key, size_t size, const value_t &constant);
+    void add(const key_t &key, size_t size, const value_t &constant,
+            const void *requester);
+    bool has_requester(const key_t &key, const void *requester) const;
 
     void lock_read() { rw_mutex_.lock_read(); }
     void lock_write() { rw_mutex_.lock_write(); }
@@ -142,8 +157,15 @@ private:
     struct timed_entry_t {
         value_t value_;
         std::atomic<size_t> timestamp_;
-        timed_entry_t(const value_t &value, size_t timestamp)
-            : value_(value), timestamp_(timestamp) {}
+        size_t size_;
+        // the requesters sharing the buffer
+        std::vector<const void *> requesters_;
+        timed_entry_t(const value_t &value, size_t timestamp, size_t size,
+                const void *requester)
+            : value_(value)
+            , timestamp_(timestamp)
+            , size_(size)
+            , requesters_({requester}) {}
     };
 
     std::unordered_map<key_t, timed_entry_t> &constant_map() {
@@ -318,6 +318,7 @@ public:
             CASE(axis);
             CASE(begin_norm_axis);
             CASE(groups);
+            CASE(k);
             CASE(group_shape);
             CASE(axes);
             CASE(dilations);
@@ -390,6 +391,7 @@ public:
             CASE(DynamicQuantize);
             CASE(Elu);
             CASE(EluBackward);
+            CASE(EmbeddingBag);
             CASE(End);
             CASE(Exp);
             CASE(GELU);
@@ -449,6 +451,7 @@ public:
             CASE(Subtract);
             CASE(Tanh);
             CASE(TanhBackward);
+            CASE(TopK);
             CASE(TypeCast);
             CASE(Wildcard);
             CASE(LastSymbol);
@@ -704,6 +704,10 @@ status_t dnnl_graph_compiled_partition::execute(const stream_t *astream,
                 || (astream->engine()->kind() != pimpl_->get_engine()->kind()))
             return status::invalid_arguments;
 
+        // Kernels run host code and release temporary buffers right away,
+        // while a stream capture would defer their primitives to the replay.
+        if (astream->capture()) return status::unimplemented;
+
         const backend_t *backend = src_partition_.get_assigned_backend();
         if (!backend) return status::invalid_arguments;
 
@@ -23,6 +23,7 @@
 #include <typeindex>
 #include <vector>
 #include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "oneapi/dnnl/dnnl_graph.h"
@@ -109,6 +110,10 @@ inline size_t get_array_hash<logical_tensor_t>(
     return seed;
 }
 
+size_t get_attributes_hash(
+        const std::unordered_map<op_attr_t, utils::attribute_value_t>
+                &attributes);
+
 size_t get_op_hash(const op_t &op);
 
 inline size_t get_array_hash(size_t seed, std::vector<op_t *> &ops) {
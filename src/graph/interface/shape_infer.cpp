@@ -1770,6 +1770,79 @@ status_t infer_groupnorm_output_shape(op_t *n,
     return status::success;
 }
 
+status_t infer_embedding_bag_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto table = logical_tensor_wrapper_t(inputs[0]);
+    auto indices = logical_tensor_wrapper_t(inputs[1]);
+    VCHECK_INVALID_SHAPE(table.ndims() == 2,
+            "%s, table should be a 2D tensor, but got %d dims",
+            op_t::kind2str(n->get_kind()).c_str(), table.ndims());
+    VCHECK_INVALID_SHAPE(indices.ndims() == 1,
+            "%s, indices should be a 1D tensor, but got %d dims",
+            op_t::kind2str(n->get_kind()).c_str(), indices.ndims());
+
+    // output_dims[n_bags, embedding_dim], where a bag is a single index when
+    // offsets are not provided.
+    dim_t n_bags = indices.dims()[0];
+    if (inputs.size() > 2) {
+        auto offsets = logical_tensor_wrapper_t(inputs[2]);
+        VCHECK_INVALID_SHAPE(offsets.ndims() == 1,
+                "%s, offsets should be a 1D tensor, but got %d dims",
+                op_t::kind2str(n->get_kind()).c_str(), offsets.ndims());
+        n_bags = offsets.dims()[0];
+    }
+    const dims output_dims = {n_bags, table.dims()[1]};
+
+    auto out0 = logical_tensor_wrapper_t(outputs[0]);
+    if (!out0.is_shape_unknown()) {
+        VCHECK_INVALID_SHAPE(validate(output_dims, out0.vdims()),
+                "%s, inferred out shape and output shape are not compatible",
+                op_t::kind2str(n->get_kind()).c_str());
+        return status::success;
+    }
+
+    set_shape_and_strides(*outputs[0], output_dims);
+    return status::success;
+}
+
+status_t infer_topk_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto in0 = logical_tensor_wrapper_t(inputs[0]);
+    const int ndims = in0.ndims();
+    int64_t axis = n->get_attr<int64_t>(op_attr::axis);
+    VCHECK_INVALID_SHAPE(axis >= -ndims && axis < ndims,
+            "%s, axis %d is out of range [%d, %d)",
+            op_t::kind2str(n->get_kind()).c_str(), static_cast<int>(axis),
+            -ndims, ndims);
+    if (axis < 0) axis += ndims;
+
+    const int64_t k = n->get_attr<int64_t>(op_attr::k);
+    VCHECK_INVALID_SHAPE(k > 0 && k <= in0.dims()[axis],
+            "%s, k should be in range [1, %ld], but got %ld",
+            op_t::kind2str(n->get_kind()).c_str(),
+            static_cast<long int>(in0.dims()[axis]), static_cast<long int>(k));
+
+    // Both values and indices have the shape of the source, with k elements
+    // along the axis.
+    dims output_dims = in0.vdims();
+    output_dims[axis] = k;
+
+    for (size_t i = 0; i < 2; i++) {
+        auto out = logical_tensor_wrapper_t(outputs[i]);
+        if (!out.is_shape_unknown()) {
+            VCHECK_INVALID_SHAPE(validate(output_dims, out.vdims()),
+                    "%s, inferred out shape and output shape are not "
+                    "compatible",
+                    op_t::kind2str(n->get_kind()).c_str());
+            continue;
+        }
+        set_shape_and_strides(*outputs[i], output_dims);
+    }
+    return status::success;
+}
+
 } // namespace graph
 } // namespace impl
 } // namespace dnnl
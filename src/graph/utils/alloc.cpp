@@ -14,6 +14,12 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <iterator>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
 #include "graph/utils/alloc.hpp"
 
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
@@ -79,6 +85,98 @@ void cpu_allocator_t::free(void *p) {
 #endif /* _WIN32 */
 }
 
+host_arena_t::~host_arena_t() {
+    for (auto &block : free_blocks_)
+        cpu_allocator_t::free(block.second);
+}
+
+size_t host_arena_t::get_block_size(size_t size) {
+    // Small blocks are rounded up to a power of two, so that they are reused
+    // by requests of a close size, and large blocks to whole huge pages
+    if (size >= HUGE_PAGE_SIZE)
+        return dnnl::impl::utils::rnd_up(size, HUGE_PAGE_SIZE);
+    size_t block_size = PAGE_SIZE;
+    while (block_size < size)
+        block_size *= 2;
+    return block_size;
+}
+
+void *host_arena_t::malloc(size_t size, size_t alignment) {
+    if (alignment > PAGE_SIZE) return nullptr;
+    const size_t block_size = get_block_size(size);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    num_requests_++;
+    // reuse a free block unless it is more than twice as large as needed
+    auto it = free_blocks_.lower_bound(block_size);
+    if (it != free_blocks_.end() && it->first < 2 * block_size) {
+        void *p = it->second;
+        used_blocks_.emplace(p, it->first);
+        idle_size_ -= it->first;
+        free_blocks_.erase(it);
+        num_hits_++;
+        return p;
+    }
+
+    const bool huge = block_size >= HUGE_PAGE_SIZE;
+    void *p = cpu_allocator_t::malloc(
+            block_size, huge ? HUGE_PAGE_SIZE : PAGE_SIZE);
+    if (!p) return nullptr;
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // a hint only, the block is still usable if huge pages are not available
+    if (huge) madvise(p, block_size, MADV_HUGEPAGE);
+#endif
+    used_blocks_.emplace(p, block_size);
+    resident_size_ += block_size;
+    return p;
+}
+
+bool host_arena_t::free(void *p) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = used_blocks_.find(p);
+    if (it == used_blocks_.end()) return false;
+    free_blocks_.emplace(it->second, p);
+    idle_size_ += it->second;
+    used_blocks_.erase(it);
+    release_free_blocks(max_idle_size_);
+    return true;
+}
+
+void host_arena_t::trim() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    release_free_blocks(0);
+}
+
+void host_arena_t::release_free_blocks(size_t max_size) {
+    while (idle_size_ > max_size) {
+        auto it = std::prev(free_blocks_.end());
+        cpu_allocator_t::free(it->second);
+        idle_size_ -= it->first;
+        resident_size_ -= it->first;
+        free_blocks_.erase(it);
+    }
+}
+
+size_t host_arena_t::get_num_requests() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_requests_;
+}
+
+size_t host_arena_t::get_num_hits() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_hits_;
+}
+
+size_t host_arena_t::get_resident_size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return resident_size_;
+}
+
+size_t host_arena_t::get_idle_size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return idle_size_;
+}
+
 } // namespace utils
 } // namespace graph
 } // namespace impl
@@ -17,6 +17,10 @@
 #ifndef GRAPH_UTILS_ALLOC_HPP
 #define GRAPH_UTILS_ALLOC_HPP
 
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
 #include "graph/interface/c_types_map.hpp"
 #include "graph/utils/utils.hpp"
 
@@ -41,6 +45,59 @@ public:
     static void free(void *p);
 };
 
+/// Arena of host memory reused by the temporary buffers. The memory is held
+/// in blocks which are kept when freed and given to the later requests of a
+/// close size. The blocks of at least the huge page size are backed by huge
+/// pages where the system supports it. The free blocks are kept up to a limit
+/// on their total size, beyond which the largest of them are returned to the
+/// system. All the memory is returned when the arena is destroyed.
+class host_arena_t {
+public:
+    constexpr static size_t PAGE_SIZE = 4 * 1024;
+    constexpr static size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+    constexpr static size_t DEFAULT_MAX_IDLE_SIZE = 256 * 1024 * 1024;
+
+    explicit host_arena_t(size_t max_idle_size = DEFAULT_MAX_IDLE_SIZE)
+        : max_idle_size_(max_idle_size) {}
+    ~host_arena_t();
+
+    // Disable assignment and copy
+    host_arena_t(const host_arena_t &) = delete;
+    host_arena_t &operator=(const host_arena_t &) = delete;
+
+    /// Returns nullptr if the requested alignment exceeds the page size
+    void *malloc(size_t size, size_t alignment);
+    /// Returns false if the buffer was not allocated by the arena
+    bool free(void *p);
+    /// Returns all the free blocks to the system
+    void trim();
+
+    size_t get_num_requests() const;
+    size_t get_num_hits() const;
+    /// Size of the blocks in use and of the free blocks kept for reuse. It
+    /// decreases when the free blocks exceed the limit or are trimmed.
+    size_t get_resident_size() const;
+    /// Size of the free blocks kept for reuse, at most the limit
+    size_t get_idle_size() const;
+
+private:
+    static size_t get_block_size(size_t size);
+    // returns the largest free blocks to the system until at most max_size
+    // bytes are left, must be called under the lock
+    void release_free_blocks(size_t max_size);
+
+    mutable std::mutex mutex_;
+    // free blocks ordered by size
+    std::multimap<size_t, void *> free_blocks_;
+    // size of the blocks in use
+    std::unordered_map<void *, size_t> used_blocks_;
+    size_t num_requests_ = 0;
+    size_t num_hits_ = 0;
+    size_t resident_size_ = 0;
+    size_t idle_size_ = 0;
+    const size_t max_idle_size_;
+};
+
 #ifdef DNNL_WITH_SYCL
 /// Default allocator for SYCL device
 class sycl_allocator_t {
@@ -15,15 +15,23 @@
 *******************************************************************************/
 
 #include <algorithm> // for std::reverse and std::copy
+#include <atomic>
+#include <chrono>
 #include <functional> // for std::bind and std::placeholders
 #include <list>
 #include <numeric>
 #include <string> // for std::string
+#include <thread>
 #include <utility> // for std::pair
 #include <vector> // for std::vector
 
 #include <assert.h>
 
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #include "oneapi/dnnl/dnnl.hpp"
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
 #include "oneapi/dnnl/dnnl_ocl.hpp"
@@ -269,6 +277,8 @@ memory_kind_ext_t memory_kind {default_memory_kind};
 
 int default_num_streams = 1;
 int num_streams = default_num_streams;
+int default_num_instances = 1;
+int num_instances = default_num_instances;
 
 void init_isa_settings() {
     if (hints.get() == isa_hints_t::no_hints) {
@@ -608,20 +618,173 @@ inline int measure_perf_aggregate(timer::timer_t &t,
     return OK;
 }
 
+// Multi-instance mode is supported only when instances can run in independent
+// threading contexts. Threadpool streams share a single testing threadpool,
+// which `--num-instances` parsing rejects.
+static bool use_multi_instance(const dnnl_engine_t &engine) {
+    if (num_instances <= 1) return false;
+    const bool ok = is_cpu(engine) && !is_sycl_engine(engine);
+    if (!ok) {
+        static bool warned = false;
+        if (!warned) {
+            BENCHDNN_PRINT(0, "%s\n",
+                    "Warning: `--num-instances` is supported for non-SYCL CPU "
+                    "engines only and is ignored.");
+            warned = true;
+        }
+    }
+    return ok;
+}
+
+struct instance_stats_t {
+    int status = OK;
+    // Latencies of individual executions in ms and in ticks.
+    std::vector<double> ms;
+    std::vector<uint64_t> ticks;
+    std::chrono::steady_clock::time_point begin, end;
+};
+
+// Pins the calling thread to the `idx`-th out of `n` equal chunks of CPUs the
+// process is allowed to run on. Worker threads spawned afterwards by the
+// calling thread (e.g. an OpenMP team) inherit the mask.
+static void pin_instance_thread(int idx, int n) {
+#ifdef __linux__
+    cpu_set_t process_set;
+    CPU_ZERO(&process_set);
+    if (sched_getaffinity(0, sizeof(process_set), &process_set) != 0) return;
+
+    std::vector<int> cpus;
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        if (CPU_ISSET(cpu, &process_set)) cpus.push_back(cpu);
+    const int chunk = static_cast<int>(cpus.size()) / n;
+    if (chunk == 0) return;
+
+    cpu_set_t instance_set;
+    CPU_ZERO(&instance_set);
+    for (int i = idx * chunk; i < (idx + 1) * chunk; i++)
+        CPU_SET(cpus[i], &instance_set);
+    pthread_setaffinity_np(pthread_self(), sizeof(instance_set), &instance_set);
+#endif
+}
+
+static int measure_perf_instance(instance_stats_t &stats, dnnl_stream_t stream,
+        perf_function_t &perf_func, std::vector<dnnl_exec_arg_t> &dnnl_args,
+        cold_cache_t &cold_cache) {
+    timer::timer_t t;
+    stats.begin = std::chrono::steady_clock::now();
+    t.reset();
+    while (true) {
+        if (!cold_cache.update_dnnl_args(dnnl_args)) break;
+        const double ms_before = t.total_ms();
+        const uint64_t ticks_before = t.ticks_[timer::timer_t::sum];
+        t.start();
+        DNN_SAFE(perf_func(stream, dnnl_args), WARN);
+        t.stamp();
+        stats.ms.push_back(t.total_ms() - ms_before);
+        stats.ticks.push_back(t.ticks_[timer::timer_t::sum] - ticks_before);
+        if (should_stop(t)) break;
+    }
+    stats.end = std::chrono::steady_clock::now();
+    return OK;
+}
+
+// Runs `num_instances` concurrent instances of the same problem, each in its
+// own thread with its own stream, memory and CPU subset, to model serving
+// workloads. The perf timer gets latencies of all executions of all
+// instances, and aggregate throughput together with per-instance tail
+// latencies are reported separately.
+static int measure_perf_multi_instance(const thr_ctx_t &ctx,
+        timer::timer_t &t, const std::vector<stream_t> &v_stream,
+        perf_function_t &perf_func,
+        std::vector<std::vector<dnnl_exec_arg_t>> &dnnl_args) {
+    const int n = num_instances;
+    std::vector<instance_stats_t> stats(n);
+    std::vector<cold_cache_t> cold_cache(n);
+    for (int i = 0; i < n; i++)
+        cold_cache[i] = cold_cache_t(dnnl_args[i], v_stream[i]);
+
+    // Instances wait for each other to start measurements at the same time.
+    std::atomic<int> n_ready(0);
+    std::vector<std::thread> threads;
+    threads.reserve(n);
+    for (int i = 0; i < n; i++) {
+        threads.emplace_back([&, i]() {
+            pin_instance_thread(i, n);
+            // Warm-up run, it also spawns worker threads of the instance.
+            auto warm_up = [&](dnnl_stream_t stream,
+                                   std::vector<dnnl_exec_arg_t> &args) {
+                DNN_SAFE(perf_func(stream, args), WARN);
+                return OK;
+            };
+            dnnl_stream_t stream = v_stream[i];
+            stats[i].status
+                    = execute_in_thr_ctx(ctx, warm_up, stream, dnnl_args[i]);
+            n_ready++;
+            while (n_ready.load() < n)
+                std::this_thread::yield();
+            if (stats[i].status != OK) return;
+            stats[i].status = execute_in_thr_ctx(ctx, measure_perf_instance,
+                    stats[i], stream, perf_func, dnnl_args[i], cold_cache[i]);
+        });
+    }
+    for (auto &thr : threads)
+        thr.join();
+
+    t.reset();
+    auto begin = stats[0].begin;
+    auto end = stats[0].end;
+    size_t total_times = 0;
+    for (const auto &s : stats) {
+        if (s.status != OK) return s.status;
+        begin = std::min(begin, s.begin);
+        end = std::max(end, s.end);
+        total_times += s.ms.size();
+        for (size_t k = 0; k < s.ms.size(); k++)
+            t.stop(1, static_cast<int64_t>(s.ticks[k]), s.ms[k]);
+    }
+
+    const double wall_ms
+            = std::chrono::duration<double, std::milli>(end - begin).count();
+    BENCHDNN_PRINT(0,
+            "multi-instance: instances:%d executions:%zu wall:%g ms "
+            "throughput:%g execs/s\n",
+            n, total_times, wall_ms,
+            wall_ms > 0 ? 1e3 * total_times / wall_ms : 0.);
+    for (int i = 0; i < n; i++) {
+        auto ms = stats[i].ms;
+        if (ms.empty()) continue;
+        std::sort(ms.begin(), ms.end());
+        auto percentile = [&](double p) {
+            const size_t idx = static_cast<size_t>(p * (ms.size() - 1));
+            return ms[idx];
+        };
+        const double sum = std::accumulate(ms.begin(), ms.end(), 0.);
+        BENCHDNN_PRINT(0,
+                "multi-instance: instance:%d executions:%zu avg:%g p50:%g "
+                "p99:%g max:%g ms\n",
+                i, ms.size(), sum / ms.size(), percentile(0.5),
+                percentile(0.99), ms.back());
+    }
+    return OK;
+}
+
 int measure_perf(const thr_ctx_t &ctx, res_t *res, perf_function_t &perf_func,
         args_t &args) {
     if (!has_bench_mode_bit(mode_bit_t::perf)) return OK;
 
     const auto &engine = get_test_engine();
-    std::vector<stream_t> v_stream(num_streams);
-    for (int i = 0; i < num_streams; i++)
+    const bool multi_instance = use_multi_instance(engine);
+    // Each stream or instance works on its own copy of the memory.
+    const int n_copies = multi_instance ? num_instances : num_streams;
+    std::vector<stream_t> v_stream(n_copies);
+    for (int i = 0; i < n_copies; i++)
         v_stream[i] = stream_t(engine, ctx.get_interop_obj());
 
-    std::vector<std::vector<dnnl_exec_arg_t>> dnnl_args(num_streams);
-    std::vector<dnn_mem_map_t> mem_map(num_streams);
-    std::vector<args_t> v_args(num_streams);
+    std::vector<std::vector<dnnl_exec_arg_t>> dnnl_args(n_copies);
+    std::vector<dnn_mem_map_t> mem_map(n_copies);
+    std::vector<args_t> v_args(n_copies);
     v_args[0] = args;
-    for (int j = 1; j < num_streams; j++) {
+    for (int j = 1; j < n_copies; j++) {
         for (int i = 0; i < args.size(); i++) {
             int arg = args.arg(i);
             const auto &m = args.dnn_mem(i);
@@ -641,7 +804,10 @@ int measure_perf(const thr_ctx_t &ctx, res_t *res, perf_function_t &perf_func,
     // For DPCPP CPU and GPU: measure iterations in batches to hide driver
     // overhead. DPCPP CPU follows the model of GPU, thus, handled similar.
     int ret = OK;
-    if (is_cpu() && !is_sycl_engine(engine)) {
+    if (multi_instance) {
+        ret = measure_perf_multi_instance(
+                ctx, t, v_stream, perf_func, dnnl_args);
+    } else if (is_cpu() && !is_sycl_engine(engine)) {
         ret = execute_in_thr_ctx(ctx, measure_perf_individual, t, v_stream[0],
                 perf_func, dnnl_args[0]);
     } else {
@@ -651,7 +817,7 @@ int measure_perf(const thr_ctx_t &ctx, res_t *res, perf_function_t &perf_func,
 
     if (ret != OK) res->state = FAILED;
     execute_map_args(args);
-    for (int j = 1; j < num_streams; j++) {
+    for (int j = 1; j < n_copies; j++) {
         execute_map_args(v_args[j]);
     }
 
@@ -1104,6 +1270,63 @@ int get_gpu_cache_size(size_t &cache_size) {
     return OK;
 }
 
+// Measures the host memory bandwidth with a STREAM-like triad kernel,
+// `a[i] = b[i] + s * c[i]`, over arrays that do not fit the caches. The
+// result is the best out of several runs and is computed once per process.
+int get_cpu_peak_bw(double &peak_bw) {
+    static double _peak_bw = 0;
+    if (_peak_bw > 0) {
+        peak_bw = _peak_bw;
+        return OK;
+    }
+
+    cpu_cache_args_t cache_args;
+    SAFE(get_cpu_cache_size(cache_args), WARN);
+    // Each array is at least as large as all caches together, but the whole
+    // working set takes at most a quarter of RAM.
+    const size_t array_size = MIN2(
+            MAX2(cache_args.total_socket_size, (size_t)64 * 1024 * 1024),
+            get_cpu_ram_size() / 12);
+    const int64_t nelems = static_cast<int64_t>(array_size / sizeof(float));
+    // Memory is left uninitialized to be first touched in parallel below.
+    std::unique_ptr<float[]> a(new float[nelems]), b(new float[nelems]),
+            c(new float[nelems]);
+
+    // Large chunks keep the per-chunk overhead negligible.
+    const int64_t nchunks = 4 * benchdnn_get_max_threads();
+    const int64_t chunk = div_up(nelems, nchunks);
+    float *pa = a.get(), *pb = b.get(), *pc = c.get();
+    // The memory is touched by the same threads that run the kernel.
+    benchdnn_parallel_nd(nchunks, [&](int64_t ichunk) {
+        const int64_t end = MIN2(nelems, (ichunk + 1) * chunk);
+        for (int64_t i = ichunk * chunk; i < end; i++) {
+            pa[i] = 0.f;
+            pb[i] = 1.f;
+            pc[i] = 2.f;
+        }
+    });
+
+    const float scalar = 3.f;
+    double best_ms = 0;
+    for (int r = 0; r < 10; r++) {
+        timer::timer_t t;
+        t.start();
+        benchdnn_parallel_nd(nchunks, [&](int64_t ichunk) {
+            const int64_t end = MIN2(nelems, (ichunk + 1) * chunk);
+            for (int64_t i = ichunk * chunk; i < end; i++)
+                pa[i] = pb[i] + scalar * pc[i];
+        });
+        t.stamp();
+        if (r == 0 || t.ms() < best_ms) best_ms = t.ms();
+    }
+
+    // Two arrays are read and one is written.
+    const double bytes = 3. * nelems * sizeof(float);
+    _peak_bw = best_ms > 0 ? bytes / (best_ms / 1e3) : 0;
+    peak_bw = _peak_bw;
+    return OK;
+}
+
 // The function logic is the following:
 // `checkit` function verifies that the bare minimum (the library and the stock
 // reference) memory requirements are complied with the limits.
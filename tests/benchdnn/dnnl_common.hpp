@@ -94,6 +94,8 @@ extern size_t engine_index;
 extern isa_hints_t hints;
 extern int default_num_streams;
 extern int num_streams;
+extern int default_num_instances;
+extern int num_instances;
 
 struct engine_t {
     engine_t(dnnl_engine_kind_t engine_kind);
@@ -234,6 +236,8 @@ size_t get_cpu_ram_size();
 int get_gpu_ram_sizes(size_t &ram_size, size_t &max_alloc_size);
 int get_cpu_cache_size(cpu_cache_args_t &cache_args);
 int get_gpu_cache_size(size_t &cache_size);
+// Returns the host memory bandwidth in bytes per second.
+int get_cpu_peak_bw(double &peak_bw);
 
 int check_total_size(res_t *res, dnnl_primitive_t prim_ref = nullptr);
 bool is_fwd_training(dnnl_prop_kind_t prop_kind);
@@ -1316,6 +1316,32 @@ static bool parse_num_streams(
     return parsed;
 }
 
+static bool parse_num_instances(
+        const char *str, const std::string &option_name = "num-instances") {
+    static const std::string help
+            = "N    (Default: `1`)\n    Specifies the number `N` of "
+              "concurrent instances of a problem used for CPU performance "
+              "benchmarking.\n    `N` is a positive integer.\n";
+    bool parsed = parse_single_value_option(num_instances,
+            default_num_instances, parser_utils::stoll_safe, str, option_name,
+            help);
+    if (parsed) {
+        if (num_instances <= 0) {
+            BENCHDNN_PRINT(0, "%s\n",
+                    "Error: number of instances must be positive.");
+            SAFE_V(FAIL);
+        }
+        if (num_instances > 1
+                && DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL) {
+            BENCHDNN_PRINT(0, "%s\n",
+                    "Error: multiple instances are not supported for the "
+                    "threadpool runtime.");
+            SAFE_V(FAIL);
+        }
+    }
+    return parsed;
+}
+
 static bool parse_repeats_per_prb(
         const char *str, const std::string &option_name = "repeats-per-prb") {
     static const std::string help
@@ -1584,11 +1610,12 @@ bool parse_bench_settings(const char *str) {
             || parse_fast_ref(str) || parse_fix_times_per_prb(str)
             || parse_global_impl(str) || parse_global_skip_impl(str)
             || parse_max_ms_per_prb(str) || parse_num_streams(str)
-            || parse_repeats_per_prb(str) || parse_mem_check(str)
-            || parse_memory_kind(str) || parse_mode(str)
-            || parse_mode_modifier(str) || parse_start(str)
-            || parse_stream_kind(str) || parse_summary(str)
-            || parse_verbose(str) || parse_execution_mode(str);
+            || parse_num_instances(str) || parse_repeats_per_prb(str)
+            || parse_mem_check(str) || parse_memory_kind(str)
+            || parse_mode(str) || parse_mode_modifier(str)
+            || parse_start(str) || parse_stream_kind(str)
+            || parse_summary(str) || parse_verbose(str)
+            || parse_execution_mode(str);
 
     // Last condition makes this help message to be triggered once driver_name
     // is already known.
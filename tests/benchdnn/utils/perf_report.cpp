@@ -76,6 +76,27 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
         return (res->ibytes + res->obytes) / t.sec(mode) / unit;
     };
 
+    // Arithmetic intensity in ops per byte moved.
+    auto get_ai = [&]() -> double {
+        const size_t iobytes = res->ibytes + res->obytes;
+        if (!iobytes) return 0;
+        return ops() / iobytes / unit;
+    };
+
+    // The host bandwidth is a meaningful roof for CPU engines only.
+    auto get_peak_bw = [&]() -> double {
+        double peak_bw = 0;
+        if (is_cpu()) SAFE_V(get_cpu_peak_bw(peak_bw));
+        return peak_bw;
+    };
+
+    // Achieved share of the memory roof in percent.
+    auto get_bw_eff = [&](const timer::timer_t &t) -> double {
+        const double peak_bw = get_peak_bw();
+        if (!t.sec(mode) || !peak_bw) return 0;
+        return 100. * (res->ibytes + res->obytes) / t.sec(mode) / peak_bw;
+    };
+
     auto get_freq = [&](const timer::timer_t &t) -> double {
         if (!t.sec(mode)) return 0;
         return t.ticks(mode) / t.sec(mode) / unit;
@@ -129,13 +150,16 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
     HANDLE("ctx-init", s << *ctx_init());
     HANDLE("ctx-exe", s << *ctx_exe());
     // Options operating on driver independent objects, e.g. timer values.
+    HANDLE("ai", s << get_ai());
     HANDLE("bw", s << get_bw(res->timer_map.perf_timer()));
+    HANDLE("bweff", s << get_bw_eff(res->timer_map.perf_timer()));
     HANDLE("driver", s << driver_name);
     HANDLE("flops", s << get_flops(res->timer_map.perf_timer()));
     HANDLE("clocks", s << res->timer_map.perf_timer().ticks(mode) / unit);
     HANDLE("prb", s << prb_str);
     HANDLE("freq", s << get_freq(res->timer_map.perf_timer()));
     HANDLE("ops", s << ops() / unit);
+    HANDLE("peakbw", s << get_peak_bw() / unit);
     HANDLE("impl", s << res->impl_name);
     HANDLE("ibytes", s << res->ibytes / unit);
     HANDLE("obytes", s << res->obytes / unit);
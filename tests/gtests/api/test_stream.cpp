@@ -19,6 +19,7 @@
 
 #include "oneapi/dnnl/dnnl.h"
 
+#include <algorithm>
 #include <tuple>
 
 namespace dnnl {
@@ -137,6 +138,46 @@ TEST(stream_test_c_t, GetStream) {
 }
 #endif
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+TEST(stream_test_cpp_t, ThreadTeam) {
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng);
+    ASSERT_EQ(s.get_thread_team(), 0);
+
+    // OpenMP and threadpool kernels can't run on fewer threads than they
+    // were created for
+    if (DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+            || DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL) {
+        EXPECT_THROW(s.set_thread_team(1), error);
+        ASSERT_EQ(s.get_thread_team(), 0);
+        return;
+    }
+
+    s.set_thread_team(1);
+    ASSERT_EQ(s.get_thread_team(), 1);
+
+    // the primitives executed on the stream are restricted to the team
+    memory::desc md({64, 64}, memory::data_type::f32, memory::format_tag::ab);
+    memory src(md, eng), dst(md, eng);
+    float *src_ptr = static_cast<float *>(src.get_data_handle());
+    for (int i = 0; i < 64 * 64; i++)
+        src_ptr[i] = static_cast<float>(i % 7) - 3.f;
+    auto relu_pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md);
+    eltwise_forward(relu_pd).execute(
+            s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    s.wait();
+    const float *dst_ptr = static_cast<const float *>(dst.get_data_handle());
+    for (int i = 0; i < 64 * 64; i++)
+        ASSERT_EQ(dst_ptr[i], std::max(src_ptr[i], 0.f));
+
+    s.set_thread_team(0);
+    ASSERT_EQ(s.get_thread_team(), 0);
+    EXPECT_THROW(s.set_thread_team(-1), error);
+}
+#endif
+
 namespace {
 struct print_to_string_param_name_t {
     template <class ParamType>
@@ -0,0 +1,158 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include <cmath>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace dnnl {
+
+class stream_capture_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "Stream capture is implemented for CPU only.");
+        eng = engine(engine::kind::cpu, 0);
+        strm = stream(eng);
+
+        const memory::desc src_md({M, K}, dt::f32, tag::ab);
+        const memory::desc wei_md({K, N}, dt::f32, tag::ab);
+        const memory::desc dst_md({M, N}, dt::f32, tag::ab);
+
+        src = memory(src_md, eng);
+        wei = memory(wei_md, eng);
+        mm_dst = memory(dst_md, eng);
+        dst = memory(dst_md, eng);
+        fill(src, 0.25f);
+        fill(wei, -0.5f);
+
+        // matmul -> relu -> add the matmul output again
+        auto mm_pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md);
+        auto relu_pd = eltwise_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::eltwise_relu, dst_md,
+                dst_md, 0.f);
+        auto add_pd = binary::primitive_desc(
+                eng, algorithm::binary_add, dst_md, dst_md, dst_md);
+
+        net.emplace_back(matmul(mm_pd),
+                std::unordered_map<int, memory> {{DNNL_ARG_SRC, src},
+                        {DNNL_ARG_WEIGHTS, wei}, {DNNL_ARG_DST, mm_dst}});
+        net.emplace_back(eltwise_forward(relu_pd),
+                std::unordered_map<int, memory> {
+                        {DNNL_ARG_SRC, mm_dst}, {DNNL_ARG_DST, dst}});
+        net.emplace_back(binary(add_pd),
+                std::unordered_map<int, memory> {{DNNL_ARG_SRC_0, dst},
+                        {DNNL_ARG_SRC_1, mm_dst}, {DNNL_ARG_DST, dst}});
+    }
+
+    void fill(memory &m, float val) {
+        auto *ptr = static_cast<float *>(m.get_data_handle());
+        const size_t n = m.get_desc().get_size() / sizeof(float);
+        for (size_t i = 0; i < n; i++)
+            ptr[i] = val * static_cast<float>(static_cast<int>(i % 7) - 3);
+    }
+
+    std::vector<float> run_net() {
+        for (auto &p : net)
+            p.first.execute(strm, p.second);
+        strm.wait();
+        return read(dst);
+    }
+
+    static std::vector<float> read(const memory &m) {
+        const auto *ptr = static_cast<const float *>(m.get_data_handle());
+        return std::vector<float>(
+                ptr, ptr + m.get_desc().get_size() / sizeof(float));
+    }
+
+    using dt = memory::data_type;
+    using tag = memory::format_tag;
+    const memory::dim M = 3, K = 64, N = 17;
+
+    engine eng;
+    stream strm;
+    memory src, wei, mm_dst, dst;
+    std::vector<std::pair<primitive, std::unordered_map<int, memory>>> net;
+};
+
+TEST_F(stream_capture_test_t, ReplayMatchesExecution) {
+    const auto ref = run_net();
+    for (float v : ref)
+        ASSERT_TRUE(std::isfinite(v));
+
+    stream_capture::begin(strm);
+    fill(dst, 0.f);
+    for (auto &p : net)
+        p.first.execute(strm, p.second);
+    auto capture = stream_capture::end(strm);
+
+    // nothing is executed while capturing
+    for (float v : read(dst))
+        ASSERT_EQ(v, 0.f);
+
+    for (int i = 0; i < 3; i++) {
+        fill(dst, 0.f);
+        capture.replay(strm);
+        strm.wait();
+        ASSERT_EQ(read(dst), ref);
+    }
+}
+
+TEST_F(stream_capture_test_t, ReplayWithNewDataHandles) {
+    stream_capture::begin(strm);
+    for (auto &p : net)
+        p.first.execute(strm, p.second);
+    auto capture = stream_capture::end(strm);
+
+    // the captured memory objects are used, with their current handles
+    std::vector<float> new_src(M * K);
+    for (size_t i = 0; i < new_src.size(); i++)
+        new_src[i] = 0.125f * static_cast<float>(i % 5);
+    auto *old_handle = src.get_data_handle();
+    src.set_data_handle(new_src.data());
+    capture.replay(strm);
+    strm.wait();
+    const auto captured = read(dst);
+    for (float v : captured)
+        ASSERT_TRUE(std::isfinite(v));
+
+    ASSERT_EQ(run_net(), captured);
+    src.set_data_handle(old_handle);
+}
+
+TEST_F(stream_capture_test_t, InvalidUsage) {
+    // no capture to end
+    EXPECT_ANY_THROW(stream_capture::end(strm));
+
+    stream_capture::begin(strm);
+    // captures can't be nested
+    EXPECT_ANY_THROW(stream_capture::begin(strm));
+    net[0].first.execute(strm, net[0].second);
+    auto capture = stream_capture::end(strm);
+
+    // replaying is only possible on the captured stream
+    stream other(eng);
+    EXPECT_ANY_THROW(capture.replay(other));
+    capture.replay(strm);
+}
+
+} // namespace dnnl
@@ -51,3 +51,15 @@ TEST(CAPI, ConstantTensorCacheCapacityControl) {
             dnnl_success);
     ASSERT_EQ(capacity, std::numeric_limits<size_t>::max() / (1024 * 1024));
 }
+
+TEST(CAPI, ConstantTensorCacheSharedSize) {
+    size_t size = SIZE_MAX;
+    ASSERT_EQ(dnnl_graph_get_constant_tensor_cache_shared_size(dnnl_cpu, &size),
+            dnnl_success);
+    ASSERT_NE(size, SIZE_MAX);
+
+    // negative test
+    ASSERT_EQ(dnnl_graph_get_constant_tensor_cache_shared_size(
+                      dnnl_cpu, nullptr),
+            dnnl_invalid_arguments);
+}
@@ -0,0 +1,107 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl_graph.hpp"
+
+#include "test_api_common.hpp"
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <vector>
+
+TEST(APICompiledGraph, ExecuteEltwiseChain) {
+    using namespace dnnl::graph;
+    using dt = logical_tensor::data_type;
+    using lt = logical_tensor::layout_type;
+
+    dnnl::engine::kind engine_kind
+            = static_cast<dnnl::engine::kind>(api_test_engine_kind);
+    SKIP_IF(engine_kind == dnnl::engine::kind::gpu,
+            "Skip the case on gpu as the test uses host memory");
+    SKIP_IF(DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "Skip the case on sycl cpu as the test uses host memory");
+    dnnl::engine eng = cpp_api_test_dnnl_engine_create(engine_kind);
+
+    // src -> Abs -> ReLU -> Square -> Abs -> dst, with each op in its own
+    // partition
+    const std::vector<int64_t> dims {2, 64};
+    const std::vector<op::kind> kinds {
+            op::kind::Abs, op::kind::ReLU, op::kind::Square, op::kind::Abs};
+
+    std::vector<logical_tensor> lts;
+    for (size_t i = 0; i <= kinds.size(); ++i)
+        lts.emplace_back(i, dt::f32, dims, lt::strided);
+
+    graph g(engine_kind);
+    for (size_t i = 0; i < kinds.size(); ++i) {
+        op eltwise(i, kinds[i], "eltwise");
+        eltwise.add_input(lts[i]);
+        eltwise.add_output(lts[i + 1]);
+        g.add_op(eltwise);
+    }
+    g.finalize();
+
+    auto partitions = g.get_partitions(partition::policy::debug);
+    ASSERT_EQ(partitions.size(), kinds.size());
+
+    compiled_graph cg(g, eng, {lts.front()}, {lts.back()});
+
+    // the first and the last intermediate tensors are not alive at the same
+    // time, so they share memory
+    const size_t tensor_size = lts[1].get_mem_size();
+    ASSERT_EQ(cg.get_memory_size(), 2 * tensor_size);
+
+    const auto dst_lt = cg.query_logical_tensor(lts.back().get_id());
+    ASSERT_EQ(dst_lt.get_mem_size(), tensor_size);
+
+    const size_t nelems = static_cast<size_t>(product(dims));
+    std::vector<float> src_data(nelems), dst_data(nelems, 0.f);
+    for (size_t i = 0; i < nelems; ++i)
+        src_data[i] = static_cast<float>(i % 7) - 3.f;
+
+    tensor src_ts(lts.front(), eng, src_data.data());
+    tensor dst_ts(dst_lt, eng, dst_data.data());
+
+    dnnl::stream strm(eng);
+    for (int iter = 0; iter < 2; ++iter) {
+        cg.execute(strm, {src_ts}, {dst_ts});
+        strm.wait();
+        for (size_t i = 0; i < nelems; ++i)
+            ASSERT_FLOAT_EQ(dst_data[i], src_data[i] * src_data[i]);
+    }
+}
+
+TEST(APICompiledGraph, NotPartitioned) {
+    using namespace dnnl::graph;
+    using dt = logical_tensor::data_type;
+    using lt = logical_tensor::layout_type;
+
+    dnnl::engine::kind engine_kind
+            = static_cast<dnnl::engine::kind>(api_test_engine_kind);
+    dnnl::engine eng = cpp_api_test_dnnl_engine_create(engine_kind);
+
+    logical_tensor src {0, dt::f32, {2, 64}, lt::strided};
+    logical_tensor dst {1, dt::f32, {2, 64}, lt::strided};
+    op relu(0, op::kind::ReLU, "relu");
+    relu.add_input(src);
+    relu.add_output(dst);
+
+    graph g(engine_kind);
+    g.add_op(relu);
+    g.finalize();
+
+    EXPECT_THROW(compiled_graph(g, eng, {src}, {dst}), dnnl::error);
+}
@@ -101,3 +101,24 @@ TEST(APIEngine, UserAllocator) {
     engine eng = create_cpu_engine();
     execute_single_conv(eng, 200);
 }
+
+TEST(APIEngine, ArenaAllocator) {
+    SKIP_IF(DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "Skip the case when CPU runtime is NONE or SYCL");
+
+    allocator alloc = make_arena_allocator();
+    engine eng = make_engine_with_allocator(engine::kind::cpu, 0, alloc);
+    execute_single_conv(eng, 300);
+    execute_single_conv(eng, 400);
+
+    // the temporary buffers of the executions are served by the arena of the
+    // allocator
+    allocator::arena_stats stats = alloc.get_arena_stats();
+    ASSERT_LE(stats.num_hits, stats.num_requests);
+    ASSERT_EQ(stats.resident_size == 0, stats.num_requests == 0);
+
+    // an allocator without arena has no stats
+    allocator default_alloc;
+    EXPECT_THROW(default_alloc.get_arena_stats(), dnnl::error);
+}
@@ -116,6 +116,8 @@ TEST(APIOp, CreateAllOps) {
             op::kind::GroupNorm,
             op::kind::GenIndex,
             op::kind::GreaterEqual,
+            op::kind::EmbeddingBag,
+            op::kind::TopK,
     };
     // clang-format on
 
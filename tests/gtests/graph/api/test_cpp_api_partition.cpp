@@ -320,6 +320,44 @@ TEST(APIPartition, CompileWildcardPartition) {
     EXPECT_THROW(part.compile({lt1}, {lt2}, eng), dnnl::error);
 }
 
+TEST(APIPartition, ExecuteOnCapturingStream) {
+    using namespace dnnl::graph;
+    dnnl::engine::kind engine_kind
+            = static_cast<dnnl::engine::kind>(api_test_engine_kind);
+    SKIP_IF(engine_kind == dnnl::engine::kind::gpu,
+            "Skip the case on gpu as stream capture is CPU only");
+    SKIP_IF(DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "Skip the case on sycl cpu as stream capture is not supported");
+    dnnl::engine eng = cpp_api_test_dnnl_engine_create(engine_kind);
+    std::vector<int64_t> data_dims {2, 64};
+
+    logical_tensor lt1 {0, logical_tensor::data_type::f32, data_dims,
+            logical_tensor::layout_type::strided};
+    logical_tensor lt2 {1, logical_tensor::data_type::f32, data_dims,
+            logical_tensor::layout_type::strided};
+
+    op relu(0, op::kind::ReLU, "relu");
+    relu.add_input(lt1);
+    relu.add_output(lt2);
+
+    partition part {relu, engine_kind};
+    auto cp = part.compile({lt1}, {lt2}, eng);
+
+    std::vector<float> src_data(128, 1.f), dst_data(128, 0.f);
+    tensor src_ts(lt1, eng, src_data.data());
+    tensor dst_ts(lt2, eng, dst_data.data());
+
+    // compiled partitions can't be recorded by a stream capture
+    dnnl::stream strm(eng);
+    dnnl::stream_capture::begin(strm);
+    EXPECT_THROW(cp.execute(strm, {src_ts}, {dst_ts}), dnnl::error);
+    dnnl::stream_capture::end(strm);
+
+    cp.execute(strm, {src_ts}, {dst_ts});
+    strm.wait();
+    ASSERT_EQ(dst_data, src_data);
+}
+
 TEST(APIPartitionCache, GetSetCapacity) {
     ASSERT_EQ(dnnl_graph_set_compiled_partition_cache_capacity(-1),
             dnnl_invalid_arguments);
@@ -19,8 +19,10 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdlib>
 #include <functional>
 #include <memory>
+#include <random>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -266,6 +268,44 @@ static inline size_t product(const std::vector<int64_t> &in) {
     return static_cast<size_t>(prod);
 }
 
+// Returns `size` values drawn uniformly from [-1, 1) and shifted by `shift`.
+static inline std::vector<float> make_uniform_data(
+        std::minstd_rand &gen, size_t size, float shift = 0.f) {
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    std::vector<float> data(size);
+    for (auto &v : data)
+        v = dist(gen) + shift;
+    return data;
+}
+
+static inline void set_internal_env(const char *name, const char *value) {
+#ifdef _WIN32
+    EXPECT_EQ(_putenv_s(name, value), 0);
+#else
+    EXPECT_EQ(::setenv(name, value, 1), 0);
+#endif
+}
+
+// Compiles the partition of a decomposition kernel with the primitive based
+// implementation forced or not by the internal env var `force_primitive_env`,
+// and checks the name of the kernel which the partition was dispatched to.
+static inline void compile_decomp_partition(
+        const dnnl::impl::graph::partition_t &p,
+        dnnl::impl::graph::compiled_partition_t &cp,
+        std::vector<const dnnl::impl::graph::logical_tensor_t *> &inputs,
+        std::vector<const dnnl::impl::graph::logical_tensor_t *> &outputs,
+        const dnnl::impl::graph::engine_t *eng,
+        const char *force_primitive_env, bool force_primitive,
+        const std::string &decomp_kernel_name) {
+    set_internal_env(force_primitive_env, force_primitive ? "1" : "0");
+    EXPECT_EQ(p.compile(&cp, inputs, outputs, eng),
+            dnnl::impl::graph::status::success);
+    set_internal_env(force_primitive_env, "0");
+    EXPECT_EQ(cp.get_pimpl()->str(),
+            force_primitive ? "larger_partition_kernel_t"
+                            : decomp_kernel_name);
+}
+
 #define for_ for
 #define SET_Q_DQ_DATA_ATTR(q_dq_data) \
     (q_dq_data).set_attr<std::string>( \
@@ -360,3 +360,127 @@ TEST(test_compiled_partition, GetInputsAndOutputs) {
                 ltw(cp->get_outputs()[i]).is_identical(ltw(outputs[i])), true);
     }
 }
+
+TEST(test_compiled_partition, UnknownDims) {
+    graph::engine_t *eng = get_engine();
+
+    graph::op_t relu_op(graph::op_kind::ReLU, "relu");
+
+    const std::vector<graph::dim_t> unknown {DNNL_GRAPH_UNKNOWN_DIM, 3};
+    const graph::logical_tensor_t lt_in = utils::logical_tensor_init(
+            /* tid= */ 1, unknown, unknown, graph::data_type::f32);
+    const graph::logical_tensor_t lt_out = utils::logical_tensor_init(
+            /* tid= */ 2, unknown, unknown, graph::data_type::f32);
+
+    relu_op.add_input(lt_in);
+    relu_op.add_output(lt_out);
+
+    graph::graph_t g(eng->kind());
+    g.add_op(&relu_op);
+    g.finalize();
+    run_all_passes(g);
+
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+
+    graph::compiled_partition_t cp(p);
+    std::vector<const graph::logical_tensor_t *> lt_inputs {&lt_in};
+    std::vector<const graph::logical_tensor_t *> lt_outputs {&lt_out};
+    ASSERT_EQ(p.compile(&cp, lt_inputs, lt_outputs, eng),
+            graph::status::success);
+
+    auto cp_impl = dynamic_cast<
+            const graph::dnnl_impl::dnnl_polymorphic_compiled_partition_impl_t
+                    *>(cp.get_pimpl());
+    ASSERT_NE(cp_impl, nullptr);
+    ASSERT_EQ(cp_impl->get_num_specializations(), 0U);
+
+    graph::stream_t *strm = get_stream();
+    // The second batch size compiles a new kernel, the third one reuses the
+    // first kernel.
+    for (graph::dim_t mb : {2, 5, 2}) {
+        const graph::logical_tensor_t in = utils::logical_tensor_init(
+                /* tid= */ 1, {mb, 3}, graph::data_type::f32);
+        const graph::logical_tensor_t out = utils::logical_tensor_init(
+                /* tid= */ 2, {mb, 3}, graph::data_type::f32);
+
+        std::vector<float> data_in(mb * 3), data_out(mb * 3, 1.f);
+        for (size_t i = 0; i < data_in.size(); i++) {
+            data_in[i] = static_cast<float>(i) - static_cast<float>(mb);
+        }
+        test_tensor_t t_in(in, eng, data_in), t_out(out, eng, data_out);
+
+        EXPECT_SUCCESS(cp.execute(strm, {t_in.get()}, {t_out.get()}));
+        strm->wait();
+
+        data_out = t_out.as_vec_type<float>();
+        for (size_t i = 0; i < data_in.size(); i++) {
+            ASSERT_FLOAT_EQ(data_out[i], std::max(data_in[i], 0.f));
+        }
+    }
+    ASSERT_EQ(cp_impl->get_num_specializations(), 2U);
+
+    // Tensors must have known dims.
+    graph::tensor_t t_in(lt_in, eng, nullptr), t_out(lt_out, eng, nullptr);
+    ASSERT_EQ(cp.execute(strm, {t_in}, {t_out}),
+            graph::status::invalid_arguments);
+}
+
+TEST(test_compiled_partition, InputLayoutsAfterCompile) {
+    graph::engine_t *eng = get_engine();
+
+    graph::op_t matmul_op(graph::op_kind::MatMul, "matmul");
+
+    const graph::logical_tensor_t lt_src = utils::logical_tensor_init(
+            /* tid= */ 1, {4, 8}, graph::data_type::f32);
+    const graph::logical_tensor_t lt_wei
+            = utils::logical_tensor_init(/* tid= */ 2, {8, 16},
+                    graph::data_type::f32, graph::layout_type::any);
+    const graph::logical_tensor_t lt_dst
+            = utils::logical_tensor_init(/* tid= */ 3, {4, 16},
+                    graph::data_type::f32, graph::layout_type::any);
+
+    matmul_op.add_input(lt_src);
+    matmul_op.add_input(lt_wei);
+    matmul_op.add_output(lt_dst);
+
+    graph::graph_t g(eng->kind());
+    g.add_op(&matmul_op);
+    g.finalize();
+    run_all_passes(g);
+
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+
+    graph::compiled_partition_t cp(p);
+    std::vector<const graph::logical_tensor_t *> lt_inputs {&lt_src, &lt_wei};
+    std::vector<const graph::logical_tensor_t *> lt_outputs {&lt_dst};
+    ASSERT_EQ(p.compile(&cp, lt_inputs, lt_outputs, eng),
+            graph::status::success);
+
+    // The layout chosen by the kernel for the weights is reported, and stays
+    // the same when the compiled partition is queried again.
+    graph::logical_tensor_t query_wei, query_wei_again;
+    ASSERT_EQ(cp.query_logical_tensor(lt_wei.id, &query_wei),
+            graph::status::success);
+    ASSERT_NE(query_wei.layout_type, graph::layout_type::any);
+    ASSERT_GE(graph::logical_tensor_wrapper_t(query_wei).size(),
+            8 * 16 * sizeof(float));
+    ASSERT_EQ(cp.query_logical_tensor(lt_wei.id, &query_wei_again),
+            graph::status::success);
+    ASSERT_TRUE(graph::logical_tensor_wrapper_t(query_wei).is_identical(
+            graph::logical_tensor_wrapper_t(query_wei_again)));
+
+    graph::logical_tensor_t query_src;
+    ASSERT_EQ(cp.query_logical_tensor(lt_src.id, &query_src),
+            graph::status::success);
+    ASSERT_EQ(query_src.layout_type, graph::layout_type::strided);
+    ASSERT_EQ(graph::logical_tensor_wrapper_t(query_src).size(),
+            4 * 8 * sizeof(float));
+}
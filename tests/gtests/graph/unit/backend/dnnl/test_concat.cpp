@@ -14,17 +14,23 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <functional>
 #include <random>
 
 #include "gtest/gtest.h"
 
+#include "backend/dnnl/passes/memory_planning.hpp"
+#include "backend/dnnl/passes/utils.hpp"
+#include "backend/dnnl/subgraph.hpp"
+
 #include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
 #include "graph/unit/unit_test_common.hpp"
 #include "graph/unit/utils.hpp"
 
 namespace graph = dnnl::impl::graph;
 namespace utils = dnnl::graph::tests::unit::utils;
+namespace dnnl_impl = graph::dnnl_impl;
 
 struct concat_params_t {
     std::vector<graph::dim_t> src0_shape;
@@ -157,7 +163,90 @@ INSTANTIATE_TEST_SUITE_P(test_concat_execute, concat_t,
                         {1, 2, 2, 2}, {1, 2, 2, 2}, {1, 2, 2, 4}, 3, false},
                 // 4D, axis = -1
                 concat_params_t {
-                        {1, 2, 2, 2}, {1, 2, 2, 2}, {1, 2, 2, 4}, -1, false}));
+                        {1, 2, 2, 2}, {1, 2, 2, 2}, {1, 2, 2, 4}, -1, false},
+                // 4D, axis = 1, slices not aligned to the input strides
+                concat_params_t {
+                        {2, 3, 4, 5}, {2, 5, 4, 5}, {2, 8, 4, 5}, 1, false},
+                // 4D, axis = 2, slices not aligned to the input strides
+                concat_params_t {
+                        {2, 3, 4, 5}, {2, 3, 1, 5}, {2, 3, 5, 5}, 2, false}));
+
+TEST(test_concat_compile, ZeroCopyReorderedInputs) {
+    /*  in0      in1
+         |        |
+      reorder  reorder
+          \      /
+           concat
+    */
+    graph::engine_t *g_eng = get_engine();
+    SKIP_IF(g_eng->kind() == graph::engine_kind::gpu,
+            "Concat slices are only written in place on CPU.");
+    dnnl::engine p_eng = dnnl_impl::make_dnnl_engine(*g_eng);
+
+    graph::op_t reorder0(0, dnnl_impl::op_kind::dnnl_reorder, "reorder0");
+    graph::op_t reorder1(1, dnnl_impl::op_kind::dnnl_reorder, "reorder1");
+    graph::op_t concat(2, dnnl_impl::op_kind::dnnl_concat, "concat");
+    concat.set_attr<int64_t>(graph::op_attr::axis, 1);
+
+    auto lt = [](size_t id, const std::vector<graph::dim_t> &dims) {
+        return utils::logical_tensor_init(id, dims, graph::data_type::f32,
+                graph::layout_type::strided);
+    };
+    auto in0 = lt(0, {2, 3, 4, 5});
+    auto in1 = lt(1, {2, 5, 4, 5});
+    auto src0 = lt(2, {2, 3, 4, 5});
+    auto src1 = lt(3, {2, 5, 4, 5});
+    auto dst = lt(4, {2, 8, 4, 5});
+    reorder0.add_input(in0);
+    reorder0.add_output(src0);
+    reorder1.add_input(in1);
+    reorder1.add_output(src1);
+    concat.add_input(src0);
+    concat.add_input(src1);
+    concat.add_output(dst);
+
+    graph::graph_t g;
+    g.add_op(&reorder0);
+    g.add_op(&reorder1);
+    g.add_op(&concat);
+    g.finalize();
+
+    const graph::fpmath_t fpm {graph::fpmath_mode::strict, false};
+    auto sg = std::make_shared<dnnl_impl::subgraph_t>(
+            g.get_ops(), p_eng, fpm, false, /* reset_layout */ false);
+    std::vector<graph::logical_tensor_t> inputs {in0, in1};
+    std::vector<graph::logical_tensor_t> outputs {dst};
+    ASSERT_EQ(dnnl_impl::set_given_inputs_outputs(sg, inputs, outputs),
+            graph::status::success);
+
+    dnnl_impl::memory_planner_t memory_planner;
+    ASSERT_EQ(memory_planner.run(sg), graph::status::success);
+
+    // The reorders write into the slices of the concat output, which leaves
+    // no internal buffer and nothing for the concat to copy.
+    const std::vector<graph::dim_t> dst_strides {160, 20, 5, 1};
+    for (const auto &op : sg->get_ops()) {
+        if (op->get_kind() != dnnl_impl::op_kind::dnnl_concat) continue;
+        ASSERT_TRUE(op->get_attr<bool>(dnnl_impl::op_attr::is_zero_copy));
+        for (const auto &val : op->get_input_values()) {
+            const auto val_lt = val->get_logical_tensor();
+            ASSERT_EQ(graph::logical_tensor_wrapper_t(val_lt).vstrides(),
+                    dst_strides);
+        }
+    }
+    ASSERT_EQ(memory_planner.total_internal_temporary_size(), 0U);
+
+    const auto &sub_buffers
+            = memory_planner.get_exec_args_set().get_mems_use_sub_buffers();
+    ASSERT_EQ(sub_buffers.size(), 2U);
+    std::vector<size_t> offsets;
+    for (const auto &sub : sub_buffers) {
+        ASSERT_EQ(sub.base.get(), sub_buffers[0].base.get());
+        offsets.push_back(sub.offset);
+    }
+    std::sort(offsets.begin(), offsets.end());
+    ASSERT_EQ(offsets, std::vector<size_t>({0, 3 * 20 * sizeof(float)}));
+}
 
 TEST(test_concat_compile, ConcatWithMoreInputs) {
     size_t num_inputs = 64;
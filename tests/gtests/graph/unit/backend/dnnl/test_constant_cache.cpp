@@ -110,3 +110,41 @@ TEST(test_constant_cache, NoEvictWhenCacheFull) {
     // ignore since we use no_evict policy
     ASSERT_FALSE(cache.get_or_add(0, 3, 3, c_promise3_2.get_future()).valid());
 }
+
+TEST(test_constant_cache, SharedByRequesters) {
+    graph::engine_t &engine = *get_engine();
+    auto p_engine_ = dnnl_impl::make_dnnl_engine(engine);
+    auto g_alloc_ = static_cast<graph::allocator_t *>(engine.get_allocator());
+
+    graph::constant_tensor_cache_t cache(0);
+    ASSERT_EQ(cache.set_capacity(5), graph::status::success);
+    int requester1 = 0, requester2 = 0;
+
+    std::promise<graph::constant_tensor_cache_t::cached_t> c_promise1;
+    ASSERT_FALSE(
+            cache.get_or_add(0, 1, 2, c_promise1.get_future(), &requester1)
+                    .valid());
+    graph::constant_tensor_cache_t::cached_t c_buffer1
+            = std::make_shared<dnnl_impl::dnnl_constant_buffer_t>(
+                    2, p_engine_, g_alloc_);
+    c_promise1.set_value(c_buffer1);
+    ASSERT_EQ(cache.get_shared_size(), 0U);
+
+    // should cache hit and share the buffer with the first requester
+    std::promise<graph::constant_tensor_cache_t::cached_t> c_promise2;
+    ASSERT_TRUE(cache.get_or_add(0, 1, 2, c_promise2.get_future(), &requester2)
+                        .valid());
+    ASSERT_EQ(cache.get_size(), 2U);
+    ASSERT_EQ(cache.get_shared_size(), 2U);
+
+    // a requester is counted only once
+    std::promise<graph::constant_tensor_cache_t::cached_t> c_promise3;
+    ASSERT_TRUE(cache.get_or_add(0, 1, 2, c_promise3.get_future(), &requester2)
+                        .valid());
+    ASSERT_EQ(cache.get_shared_size(), 2U);
+
+    // the buffer stays cached when a requester stops sharing it
+    cache.remove_requester(&requester2);
+    ASSERT_EQ(cache.get_size(), 2U);
+    ASSERT_EQ(cache.get_shared_size(), 0U);
+}
@@ -0,0 +1,167 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+#include "graph/unit/utils.hpp"
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+using dim_t = dnnl_dim_t;
+using dims = std::vector<dim_t>;
+
+namespace {
+const dim_t N = 8, H = 32, W = 16, IC = 8, OC = 16;
+
+// Builds Convolution + BatchNormForwardTraining + ReLU in NXC format, where
+// the convolution output is also used outside of the partition, compiles it
+// and returns the partition outputs for the given inputs, keyed by id.
+std::map<size_t, std::vector<float>> run_conv_bnorm(
+        const std::map<size_t, std::vector<float>> &data,
+        bool force_primitive) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    const auto f32 = graph::data_type::f32;
+    std::map<size_t, graph::logical_tensor_t> lts {
+            {0, utils::logical_tensor_init(0, {N, H, W, IC}, f32)},
+            {1, utils::logical_tensor_init(1, {3, 3, IC, OC}, f32)},
+            {2, utils::logical_tensor_init(2, {N, H, W, OC}, f32)},
+            {3, utils::logical_tensor_init(3, {N, H, W, OC}, f32)},
+            {4, utils::logical_tensor_init(4, {N, H, W, OC}, f32)},
+            {13, utils::logical_tensor_init(13, {N, H, W, OC}, f32)}};
+    for (size_t id = 5; id <= 12; id++)
+        lts[id] = utils::logical_tensor_init(id, {OC}, f32);
+
+    graph::op_t conv_op(0, graph::op_kind::Convolution, "conv");
+    conv_op.set_attr<dims>(graph::op_attr::strides, dims {1, 1});
+    conv_op.set_attr<dims>(graph::op_attr::dilations, dims {1, 1});
+    conv_op.set_attr<dims>(graph::op_attr::pads_begin, dims {1, 1});
+    conv_op.set_attr<dims>(graph::op_attr::pads_end, dims {1, 1});
+    conv_op.set_attr<int64_t>(graph::op_attr::groups, 1);
+    conv_op.set_attr<std::string>(graph::op_attr::data_format, "NXC");
+    conv_op.set_attr<std::string>(graph::op_attr::weights_format, "XIO");
+    conv_op.add_input(lts[0]);
+    conv_op.add_input(lts[1]);
+    conv_op.add_output(lts[2]);
+
+    graph::op_t bn_op(1, graph::op_kind::BatchNormForwardTraining, "bn");
+    bn_op.set_attr<float>(graph::op_attr::epsilon, 1e-5f);
+    bn_op.set_attr<float>(graph::op_attr::momentum, 0.1f);
+    bn_op.set_attr<std::string>(graph::op_attr::data_format, "NXC");
+    for (size_t id : {2, 9, 10, 11, 12})
+        bn_op.add_input(lts[id]);
+    for (size_t id : {3, 5, 6, 7, 8})
+        bn_op.add_output(lts[id]);
+
+    graph::op_t relu_op(2, graph::op_kind::ReLU, "relu");
+    relu_op.add_input(lts[3]);
+    relu_op.add_output(lts[4]);
+
+    // Consumer of the convolution output outside of the partition, as the
+    // backward pass would be.
+    graph::op_t abs_op(3, graph::op_kind::Abs, "abs");
+    abs_op.add_input(lts[2]);
+    abs_op.add_output(lts[13]);
+
+    graph::graph_t g(eng->kind());
+    g.add_op(&conv_op);
+    g.add_op(&bn_op);
+    g.add_op(&relu_op);
+    g.add_op(&abs_op);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("fp_conv_bnorm_train");
+    apass->run(g);
+    EXPECT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (const auto &lt : p.get_inputs())
+        inputs.push_back(&lts[lt.id]);
+    for (const auto &lt : p.get_outputs())
+        outputs.push_back(&lts[lt.id]);
+    EXPECT_EQ(inputs.size(), 6U);
+    EXPECT_EQ(outputs.size(), 6U);
+
+    graph::compiled_partition_t cp(p);
+    compile_decomp_partition(p, cp, inputs, outputs, eng,
+            "_ONEDNN_GRAPH_CONV_BNORM_FORCE_PRIMITIVE", force_primitive,
+            "conv_bnorm_decomp_kernel_t");
+
+    std::vector<test_tensor_t> in_ts, out_ts;
+    std::vector<graph::tensor_t> in_args, out_args;
+    for (const auto *lt : inputs)
+        in_ts.emplace_back(*lt, eng, data.at(lt->id));
+    for (const auto *lt : outputs)
+        out_ts.emplace_back(*lt, eng);
+    for (auto &ts : in_ts)
+        in_args.push_back(ts.get());
+    for (auto &ts : out_ts)
+        out_args.push_back(ts.get());
+    EXPECT_EQ(cp.execute(strm, in_args, out_args), graph::status::success);
+    strm->wait();
+
+    std::map<size_t, std::vector<float>> results;
+    for (size_t i = 0; i < outputs.size(); i++)
+        results[outputs[i]->id] = out_ts[i].as_vec_type<float>();
+    return results;
+}
+} // namespace
+
+TEST(test_conv_bnorm_decomp_execute, ConvBnormTrainingRelu_CPU) {
+    graph::engine_t *eng = get_engine();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+    SKIP_IF(DNNL_CPU_RUNTIME != DNNL_RUNTIME_OMP
+                    && DNNL_CPU_RUNTIME != DNNL_RUNTIME_THREADPOOL,
+            "Skip for runtimes without the decomposition kernel.");
+
+    std::minstd_rand gen(1);
+    // The source is shifted so that the convolution output has a mean much
+    // larger than its deviation.
+    const std::map<size_t, std::vector<float>> data {
+            {0, make_uniform_data(gen, N * H * W * IC, 4.f)},
+            {1, make_uniform_data(gen, 3 * 3 * IC * OC)},
+            {9, make_uniform_data(gen, OC)},
+            {10, make_uniform_data(gen, OC, 2.f)},
+            {11, make_uniform_data(gen, OC, 1.f)},
+            {12, make_uniform_data(gen, OC)}};
+
+    const auto dst = run_conv_bnorm(data, false);
+    const auto ref = run_conv_bnorm(data, true);
+    ASSERT_EQ(dst.size(), ref.size());
+    for (const auto &r : ref) {
+        const auto &d = dst.at(r.first);
+        ASSERT_EQ(d.size(), r.second.size());
+        for (size_t i = 0; i < d.size(); i++) {
+            const float tol = 1e-4f * std::max(1.f, std::fabs(r.second[i]));
+            ASSERT_NEAR(d[i], r.second[i], tol)
+                    << "output " << r.first << " at " << i;
+        }
+    }
+}
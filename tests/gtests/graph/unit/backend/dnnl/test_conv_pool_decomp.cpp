@@ -0,0 +1,148 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+#include "graph/unit/utils.hpp"
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+using dim_t = dnnl_dim_t;
+using dims = std::vector<dim_t>;
+
+namespace {
+// Builds Convolution + ReLU + pooling in NXC format with overlapping pooling
+// windows, compiles it and returns the output for the given inputs. The weights
+// are constant so that their reorder is cached.
+std::vector<float> run_conv_pool(graph::op_kind_t pool_kind,
+        const std::vector<float> &src, const std::vector<float> &wei,
+        const std::vector<float> &bias, bool force_primitive) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    const dim_t N = 8, H = 64, W = 16, IC = 8, OC = 16;
+    graph::logical_tensor_t src_lt = utils::logical_tensor_init(
+            0, {N, H, W, IC}, graph::data_type::f32);
+    graph::logical_tensor_t wei_lt = utils::logical_tensor_init(
+            1, {3, 3, IC, OC}, graph::data_type::f32);
+    wei_lt.property = graph::property_type::constant;
+    graph::logical_tensor_t bias_lt
+            = utils::logical_tensor_init(2, {OC}, graph::data_type::f32);
+    graph::logical_tensor_t conv_dst_lt
+            = utils::logical_tensor_init(3, graph::data_type::f32);
+    graph::logical_tensor_t relu_dst_lt
+            = utils::logical_tensor_init(4, graph::data_type::f32);
+    graph::logical_tensor_t dst_lt = utils::logical_tensor_init(
+            5, {N, H / 2, W / 2, OC}, graph::data_type::f32);
+
+    graph::op_t conv_op(0, graph::op_kind::Convolution, "conv");
+    conv_op.set_attr<dims>(graph::op_attr::strides, dims {1, 1});
+    conv_op.set_attr<dims>(graph::op_attr::dilations, dims {1, 1});
+    conv_op.set_attr<dims>(graph::op_attr::pads_begin, dims {1, 1});
+    conv_op.set_attr<dims>(graph::op_attr::pads_end, dims {1, 1});
+    conv_op.set_attr<int64_t>(graph::op_attr::groups, 1);
+    conv_op.set_attr<std::string>(graph::op_attr::data_format, "NXC");
+    conv_op.set_attr<std::string>(graph::op_attr::weights_format, "XIO");
+    conv_op.add_input(src_lt);
+    conv_op.add_input(wei_lt);
+    conv_op.add_input(bias_lt);
+    conv_op.add_output(conv_dst_lt);
+
+    graph::op_t relu_op(1, graph::op_kind::ReLU, "relu");
+    relu_op.add_input(conv_dst_lt);
+    relu_op.add_output(relu_dst_lt);
+
+    graph::op_t pool_op(2, pool_kind, "pool");
+    pool_op.set_attr<dims>(graph::op_attr::strides, dims {2, 2});
+    pool_op.set_attr<dims>(graph::op_attr::kernel, dims {3, 3});
+    pool_op.set_attr<dims>(graph::op_attr::pads_begin, dims {1, 1});
+    pool_op.set_attr<dims>(graph::op_attr::pads_end, dims {0, 0});
+    pool_op.set_attr<std::string>(graph::op_attr::data_format, "NXC");
+    if (pool_kind == graph::op_kind::AvgPool)
+        pool_op.set_attr<bool>(graph::op_attr::exclude_pad, false);
+    pool_op.add_input(relu_dst_lt);
+    pool_op.add_output(dst_lt);
+
+    graph::graph_t g(eng->kind());
+    g.add_op(&conv_op);
+    g.add_op(&relu_op);
+    g.add_op(&pool_op);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("fp_conv_pool");
+    apass->run(g);
+    EXPECT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+    std::vector<const graph::logical_tensor_t *> inputs {
+            &src_lt, &wei_lt, &bias_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+
+    graph::compiled_partition_t cp(p);
+    compile_decomp_partition(p, cp, inputs, outputs, eng,
+            "_ONEDNN_GRAPH_CONV_POOL_FORCE_PRIMITIVE", force_primitive,
+            "conv_pool_decomp_kernel_t");
+
+    test_tensor_t src_ts(src_lt, eng, src);
+    test_tensor_t wei_ts(wei_lt, eng, wei);
+    test_tensor_t bias_ts(bias_lt, eng, bias);
+    test_tensor_t dst_ts(dst_lt, eng);
+    // The second execution takes the weights from the constant cache.
+    for (int i = 0; i < 2; i++) {
+        EXPECT_EQ(cp.execute(strm,
+                          {src_ts.get(), wei_ts.get(), bias_ts.get()},
+                          {dst_ts.get()}),
+                graph::status::success);
+        strm->wait();
+    }
+    return dst_ts.as_vec_type<float>();
+}
+} // namespace
+
+TEST(test_conv_pool_decomp_execute, ConvReluPool_CPU) {
+    graph::engine_t *eng = get_engine();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+    SKIP_IF(DNNL_CPU_RUNTIME != DNNL_RUNTIME_OMP
+                    && DNNL_CPU_RUNTIME != DNNL_RUNTIME_THREADPOOL,
+            "Skip for runtimes without the decomposition kernel.");
+
+    std::minstd_rand gen(1);
+    const auto src = make_uniform_data(gen, 8 * 64 * 16 * 8);
+    const auto wei = make_uniform_data(gen, 3 * 3 * 8 * 16);
+    const auto bias = make_uniform_data(gen, 16);
+
+    for (auto pool_kind : {graph::op_kind::MaxPool, graph::op_kind::AvgPool}) {
+        const auto dst = run_conv_pool(pool_kind, src, wei, bias, false);
+        const auto ref = run_conv_pool(pool_kind, src, wei, bias, true);
+        ASSERT_EQ(dst.size(), ref.size());
+        for (size_t i = 0; i < dst.size(); i++) {
+            const float tol = 1e-5f * std::max(1.f, std::fabs(ref[i]));
+            ASSERT_NEAR(dst[i], ref[i], tol) << "at " << i;
+        }
+    }
+}
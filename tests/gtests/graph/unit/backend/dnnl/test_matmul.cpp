@@ -8035,6 +8035,124 @@ TEST(test_matmul_execute_subgraph_int8, ShareCachedWeight) {
             static_cast<engine::kind>(engine->kind()), 0);
 }
 
+TEST(test_matmul_execute_subgraph_int8, ShareCachedWeightAcrossPartitions) {
+    graph::engine_t *engine = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    std::vector<int64_t> src_shape = {32, 1024};
+    std::vector<int64_t> weight_shape = {1024, 1024};
+    size_t scales_wei_sizes = weight_shape.back();
+    std::vector<float> scale_wei(scales_wei_sizes, 1 / 127.f);
+    std::vector<int64_t> zp_wei(scales_wei_sizes, 0);
+
+    graph::op_t dqdata_op(1, graph::op_kind::Dequantize, "dqdata_op");
+    dqdata_op.set_attr<std::string>(graph::op_attr::qtype, "per_tensor");
+    dqdata_op.set_attr<std::vector<int64_t>>(graph::op_attr::zps, {0});
+    dqdata_op.set_attr<std::vector<float>>(graph::op_attr::scales, {1 / 255.f});
+    dqdata_op.set_attr<int64_t>(graph::op_attr::axis, 0);
+
+    graph::op_t dqweight_op(2, graph::op_kind::Dequantize, "dqweight_op");
+    dqweight_op.set_attr<std::string>(graph::op_attr::qtype, "per_channel");
+    dqweight_op.set_attr<std::vector<int64_t>>(graph::op_attr::zps, zp_wei);
+    dqweight_op.set_attr<std::vector<float>>(graph::op_attr::scales, scale_wei);
+    dqweight_op.set_attr<int64_t>(graph::op_attr::axis, 1);
+
+    graph::op_t matmul_op(3, graph::op_kind::MatMul, "matmul_op");
+    matmul_op.set_attr<bool>(graph::op_attr::transpose_a, false);
+    matmul_op.set_attr<bool>(graph::op_attr::transpose_b, false);
+
+    graph::op_t qout_op(4, graph::op_kind::Quantize, "qout_op");
+    qout_op.set_attr<std::string>(graph::op_attr::qtype, "per_tensor");
+    qout_op.set_attr<std::vector<int64_t>>(graph::op_attr::zps, {0});
+    qout_op.set_attr<std::vector<float>>(graph::op_attr::scales, {1.f});
+    qout_op.set_attr<int64_t>(graph::op_attr::axis, 0);
+
+    auto src_u8
+            = utils::logical_tensor_init(1, src_shape, graph::data_type::u8);
+    auto src_f32_dq = utils::logical_tensor_init(2, graph::data_type::f32);
+    auto weight_s8
+            = utils::logical_tensor_init(4, weight_shape, graph::data_type::s8);
+    weight_s8.property = graph::property_type::constant;
+    auto weight_f32_dq = utils::logical_tensor_init(
+            5, weight_shape, graph::data_type::f32);
+    auto dst_f32 = utils::logical_tensor_init(7, graph::data_type::f32);
+    auto dst_s8
+            = utils::logical_tensor_init(8, src_shape, graph::data_type::s8);
+
+    dqdata_op.add_input(src_u8);
+    dqdata_op.add_output(src_f32_dq);
+    dqweight_op.add_input(weight_s8);
+    dqweight_op.add_output(weight_f32_dq);
+    matmul_op.add_input(src_f32_dq);
+    matmul_op.add_input(weight_f32_dq);
+    matmul_op.add_output(dst_f32);
+    qout_op.add_input(dst_f32);
+    qout_op.add_output(dst_s8);
+
+    std::vector<int8_t> weight_data(product(weight_shape));
+    for (size_t i = 0; i < weight_data.size(); i++)
+        weight_data[i] = static_cast<int8_t>(i % 255 - 127);
+    test_tensor_t weight_s8_ts(weight_s8, engine, weight_data);
+    std::vector<uint8_t> src_data(product(src_shape), 1);
+    test_tensor_t src_u8_ts(src_u8, engine, src_data);
+
+    // Compiles and executes the same quantized matmul, as a new partition,
+    // with the same constant weight.
+    const auto run_partition = [&](graph::graph_t &g, graph::partition_t &p) {
+        g.add_op(&dqdata_op);
+        g.add_op(&dqweight_op);
+        g.add_op(&matmul_op);
+        g.add_op(&qout_op);
+        g.finalize();
+        get_pass("x8x8x_matmul_post_ops")->run(g);
+        EXPECT_EQ(g.get_num_partitions(), 1U);
+        p.init(g.get_partitions()[0]);
+
+        std::vector<const graph::logical_tensor_t *> lt_ins {
+                &src_u8, &weight_s8};
+        std::vector<const graph::logical_tensor_t *> lt_outs {&dst_s8};
+        auto cp = std::make_shared<graph::compiled_partition_t>(p);
+        EXPECT_EQ(p.compile(cp.get(), lt_ins, lt_outs, engine),
+                graph::status::success);
+        graph::logical_tensor_t compiled_output;
+        cp->query_logical_tensor(dst_s8.id, &compiled_output);
+        test_tensor_t dst_s8_ts(compiled_output, engine);
+        EXPECT_EQ(cp->execute(strm, {src_u8_ts.get(), weight_s8_ts.get()},
+                          {dst_s8_ts.get()}),
+                graph::status::success);
+        strm->wait();
+        return cp;
+    };
+
+    const auto kind = static_cast<engine::kind>(engine->kind());
+    dnnl::graph::set_constant_tensor_cache_capacity(kind, 0);
+    dnnl::graph::set_constant_tensor_cache_capacity(kind, 1024);
+    auto *cache = graph::get_constant_tensor_cache(
+            engine->kind(), engine->index());
+
+    graph::graph_t g1(engine->kind());
+    graph::partition_t p1;
+    auto cp1 = run_partition(g1, p1);
+    const size_t cache_size = cache->get_size();
+    ASSERT_GT(cache_size, 0U);
+    ASSERT_EQ(cache->get_shared_size(), 0U);
+
+    {
+        graph::graph_t g2(engine->kind());
+        graph::partition_t p2;
+        auto cp2 = run_partition(g2, p2);
+        ASSERT_NE(p1.id(), p2.id());
+        // The second partition reuses the weight cached by the first one.
+        ASSERT_EQ(cache->get_size(), cache_size);
+        ASSERT_EQ(cache->get_shared_size(), cache_size);
+    }
+    // The weight is no longer shared once the second partition is destroyed.
+    ASSERT_EQ(cache->get_size(), cache_size);
+    ASSERT_EQ(cache->get_shared_size(), 0U);
+
+    dnnl::graph::set_constant_tensor_cache_capacity(kind, 0);
+}
+
 TEST(test_matmul_execute_subgraph_int8, NoShareCachedWeight) {
     graph::engine_t *engine = get_engine();
     graph::stream_t *strm = get_stream();
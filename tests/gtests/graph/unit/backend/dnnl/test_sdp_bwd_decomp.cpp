@@ -0,0 +1,175 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+#include "graph/unit/utils.hpp"
+
+#include "common/utils.hpp"
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+using dim_t = dnnl_dim_t;
+using dims = std::vector<dim_t>;
+
+namespace {
+// The sequence lengths are not multiples of the blocks of the decomposition.
+const dim_t MB = 4, LQ = 80, LK = 100, D = 32;
+
+// The decomposition distributes (batch, head) pairs over threads, and needs
+// one of them for each thread at least.
+dim_t num_heads() {
+    return std::max<dim_t>(16,
+            dnnl::impl::utils::div_up(dnnl_get_current_num_threads(), MB));
+}
+
+// Builds the backward of a scaled dot-product attention with a broadcast
+// mask, compiles it and returns the partition outputs for the given inputs,
+// keyed by id.
+std::map<size_t, std::vector<float>> run_sdp_bwd(
+        const std::map<size_t, std::vector<float>> &data,
+        bool force_primitive) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    const auto f32 = graph::data_type::f32;
+    const dim_t HEADS = num_heads();
+    const dims q_shape {MB, HEADS, LQ, D}, k_shape {MB, HEADS, LK, D},
+            s_shape {MB, HEADS, LQ, LK};
+    std::map<size_t, graph::logical_tensor_t> lts;
+    for (size_t id : {0, 10, 16})
+        lts[id] = utils::logical_tensor_init(id, q_shape, f32);
+    for (size_t id : {1, 11, 12, 17})
+        lts[id] = utils::logical_tensor_init(id, k_shape, f32);
+    for (size_t id : {2, 4, 6, 8, 9, 13, 14, 15})
+        lts[id] = utils::logical_tensor_init(id, s_shape, f32);
+    lts[3] = utils::logical_tensor_init(3, {1}, f32);
+    lts[5] = utils::logical_tensor_init(5, {MB, 1, 1, LK}, f32);
+    lts[7] = utils::logical_tensor_init(7, {MB, HEADS, LQ, 1}, f32);
+
+    std::vector<std::unique_ptr<graph::op_t>> ops;
+    const auto add_op = [&](graph::op_kind_t kind, std::vector<size_t> ins,
+                                size_t out, bool ta = false, bool tb = false) {
+        const size_t id = ops.size();
+        ops.emplace_back(new graph::op_t(id, kind, "op" + std::to_string(id)));
+        auto &op = *ops.back();
+        if (kind == graph::op_kind::MatMul) {
+            op.set_attr<bool>(graph::op_attr::transpose_a, ta);
+            op.set_attr<bool>(graph::op_attr::transpose_b, tb);
+        }
+        if (kind == graph::op_kind::SoftMaxBackward)
+            op.set_attr<int64_t>(graph::op_attr::axis, -1);
+        for (size_t in : ins)
+            op.add_input(lts[in]);
+        op.add_output(lts[out]);
+    };
+    add_op(graph::op_kind::MatMul, {0, 1}, 2, false, true);
+    add_op(graph::op_kind::Divide, {2, 3}, 4);
+    add_op(graph::op_kind::Add, {4, 5}, 6);
+    add_op(graph::op_kind::Subtract, {6, 7}, 8);
+    add_op(graph::op_kind::Exp, {8}, 9);
+    add_op(graph::op_kind::MatMul, {9, 10}, 11, true, false);
+    add_op(graph::op_kind::MatMul, {10, 12}, 13, false, true);
+    add_op(graph::op_kind::SoftMaxBackward, {13, 9}, 14);
+    add_op(graph::op_kind::Divide, {14, 3}, 15);
+    add_op(graph::op_kind::MatMul, {15, 1}, 16);
+    add_op(graph::op_kind::MatMul, {15, 0}, 17, true, false);
+
+    graph::graph_t g(eng->kind());
+    for (auto &op : ops)
+        g.add_op(op.get());
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("float_sdp_backward_fusion");
+    apass->run(g);
+    EXPECT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (const auto &lt : p.get_inputs())
+        inputs.push_back(&lts[lt.id]);
+    for (const auto &lt : p.get_outputs())
+        outputs.push_back(&lts[lt.id]);
+    EXPECT_EQ(outputs.size(), 3U);
+
+    graph::compiled_partition_t cp(p);
+    compile_decomp_partition(p, cp, inputs, outputs, eng,
+            "_ONEDNN_GRAPH_SDP_BWD_FORCE_PRIMITIVE", force_primitive,
+            "sdp_bwd_decomp_kernel_t");
+
+    std::vector<test_tensor_t> in_ts, out_ts;
+    std::vector<graph::tensor_t> in_args, out_args;
+    for (const auto *lt : inputs)
+        in_ts.emplace_back(*lt, eng, data.at(lt->id));
+    for (const auto *lt : outputs)
+        out_ts.emplace_back(*lt, eng);
+    for (auto &ts : in_ts)
+        in_args.push_back(ts.get());
+    for (auto &ts : out_ts)
+        out_args.push_back(ts.get());
+    EXPECT_EQ(cp.execute(strm, in_args, out_args), graph::status::success);
+    strm->wait();
+
+    std::map<size_t, std::vector<float>> results;
+    for (size_t i = 0; i < outputs.size(); i++)
+        results[outputs[i]->id] = out_ts[i].as_vec_type<float>();
+    return results;
+}
+} // namespace
+
+TEST(test_sdp_bwd_decomp_execute, F32SdpBackwardMask_CPU) {
+    graph::engine_t *eng = get_engine();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+    SKIP_IF(DNNL_CPU_RUNTIME != DNNL_RUNTIME_OMP
+                    && DNNL_CPU_RUNTIME != DNNL_RUNTIME_THREADPOOL,
+            "Skip for runtimes without the decomposition kernel.");
+
+    const dim_t HEADS = num_heads();
+    std::minstd_rand gen(1);
+    const std::map<size_t, std::vector<float>> data {
+            {0, make_uniform_data(gen, MB * HEADS * LQ * D)},
+            {1, make_uniform_data(gen, MB * HEADS * LK * D)},
+            {3, {std::sqrt(static_cast<float>(D))}},
+            {5, make_uniform_data(gen, MB * LK)},
+            {7, make_uniform_data(gen, MB * HEADS * LQ, 4.f)},
+            {10, make_uniform_data(gen, MB * HEADS * LQ * D)},
+            {12, make_uniform_data(gen, MB * HEADS * LK * D)}};
+
+    const auto dst = run_sdp_bwd(data, false);
+    const auto ref = run_sdp_bwd(data, true);
+    ASSERT_EQ(dst.size(), ref.size());
+    for (const auto &r : ref) {
+        const auto &d = dst.at(r.first);
+        ASSERT_EQ(d.size(), r.second.size());
+        for (size_t i = 0; i < d.size(); i++) {
+            const float tol = 1e-4f * std::max(1.f, std::fabs(r.second[i]));
+            ASSERT_NEAR(d[i], r.second[i], tol)
+                    << "output " << r.first << " at " << i;
+        }
+    }
+}
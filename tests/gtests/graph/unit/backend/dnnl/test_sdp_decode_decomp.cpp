@@ -0,0 +1,228 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+#include "graph/unit/utils.hpp"
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+using dim_t = dnnl_dim_t;
+using dims = std::vector<dim_t>;
+
+namespace {
+// Explicit mask broadcast over heads and queries, or an implicit causal mask
+// aligned to the top-left or to the bottom-right corner of the scores.
+enum class mask_kind_t { explicit_mask, top_left, bottom_right };
+
+struct sdp_config_t {
+    dim_t mb, heads, kv_heads, lq, lk, d;
+    mask_kind_t mask;
+    // The value of the scores masked out by a causal mask.
+    float causal_value;
+};
+
+// Builds a scaled dot-product attention, compiles it and returns its output
+// for the given inputs, keyed by id.
+std::vector<float> run_sdp(const sdp_config_t &c,
+        const std::map<size_t, std::vector<float>> &data,
+        bool force_primitive) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    const auto f32 = graph::data_type::f32;
+    const dims scores_dims {c.mb, c.heads, c.lq, c.lk};
+    std::map<size_t, graph::logical_tensor_t> lts;
+    lts[0] = utils::logical_tensor_init(0, {c.mb, c.heads, c.lq, c.d}, f32);
+    lts[1] = utils::logical_tensor_init(1, {c.mb, c.kv_heads, c.lk, c.d}, f32);
+    for (size_t id : {2, 4, 6, 7})
+        lts[id] = utils::logical_tensor_init(id, scores_dims, f32);
+    lts[3] = utils::logical_tensor_init(3, {1}, f32);
+    const bool causal = c.mask != mask_kind_t::explicit_mask;
+    lts[5] = causal ? utils::logical_tensor_init(5, {1}, f32)
+                    : utils::logical_tensor_init(5, {c.mb, 1, 1, c.lk}, f32);
+    lts[8] = utils::logical_tensor_init(8, {c.mb, c.kv_heads, c.lk, c.d}, f32);
+    lts[9] = utils::logical_tensor_init(9, {c.mb, c.heads, c.lq, c.d}, f32);
+    for (size_t id : {10, 11, 15, 16})
+        lts[id] = utils::logical_tensor_init(
+                id, scores_dims, graph::data_type::s32);
+    // The lengths of the key and query sequences of a bottom-right mask.
+    for (size_t id : {13, 14})
+        lts[id] = utils::logical_tensor_init(id, {1}, graph::data_type::s32);
+    lts[12] = utils::logical_tensor_init(
+            12, scores_dims, graph::data_type::boolean);
+
+    std::vector<std::unique_ptr<graph::op_t>> ops;
+    const auto add_op = [&](graph::op_kind_t kind, std::vector<size_t> ins,
+                                size_t out, int64_t axis = 0) {
+        const size_t id = ops.size();
+        ops.emplace_back(new graph::op_t(id, kind, "op" + std::to_string(id)));
+        auto &op = *ops.back();
+        if (kind == graph::op_kind::MatMul)
+            op.set_attr<bool>(graph::op_attr::transpose_b, axis != 0);
+        if (kind == graph::op_kind::SoftMax
+                || kind == graph::op_kind::GenIndex)
+            op.set_attr<int64_t>(graph::op_attr::axis, axis);
+        for (size_t in : ins)
+            op.add_input(lts[in]);
+        op.add_output(lts[out]);
+    };
+    add_op(graph::op_kind::MatMul, {0, 1}, 2, true);
+    add_op(graph::op_kind::Divide, {2, 3}, 4);
+    if (causal) {
+        size_t row = 10;
+        add_op(graph::op_kind::GenIndex, {4}, 10, 2);
+        if (c.mask == mask_kind_t::bottom_right) {
+            add_op(graph::op_kind::Add, {10, 13}, 15);
+            add_op(graph::op_kind::Subtract, {15, 14}, 16);
+            row = 16;
+        }
+        add_op(graph::op_kind::GenIndex, {4}, 11, 3);
+        add_op(graph::op_kind::GreaterEqual, {row, 11}, 12);
+        add_op(graph::op_kind::Select, {12, 4, 5}, 6);
+    } else {
+        add_op(graph::op_kind::Add, {4, 5}, 6);
+    }
+    add_op(graph::op_kind::SoftMax, {6}, 7, -1);
+    add_op(graph::op_kind::MatMul, {7, 8}, 9);
+
+    graph::graph_t g(eng->kind());
+    for (auto &op : ops)
+        g.add_op(op.get());
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("float_sdp_fusion_cpu");
+    apass->run(g);
+    EXPECT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (const auto &lt : p.get_inputs())
+        inputs.push_back(&lts[lt.id]);
+    for (const auto &lt : p.get_outputs())
+        outputs.push_back(&lts[lt.id]);
+    EXPECT_EQ(outputs.size(), 1U);
+
+    graph::compiled_partition_t cp(p);
+    compile_decomp_partition(p, cp, inputs, outputs, eng,
+            "_ONEDNN_GRAPH_SDPA_FORCE_PRIMITIVE", force_primitive,
+            "sdp_decode_decomp_kernel_t");
+
+    std::vector<test_tensor_t> in_ts;
+    std::vector<graph::tensor_t> in_args;
+    for (const auto *lt : inputs) {
+        const auto &d = data.at(lt->id);
+        if (lt->data_type == graph::data_type::s32)
+            in_ts.emplace_back(
+                    *lt, eng, std::vector<int32_t>(d.begin(), d.end()));
+        else
+            in_ts.emplace_back(*lt, eng, d);
+    }
+    for (auto &ts : in_ts)
+        in_args.push_back(ts.get());
+    test_tensor_t out_ts(*outputs[0], eng);
+    EXPECT_EQ(cp.execute(strm, in_args, {out_ts.get()}),
+            graph::status::success);
+    strm->wait();
+    return out_ts.as_vec_type<float>();
+}
+
+// Compares the attention to the one computed with the forced primitives.
+void check_sdp(const sdp_config_t &c) {
+    std::minstd_rand gen(1);
+    const float inf = std::numeric_limits<float>::infinity();
+    // With an explicit mask, the first half of the keys is masked out, so
+    // that whole chunks may be masked out.
+    std::vector<float> mask {c.causal_value};
+    if (c.mask == mask_kind_t::explicit_mask) {
+        mask = make_uniform_data(gen, c.mb * c.lk);
+        std::fill(mask.begin(), mask.begin() + c.lk / 2, -inf);
+    }
+    const std::map<size_t, std::vector<float>> data {
+            {0, make_uniform_data(gen, c.mb * c.heads * c.lq * c.d)},
+            {1, make_uniform_data(gen, c.mb * c.kv_heads * c.lk * c.d)},
+            {3, {std::sqrt(static_cast<float>(c.d))}}, {5, mask},
+            {8, make_uniform_data(gen, c.mb * c.kv_heads * c.lk * c.d)},
+            {13, {static_cast<float>(c.lk)}},
+            {14, {static_cast<float>(c.lq)}}};
+
+    const auto dst = run_sdp(c, data, false);
+    const auto ref = run_sdp(c, data, true);
+    ASSERT_EQ(dst.size(), ref.size());
+    for (size_t i = 0; i < dst.size(); i++) {
+        const float tol = 1e-5f * std::max(1.f, std::fabs(ref[i]));
+        ASSERT_NEAR(dst[i], ref[i], tol) << "at " << i;
+    }
+}
+} // namespace
+
+TEST(test_sdp_decode_decomp_execute, F32SdpDecodeMask_CPU) {
+    graph::engine_t *eng = get_engine();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+    SKIP_IF(DNNL_CPU_RUNTIME != DNNL_RUNTIME_OMP
+                    && DNNL_CPU_RUNTIME != DNNL_RUNTIME_THREADPOOL,
+            "Skip for runtimes without the decomposition kernel.");
+
+    // A decoding step of multi-query attention: few (batch, head) pairs and a
+    // long sequence of keys which is not a multiple of the chunks. The keys
+    // are split into 6 chunks whatever the number of threads.
+    set_internal_env("_ONEDNN_GRAPH_SDPA_FLASH_CHUNK", "512");
+    check_sdp({1, 2, 1, 1, 3000, 64, mask_kind_t::explicit_mask, 0.f});
+    set_internal_env("_ONEDNN_GRAPH_SDPA_FLASH_CHUNK", "0");
+}
+
+TEST(test_sdp_decode_decomp_execute, F32SdpCausal_CPU) {
+    graph::engine_t *eng = get_engine();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+    SKIP_IF(DNNL_CPU_RUNTIME != DNNL_RUNTIME_OMP
+                    && DNNL_CPU_RUNTIME != DNNL_RUNTIME_THREADPOOL,
+            "Skip for runtimes without the decomposition kernel.");
+
+    const float inf = std::numeric_limits<float>::infinity();
+    // Partial blocks of queries and keys, with blocks of keys which are
+    // masked out for all queries of a block.
+    check_sdp({2, 2, 2, 100, 1100, 32, mask_kind_t::top_left, -inf});
+    // The diagonal is shifted by the difference of the sequence lengths.
+    check_sdp({2, 2, 2, 300, 400, 32, mask_kind_t::bottom_right, -inf});
+}
+
+TEST(test_sdp_decode_decomp_execute, F32SdpCausalFiniteValue_CPU) {
+    graph::engine_t *eng = get_engine();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+    SKIP_IF(DNNL_CPU_RUNTIME != DNNL_RUNTIME_OMP
+                    && DNNL_CPU_RUNTIME != DNNL_RUNTIME_THREADPOOL,
+            "Skip for runtimes without the decomposition kernel.");
+
+    // Masked scores still contribute to the softmax, so no block of keys is
+    // skipped.
+    check_sdp({2, 2, 2, 100, 1100, 32, mask_kind_t::top_left, -2.f});
+    check_sdp({2, 2, 2, 300, 400, 32, mask_kind_t::bottom_right, -2.f});
+}
@@ -1475,6 +1475,113 @@ TEST(test_subgraph_pass, FuseSigmoidMultiplyToSwish) {
             dnnl::algorithm::eltwise_swish);
 }
 
+TEST(test_subgraph_pass, FuseParallelMatmuls_CPU) {
+    /*
+               src
+           /    |    \
+     matmul  matmul  matmul (transpose_a)
+        |       |       |
+    softmax softmax  softmax
+    */
+    graph::engine_t *g_eng = get_engine();
+    SKIP_IF(g_eng->kind() == graph::engine_kind::gpu,
+            "horizontal matmul fusion is only enabled for CPU");
+    dnnl::engine p_eng = dnnl::impl::graph::dnnl_impl::make_dnnl_engine(*g_eng);
+    SKIP_IF(!dnnl_impl::is_constant_cache_enabled(p_eng),
+            "horizontal matmul fusion requires the constant cache");
+
+    const int64_t M = 4, K = 16, N0 = 8, N1 = 24;
+    graph::op_t mm0 {0, graph::op_kind::MatMul, "mm0"};
+    graph::op_t mm1 {1, graph::op_kind::MatMul, "mm1"};
+    graph::op_t mm2 {2, graph::op_kind::MatMul, "mm2"};
+    mm2.set_attr<bool>(op_attr::transpose_a, true);
+    graph::op_t sm0 {3, graph::op_kind::SoftMax, "sm0"};
+    graph::op_t sm1 {4, graph::op_kind::SoftMax, "sm1"};
+    graph::op_t sm2 {5, graph::op_kind::SoftMax, "sm2"};
+    for (auto *sm : {&sm0, &sm1, &sm2})
+        sm->set_attr<int64_t>(op_attr::axis, -1);
+
+    auto src = logical_tensor_init(0, {M, K}, graph::data_type::f32);
+    auto wei0 = logical_tensor_init(1, {K, N0}, graph::data_type::f32);
+    auto wei1 = logical_tensor_init(2, {K, N1}, graph::data_type::f32);
+    auto wei2 = logical_tensor_init(3, {M, N0}, graph::data_type::f32);
+    for (auto *wei : {&wei0, &wei1, &wei2})
+        wei->property = graph::property_type::constant;
+    auto mm0_dst = logical_tensor_init(
+            4, {M, N0}, graph::data_type::f32, graph::layout_type::any);
+    auto mm1_dst = logical_tensor_init(
+            5, {M, N1}, graph::data_type::f32, graph::layout_type::any);
+    auto mm2_dst = logical_tensor_init(
+            6, {K, N0}, graph::data_type::f32, graph::layout_type::any);
+    auto sm0_dst = logical_tensor_init(7, {M, N0}, graph::data_type::f32);
+    auto sm1_dst = logical_tensor_init(8, {M, N1}, graph::data_type::f32);
+    auto sm2_dst = logical_tensor_init(9, {K, N0}, graph::data_type::f32);
+
+    mm0.add_input(src);
+    mm0.add_input(wei0);
+    mm0.add_output(mm0_dst);
+    mm1.add_input(src);
+    mm1.add_input(wei1);
+    mm1.add_output(mm1_dst);
+    mm2.add_input(src);
+    mm2.add_input(wei2);
+    mm2.add_output(mm2_dst);
+    sm0.add_input(mm0_dst);
+    sm0.add_output(sm0_dst);
+    sm1.add_input(mm1_dst);
+    sm1.add_output(sm1_dst);
+    sm2.add_input(mm2_dst);
+    sm2.add_output(sm2_dst);
+
+    graph::graph_t g(g_eng->kind());
+    for (auto *op : {&mm0, &mm1, &mm2, &sm0, &sm1, &sm2})
+        g.add_op(op);
+    g.finalize();
+
+    const graph::fpmath_t fpm {fpmath_mode::strict, false};
+    auto subgraph = std::make_shared<dnnl_impl::subgraph_t>(
+            g.get_ops(), p_eng, fpm, false, true);
+    std::vector<logical_tensor_t> inputs = {src, wei0, wei1, wei2};
+    std::vector<logical_tensor_t> outputs = {sm0_dst, sm1_dst, sm2_dst};
+    dnnl_impl::set_given_inputs_outputs(subgraph, inputs, outputs);
+
+    dnnl_impl::pass_pipeline_t pipeline(
+            dnnl_impl::subgraph_visualizer_t(), true, false);
+    dnnl_impl::larger_partition_kernel_t::setup_pipeline_stage1(pipeline);
+    ASSERT_EQ(pipeline.run(subgraph), graph::status::success);
+
+    // mm0 and mm1 are merged, mm2 reads the transposed src
+    auto count_ops = [&](op_kind_t kind) {
+        return std::count_if(subgraph->get_ops().begin(),
+                subgraph->get_ops().end(),
+                [&](const op_ptr &op) { return op->get_kind() == kind; });
+    };
+    ASSERT_EQ(count_ops(dnnl_impl::op_kind::dnnl_matmul), 2);
+    ASSERT_EQ(count_ops(dnnl_impl::op_kind::dnnl_concat), 1);
+    ASSERT_EQ(count_ops(dnnl_impl::op_kind::dnnl_slice), 2);
+
+    for (const auto &op : subgraph->get_ops()) {
+        if (op->get_kind() != dnnl_impl::op_kind::dnnl_slice) continue;
+        const auto in_lt = op->get_input_value(0)->get_logical_tensor();
+        const auto out_lt = op->get_output_value(0)->get_logical_tensor();
+        ASSERT_EQ(in_lt.dims[1], N0 + N1);
+        ASSERT_EQ(op->get_attr<int64_t>(dnnl_impl::op_attr::slice_begin),
+                out_lt.dims[1] == N0 ? 0 : N0);
+    }
+
+    // both slices are bound in place into the merged matmul output
+    dnnl_impl::memory_planner_t memory_planner;
+    dnnl_impl::pass_pipeline_t pipeline2(
+            dnnl_impl::subgraph_visualizer_t(), true, false);
+    dnnl_impl::larger_partition_kernel_t::setup_pipeline_stage2(
+            pipeline2, memory_planner, true);
+    ASSERT_EQ(pipeline2.run(subgraph), graph::status::success);
+    ASSERT_EQ(memory_planner.get_exec_args_set()
+                      .get_mems_use_sub_buffers()
+                      .size(),
+            2U);
+}
+
 TEST(test_subgraph_pass_int8_matmul_passes_with_diff_inputs,
         X8X8BF16MatmulScaleAddPasses_CPU) {
     /*
@@ -1821,6 +1928,73 @@ TEST(test_subgraph_pass_layout_propagation, Transpose) {
     ASSERT_EQ(md_stride, out_stride);
 }
 
+TEST(test_subgraph_pass_layout_propagation, LayoutAssignmentConvChain) {
+    using dims = graph::dnnl_impl::dims;
+    graph::engine_t *g_eng = get_engine();
+    dnnl::engine p_eng = dnnl::impl::graph::dnnl_impl::make_dnnl_engine(*g_eng);
+
+    // Counts the reorders of two chained convolutions after the layouts are
+    // propagated greedily or assigned over the subgraph, with or without
+    // blocked layouts allowed.
+    const auto count_reorders = [&](bool assign, bool blocked) {
+        graph::op_t conv0(0, graph::op_kind::Convolution, "conv0");
+        graph::op_t conv1(1, graph::op_kind::Convolution, "conv1");
+        for (auto *conv : {&conv0, &conv1}) {
+            conv->set_attr<dims>(op_attr::strides, dims(2, 1));
+            conv->set_attr<dims>(op_attr::dilations, dims(2, 1));
+            conv->set_attr<dims>(op_attr::pads_begin, dims(2, 1));
+            conv->set_attr<dims>(op_attr::pads_end, dims(2, 1));
+            conv->set_attr<int64_t>(op_attr::groups, 1);
+            conv->set_attr<std::string>(op_attr::data_format, "NCX");
+            conv->set_attr<std::string>(op_attr::weights_format, "OIX");
+        }
+        const std::vector<int64_t> act_shape {8, 32, 28, 28};
+        const std::vector<int64_t> wei_shape {32, 32, 3, 3};
+        auto src = logical_tensor_init(0, act_shape, graph::data_type::f32);
+        auto wei0 = logical_tensor_init(1, wei_shape, graph::data_type::f32);
+        auto mid = logical_tensor_init(2, act_shape, graph::data_type::f32);
+        auto wei1 = logical_tensor_init(3, wei_shape, graph::data_type::f32);
+        auto dst = logical_tensor_init(4, act_shape, graph::data_type::f32);
+        conv0.add_input(src);
+        conv0.add_input(wei0);
+        conv0.add_output(mid);
+        conv1.add_input(mid);
+        conv1.add_input(wei1);
+        conv1.add_output(dst);
+
+        graph::graph_t g;
+        g.add_op(&conv0);
+        g.add_op(&conv1);
+        g.finalize();
+        const graph::fpmath_t fpm {fpmath_mode::strict, false};
+        auto subgraph = std::make_shared<dnnl_impl::subgraph_t>(
+                g.get_ops(), p_eng, fpm, blocked, true);
+        EXPECT_EQ(dnnl_impl::set_given_inputs_outputs(
+                          subgraph, {src, wei0, wei1}, {dst}),
+                graph::status::success);
+        EXPECT_EQ(dnnl_impl::lower_down(subgraph), graph::status::success);
+        EXPECT_EQ(dnnl_impl::infer_shape(subgraph), graph::status::success);
+        EXPECT_EQ(dnnl_impl::insert_to_group_for_conv_or_deconv(subgraph),
+                graph::status::success);
+        EXPECT_EQ(assign ? dnnl_impl::layout_assignment(subgraph)
+                         : dnnl_impl::layout_propagation(subgraph),
+                graph::status::success);
+        EXPECT_EQ(dnnl_impl::fuse_adjacent_reorders(subgraph),
+                graph::status::success);
+        return std::count_if(subgraph->get_ops().begin(),
+                subgraph->get_ops().end(), [](const op_ptr &op) {
+                    return op->get_kind() == dnnl_impl::op_kind::dnnl_reorder;
+                });
+    };
+
+    // Writing the intermediate tensor in plain layout would only add a
+    // reorder before the second convolution, so the greedy choice is kept.
+    ASSERT_EQ(count_reorders(true, true), count_reorders(false, true));
+    // Without blocked layouts, the convolutions already use plain
+    // activations and the assignment keeps the same reorders.
+    ASSERT_EQ(count_reorders(true, false), count_reorders(false, false));
+}
+
 TEST(test_subgraph_pass, FuseTypecastBeforeFusePostops) {
     graph::engine_t *engine = get_engine();
 
@@ -64,3 +64,28 @@ TEST(test_interface_allocator, AllocatorEarlyDestroy) {
 #endif
     }
 }
+
+TEST(test_interface_allocator, ArenaServesTemporaryBuffers) {
+    using allocator_t = dnnl::impl::graph::allocator_t;
+    allocator_t alloc(
+            std::make_shared<dnnl::impl::graph::utils::host_arena_t>());
+    const allocator_t::mem_attr_t temp_attr {
+            allocator_t::mem_type_t::temp, 64};
+    const allocator_t::mem_attr_t persistent_attr {
+            allocator_t::mem_type_t::persistent, 64};
+
+    void *temp = alloc.allocate(static_cast<size_t>(16), temp_attr);
+    void *persistent
+            = alloc.allocate(static_cast<size_t>(16), persistent_attr);
+    ASSERT_NE(temp, nullptr);
+    ASSERT_NE(persistent, nullptr);
+    alloc.deallocate(temp);
+    alloc.deallocate(persistent);
+
+    // a copy, like the one held by an engine, shares the arena
+    allocator_t copy = alloc;
+    temp = copy.allocate(static_cast<size_t>(16), temp_attr);
+    copy.deallocate(temp);
+    ASSERT_EQ(alloc.get_arena()->get_num_requests(), 2U);
+    ASSERT_EQ(alloc.get_arena()->get_num_hits(), 1U);
+}
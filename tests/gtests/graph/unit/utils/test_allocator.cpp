@@ -55,3 +55,69 @@ TEST(test_utils_allocator, SyclAlloctorMallocAndFree) {
 #endif
     }
 }
+
+TEST(test_utils_allocator, HostArenaReuse) {
+    graph::utils::host_arena_t arena;
+    void *p1 = arena.malloc(1000, 64);
+    ASSERT_NE(p1, nullptr);
+    ASSERT_TRUE(arena.free(p1));
+    ASSERT_EQ(arena.get_num_hits(), 0U);
+
+    // a request of a close size reuses the freed block
+    void *p2 = arena.malloc(2000, 64);
+    ASSERT_EQ(p2, p1);
+    ASSERT_EQ(arena.get_num_hits(), 1U);
+
+    // a block more than twice as large as needed is not reused
+    ASSERT_TRUE(arena.free(p2));
+    void *p3 = arena.malloc(16, 64);
+    ASSERT_NE(p3, p2);
+    ASSERT_EQ(arena.get_num_requests(), 3U);
+    ASSERT_EQ(arena.get_num_hits(), 1U);
+    ASSERT_EQ(arena.get_resident_size(),
+            2 * graph::utils::host_arena_t::PAGE_SIZE);
+    ASSERT_TRUE(arena.free(p3));
+
+    // buffers not allocated by the arena are left to the caller
+    int buffer = 0;
+    ASSERT_FALSE(arena.free(&buffer));
+    ASSERT_EQ(arena.malloc(16, 2 * graph::utils::host_arena_t::PAGE_SIZE),
+            nullptr);
+}
+
+TEST(test_utils_allocator, HostArenaHugePages) {
+    using arena_t = graph::utils::host_arena_t;
+    arena_t arena;
+    void *p = arena.malloc(arena_t::HUGE_PAGE_SIZE + 1, 64);
+    ASSERT_NE(p, nullptr);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(p) % arena_t::HUGE_PAGE_SIZE, 0U);
+    ASSERT_EQ(arena.get_resident_size(), 2 * arena_t::HUGE_PAGE_SIZE);
+    ASSERT_TRUE(arena.free(p));
+}
+
+TEST(test_utils_allocator, HostArenaIdleLimit) {
+    using arena_t = graph::utils::host_arena_t;
+    arena_t arena(2 * arena_t::PAGE_SIZE);
+    void *p1 = arena.malloc(arena_t::PAGE_SIZE, 64);
+    void *p2 = arena.malloc(2 * arena_t::PAGE_SIZE, 64);
+    ASSERT_NE(p1, nullptr);
+    ASSERT_NE(p2, nullptr);
+    ASSERT_EQ(arena.get_resident_size(), 3 * arena_t::PAGE_SIZE);
+
+    // the largest free block is released once the limit is exceeded
+    ASSERT_TRUE(arena.free(p1));
+    ASSERT_EQ(arena.get_idle_size(), arena_t::PAGE_SIZE);
+    ASSERT_TRUE(arena.free(p2));
+    ASSERT_EQ(arena.get_idle_size(), arena_t::PAGE_SIZE);
+    ASSERT_EQ(arena.get_resident_size(), arena_t::PAGE_SIZE);
+
+    // the remaining free block is still reused
+    void *p3 = arena.malloc(16, 64);
+    ASSERT_EQ(p3, p1);
+    ASSERT_EQ(arena.get_idle_size(), 0U);
+    ASSERT_TRUE(arena.free(p3));
+
+    arena.trim();
+    ASSERT_EQ(arena.get_idle_size(), 0U);
+    ASSERT_EQ(arena.get_resident_size(), 0U);
+}
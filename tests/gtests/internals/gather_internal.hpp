@@ -0,0 +1,86 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef DNNL_TEST_INTERNAL_GATHER_INTERNAL_HPP
+#define DNNL_TEST_INTERNAL_GATHER_INTERNAL_HPP
+
+#include "dnnl.hpp"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+/// Creates a primitive descriptor for a gather (embedding bag) primitive
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param table_desc Lookup table memory descriptor.
+/// @param indices_desc Indices memory descriptor.
+/// @param offsets_desc Offsets memory descriptor (can be NULL for a plain
+///     gather).
+/// @param dst_desc Destination memory descriptor.
+/// @param alg_kind Reduction algorithm applied to the rows of a bag.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+
+dnnl_status_t DNNL_API gather_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t table_desc,
+        const_dnnl_memory_desc_t indices_desc,
+        const_dnnl_memory_desc_t offsets_desc,
+        const_dnnl_memory_desc_t dst_desc, dnnl_alg_kind_t alg_kind,
+        const_dnnl_primitive_attr_t attr);
+
+namespace dnnl {
+namespace impl {
+
+/// Gather (embedding bag) internal primitive.
+struct gather : public dnnl::primitive {
+    /// Primitive descriptor for a gather primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        primitive_desc(const engine &aengine, const memory::desc &table_desc,
+                const memory::desc &indices_desc,
+                const memory::desc *offsets_desc,
+                const memory::desc &dst_desc, algorithm aalgorithm,
+                const primitive_attr &attr = default_attr()) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = gather_primitive_desc_create(&pd,
+                    aengine.get(), table_desc.get(), indices_desc.get(),
+                    optional_arg(offsets_desc), dst_desc.get(),
+                    dnnl::convert_to_c(aalgorithm), attr.get());
+
+            dnnl::error::wrap_c_api(status,
+                    "could not create a primitive descriptor for a gather "
+                    "primitive");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    gather() = default;
+
+    /// Constructs a gather primitive.
+    /// @param pd Primitive descriptor for a gather primitive.
+    gather(const primitive_desc &pd) : primitive(pd) {}
+};
+} // namespace impl
+} // namespace dnnl
+
+// NOLINTEND(readability-identifier-naming)
+#endif
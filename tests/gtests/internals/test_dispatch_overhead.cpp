@@ -0,0 +1,206 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <dnnl_test_common.hpp>
+#include <gtest/gtest.h>
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "src/common/memory_tracking.hpp"
+#include "src/common/primitive_desc.hpp"
+#include "src/common/primitive_desc_iface.hpp"
+#include "src/common/primitive_exec_types.hpp"
+#include "src/common/primitive_iface.hpp"
+
+namespace dnnl {
+
+// Measures the per-call overhead of the library on problems small enough for
+// kernel time to be negligible, split by stage of the execution path:
+// - primitive descriptor creation (implementation dispatching),
+// - primitive creation served by the primitive cache,
+// - a wake-up of the threading runtime by an empty `parallel()` region,
+// - conversion of the C API arguments,
+// - execution context construction,
+// - scratchpad grant, which sets up the grantor the kernels take their
+//   scratchpad from,
+// - execution through the C API, which includes the three stages above,
+// - execution through the C++ API, which adds the arguments conversion.
+//
+// Absolute timings depend on the machine and its load, so they are only
+// recorded as test properties (see `--gtest_output`). The test checks that
+// the measured path is the expected one: repeated pd creation dispatches to
+// the same implementation, and primitive creation is served by the primitive
+// cache without adding entries. It also checks relative bounds loose enough
+// not to be affected by noise: every stage of an execution is cheaper than
+// the whole execution, and the C++ API adds little to the C API.
+class dispatch_overhead_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "Test is implemented for CPU only.");
+        eng = engine(engine::kind::cpu, 0);
+        strm = make_stream(eng);
+    }
+
+    // Returns the average duration of a call to `f` in nanoseconds.
+    double ns_per_call(const std::function<void()> &f, int n_iters) {
+        for (int i = 0; i < n_iters / 100 + 1; i++)
+            f();
+        strm.wait();
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < n_iters; i++)
+            f();
+        strm.wait();
+        const auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count()
+                / n_iters;
+    }
+
+    template <typename primitive_t, typename pd_t>
+    void run(const std::function<pd_t(const primitive_attr &)> &create_pd,
+            const std::unordered_map<int, memory> &args) {
+        // Primitive creation is orders of magnitude slower than execution.
+        constexpr int n_create_iters = 1000;
+        constexpr int n_exec_iters = 10000;
+
+        const primitive_attr attr;
+        const auto pd = create_pd(attr);
+        const primitive_t prim(pd);
+        const impl::primitive_desc_t *pd_impl
+                = prim.get()->pd()->impl().get();
+
+        std::vector<dnnl_exec_arg_t> c_args;
+        for (const auto &a : args)
+            c_args.push_back({a.first, a.second.get()});
+        const int nargs = static_cast<int>(c_args.size());
+
+        impl::exec_args_t exec_args;
+        ASSERT_EQ(impl::cvt_primitive_args(
+                          pd_impl, nargs, c_args.data(), exec_args),
+                impl::status::success);
+        impl::exec_ctx_t ctx(strm.get(), impl::exec_args_t(exec_args));
+
+        // The timed calls take the same path as these ones.
+        const std::string impl_name = pd.impl_info_str();
+        ASSERT_EQ(impl_name, create_pd(attr).impl_info_str());
+        if (get_primitive_cache_capacity() > 0) {
+            ASSERT_TRUE(impl::is_primitive_in_cache(prim.get()));
+            ASSERT_TRUE(impl::is_primitive_in_cache(primitive_t(pd).get()));
+        }
+        const int cache_size = get_primitive_cache_size();
+
+        impl::status_t status = impl::status::success;
+        const double pd_creation = ns_per_call(
+                [&]() { create_pd(attr); }, n_create_iters);
+        const double primitive_creation = ns_per_call(
+                [&]() { primitive_t p(pd); }, n_create_iters);
+        const double empty_parallel = ns_per_call(
+                [&]() { impl::parallel(0, [](int, int) {}); }, n_exec_iters);
+        const double args_conversion = ns_per_call(
+                [&]() {
+                    impl::exec_args_t a;
+                    status = impl::cvt_primitive_args(
+                            pd_impl, nargs, c_args.data(), a);
+                },
+                n_exec_iters);
+        const double ctx_construction = ns_per_call(
+                [&]() {
+                    impl::exec_ctx_t c(
+                            strm.get(), impl::exec_args_t(exec_args));
+                },
+                n_exec_iters);
+        const double scratchpad_grant = ns_per_call(
+                [&]() {
+                    const auto grantor = pd_impl->scratchpad_registry().grantor(
+                            nullptr, ctx);
+                    ctx.set_scratchpad_grantor(&grantor);
+                    ctx.set_scratchpad_grantor(nullptr);
+                },
+                n_exec_iters);
+        const double c_execute = ns_per_call(
+                [&]() {
+                    status = dnnl_primitive_execute(
+                            prim.get(), strm.get(), nargs, c_args.data());
+                },
+                n_exec_iters);
+        const double cpp_execute = ns_per_call(
+                [&]() { prim.execute(strm, args); }, n_exec_iters);
+        ASSERT_EQ(status, impl::status::success);
+
+        // Cache hits neither add nor evict entries.
+        ASSERT_EQ(get_primitive_cache_size(), cache_size);
+
+        const std::vector<std::pair<const char *, double>> stages = {
+                {"pd_creation_ns", pd_creation},
+                {"primitive_creation_cache_hit_ns", primitive_creation},
+                {"empty_parallel_ns", empty_parallel},
+                {"args_conversion_ns", args_conversion},
+                {"ctx_construction_ns", ctx_construction},
+                {"scratchpad_grant_ns", scratchpad_grant},
+                {"c_execute_ns", c_execute},
+                {"cpp_execute_ns", cpp_execute},
+        };
+        RecordProperty("impl", impl_name);
+        for (const auto &s : stages)
+            RecordProperty(s.first, std::to_string(s.second));
+
+        EXPECT_LT(args_conversion, c_execute) << impl_name;
+        EXPECT_LT(ctx_construction, c_execute) << impl_name;
+        EXPECT_LT(scratchpad_grant, c_execute) << impl_name;
+        EXPECT_LT(cpp_execute, 2 * c_execute) << impl_name;
+    }
+
+    engine eng;
+    stream strm;
+};
+
+TEST_F(dispatch_overhead_test_t, Eltwise) {
+    const memory::desc md(
+            {1, 16}, memory::data_type::f32, memory::format_tag::ab);
+    const memory src(md, eng), dst(md, eng);
+    run<eltwise_forward, eltwise_forward::primitive_desc>(
+            [&](const primitive_attr &attr) {
+                return eltwise_forward::primitive_desc(eng,
+                        prop_kind::forward_inference, algorithm::eltwise_relu,
+                        md, md, 0.f, 0.f, attr);
+            },
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+}
+
+TEST_F(dispatch_overhead_test_t, Matmul) {
+    const memory::desc src_md(
+            {1, 16}, memory::data_type::f32, memory::format_tag::ab);
+    const memory::desc wei_md(
+            {16, 16}, memory::data_type::f32, memory::format_tag::ab);
+    const memory src(src_md, eng), wei(wei_md, eng), dst(src_md, eng);
+    run<matmul, matmul::primitive_desc>(
+            [&](const primitive_attr &attr) {
+                return matmul::primitive_desc(
+                        eng, src_md, wei_md, src_md, attr);
+            },
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst}});
+}
+
+} // namespace dnnl
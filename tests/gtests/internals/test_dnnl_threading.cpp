@@ -14,11 +14,15 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <thread>
 #include <vector>
 
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
+#include "src/common/stream.hpp"
+
 namespace dnnl {
 
 TEST(test_parallel, Test) {
@@ -29,6 +33,53 @@ TEST(test_parallel, Test) {
     });
 }
 
+// Thread teams are unimplemented for OpenMP and threadpool runtimes
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL \
+        && DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_OMP \
+        && DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_THREADPOOL
+TEST(test_parallel, ThreadTeam) {
+    const int max_nthr = dnnl_get_max_threads();
+    const int team = std::max(1, max_nthr / 2);
+
+    engine eng(engine::kind::cpu, 0);
+    stream s = make_stream(eng);
+    s.set_thread_team(team);
+    impl::stream_t *strm = s.get();
+
+    auto check_team = [&]() {
+        EXPECT_LE(dnnl_get_max_threads(), team);
+        EXPECT_LE(dnnl_get_current_num_threads(), team);
+        impl::parallel(0, [&](int ithr, int nthr) {
+            EXPECT_LE(nthr, team);
+            EXPECT_LT(ithr, team);
+        });
+    };
+
+    strm->before_exec_hook();
+    check_team();
+
+    // A kernel executing primitives on the stream it runs on nests the hooks
+    strm->before_exec_hook();
+    check_team();
+    strm->after_exec_hook();
+    check_team();
+
+    // Other threads executing on the stream keep their own team size
+    std::thread other([&]() {
+        strm->before_exec_hook();
+        check_team();
+        strm->after_exec_hook();
+        EXPECT_EQ(dnnl_thr_team_size(), 0);
+    });
+    other.join();
+    check_team();
+
+    strm->after_exec_hook();
+    ASSERT_EQ(dnnl_thr_team_size(), 0);
+}
+#endif
+
 using data_t = ptrdiff_t;
 
 struct nd_params_t {
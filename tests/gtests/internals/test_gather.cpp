@@ -0,0 +1,322 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <dnnl_test_common.hpp>
+#include <gtest/gtest.h>
+
+#include "gather_internal.hpp"
+#include "test_utils.hpp"
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <cfloat>
+#include <cstring>
+#include <random>
+
+namespace dnnl {
+
+using mdt = memory::data_type;
+using tag = memory::format_tag;
+
+struct gather_params_t {
+    memory::dim rows;
+    memory::dim cols;
+    memory::dim n_bags; // 0 means a plain gather without offsets
+    memory::dim max_bag_size;
+
+    mdt table_dt;
+    mdt dst_dt;
+    algorithm alg;
+
+    bool per_row_scales;
+    bool with_zero_point;
+};
+
+std::ostream &operator<<(std::ostream &ss, const gather_params_t &p) {
+    ss << "rows_" << p.rows << "_cols_" << p.cols;
+    if (p.n_bags)
+        ss << "_bags_" << p.n_bags << "_max_bag_" << p.max_bag_size << "_"
+           << dnnl_alg_kind2str(dnnl::convert_to_c(p.alg));
+    else
+        ss << "_gather";
+    ss << "_" << dnnl_dt2str(memory::convert_to_c(p.table_dt)) << "_"
+       << dnnl_dt2str(memory::convert_to_c(p.dst_dt));
+    if (p.per_row_scales) ss << "_per_row_scales";
+    if (p.with_zero_point) ss << "_zp";
+    return ss;
+}
+
+std::string print_to_string(
+        const ::testing::TestParamInfo<gather_params_t> &info) {
+    std::stringstream ss;
+    ss << info.param;
+    return ss.str();
+}
+
+class gather_test_t : public ::testing::TestWithParam<gather_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "Gather primitive is implemented for CPU only.");
+        eng = engine(engine::kind::cpu, 0);
+        strm = stream(eng);
+        p = GetParam();
+    }
+
+    engine eng;
+    stream strm;
+    gather_params_t p;
+};
+
+namespace {
+
+bool is_int4(mdt dt) {
+    return dt == mdt::s4 || dt == mdt::u4;
+}
+
+// Fills the table with integer values representable in every table data type
+// so that the reference does not depend on rounding.
+std::vector<float> make_table_values(const gather_params_t &p) {
+    std::minstd_rand gen(7);
+    int lo = -8, hi = 7;
+    if (p.table_dt == mdt::u8 || p.table_dt == mdt::u4) lo = 0, hi = 15;
+    std::uniform_int_distribution<int> dist(lo, hi);
+    std::vector<float> values(p.rows * p.cols);
+    for (auto &v : values)
+        v = static_cast<float>(dist(gen));
+    return values;
+}
+
+memory make_table(
+        const gather_params_t &p, const std::vector<float> &values,
+        const engine &eng, stream &strm) {
+    memory::desc table_md({p.rows, p.cols}, p.table_dt, tag::ab);
+    memory table(table_md, eng);
+
+    if (is_int4(p.table_dt)) {
+        std::vector<uint8_t> packed(p.rows * p.cols / 2, 0);
+        for (size_t i = 0; i < values.size(); ++i) {
+            const uint8_t nibble = static_cast<uint8_t>(
+                    static_cast<int>(values[i]) & 0xf);
+            packed[i / 2] |= (i % 2) ? nibble << 4 : nibble;
+        }
+        std::memcpy(table.get_data_handle(), packed.data(), packed.size());
+        return table;
+    }
+
+    memory f32_table({{p.rows, p.cols}, mdt::f32, tag::ab}, eng);
+    write_to_dnnl_memory(values.data(), f32_table);
+    reorder(f32_table, table).execute(strm, f32_table, table);
+    strm.wait();
+    return table;
+}
+
+} // namespace
+
+CPU_TEST_P(gather_test_t, compare) {
+    const bool with_offsets = p.n_bags > 0;
+
+    // Bags of random sizes, including empty ones. A few indices are out of
+    // range and must be skipped by the primitive.
+    std::minstd_rand gen(13);
+    std::vector<int32_t> offsets;
+    std::vector<int32_t> indices;
+    std::uniform_int_distribution<int> bag_size_dist(0, p.max_bag_size);
+    std::uniform_int_distribution<int> row_dist(-1, (int)p.rows);
+    const memory::dim n_out = with_offsets ? p.n_bags : p.max_bag_size;
+    for (memory::dim b = 0; b < n_out; ++b) {
+        if (with_offsets) offsets.push_back((int32_t)indices.size());
+        const int bag_size = with_offsets ? bag_size_dist(gen) : 1;
+        for (int i = 0; i < bag_size; ++i)
+            indices.push_back(row_dist(gen));
+    }
+    if (indices.empty()) indices.push_back(0);
+    const memory::dim n_indices = (memory::dim)indices.size();
+
+    const auto table_values = make_table_values(p);
+    std::vector<float> scales(p.per_row_scales ? p.rows : 1);
+    std::uniform_int_distribution<int> scale_dist(1, 8);
+    for (auto &s : scales)
+        s = scale_dist(gen) / 4.f;
+    const int32_t zero_point = p.with_zero_point ? 2 : 0;
+
+    memory::desc indices_md({n_indices}, mdt::s32, tag::a);
+    memory::desc offsets_md({p.n_bags}, mdt::s32, tag::a);
+    memory::desc dst_md({n_out, p.cols}, p.dst_dt, tag::ab);
+    memory::desc table_md({p.rows, p.cols}, p.table_dt, tag::ab);
+
+    primitive_attr attr;
+    attr.set_scratchpad_mode(scratchpad_mode::user);
+    attr.set_scales(DNNL_ARG_SRC, p.per_row_scales ? 1 : 0, {}, mdt::f32);
+    if (p.with_zero_point) attr.set_zero_points_mask(DNNL_ARG_SRC, 0);
+
+    impl::gather::primitive_desc pd;
+    try {
+        pd = impl::gather::primitive_desc(eng, table_md, indices_md,
+                with_offsets ? &offsets_md : nullptr, dst_md, p.alg, attr);
+    } catch (const dnnl::error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Unimplemented: " << e.what();
+        throw;
+    }
+    impl::gather prim(pd);
+
+    auto table = make_table(p, table_values, eng, strm);
+    memory indices_mem(indices_md, eng);
+    write_to_dnnl_memory(indices.data(), indices_mem);
+    memory offsets_mem(offsets_md, eng);
+    if (with_offsets) write_to_dnnl_memory(offsets.data(), offsets_mem);
+    memory scales_mem({{(memory::dim)scales.size()}, mdt::f32, tag::a}, eng);
+    write_to_dnnl_memory(scales.data(), scales_mem);
+    memory zp_mem({{1}, mdt::s32, tag::a}, eng);
+    write_to_dnnl_memory(&zero_point, zp_mem);
+    memory dst(dst_md, eng);
+    memory scratchpad(pd.scratchpad_desc(), eng);
+
+    std::unordered_map<int, memory> args = {{DNNL_ARG_SRC_0, table},
+            {DNNL_ARG_SRC_1, indices_mem}, {DNNL_ARG_DST, dst},
+            {DNNL_ARG_SCRATCHPAD, scratchpad},
+            {DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, scales_mem}};
+    if (with_offsets) args.insert({DNNL_ARG_SRC_2, offsets_mem});
+    if (p.with_zero_point)
+        args.insert({DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_SRC, zp_mem});
+    prim.execute(strm, args);
+
+    memory f32_dst({{n_out, p.cols}, mdt::f32, tag::ab}, eng);
+    reorder(dst, f32_dst).execute(strm, dst, f32_dst);
+    strm.wait();
+
+    const float *got = static_cast<const float *>(f32_dst.get_data_handle());
+
+    const float eps = p.dst_dt == mdt::f32 ? 1e-6f : 1e-2f;
+    for (memory::dim b = 0; b < n_out; ++b) {
+        const memory::dim i_beg = with_offsets ? offsets[b] : b;
+        const memory::dim i_end = with_offsets
+                ? (b + 1 < n_out ? offsets[b + 1] : n_indices)
+                : b + 1;
+        const bool is_max = with_offsets && p.alg == algorithm::reduction_max;
+        std::vector<float> ref(p.cols, is_max ? -FLT_MAX : 0.f);
+        int n_valid = 0;
+        for (memory::dim i = i_beg; i < i_end; ++i) {
+            const int32_t r = indices[i];
+            if (r < 0 || r >= p.rows) continue;
+            n_valid++;
+            const float s = scales[p.per_row_scales ? r : 0];
+            for (memory::dim c = 0; c < p.cols; ++c) {
+                const float v = (table_values[r * p.cols + c] - zero_point) * s;
+                ref[c] = is_max ? std::max(ref[c], v) : ref[c] + v;
+            }
+        }
+        for (memory::dim c = 0; c < p.cols; ++c) {
+            float expected = n_valid == 0 ? 0.f : ref[c];
+            if (n_valid > 0 && with_offsets
+                    && p.alg == algorithm::reduction_mean)
+                expected /= n_valid;
+            const float actual = got[b * p.cols + c];
+            ASSERT_NEAR(expected, actual,
+                    eps * std::max(1.f, std::abs(expected)))
+                    << "bag " << b << " col " << c;
+        }
+    }
+}
+
+// Offsets out of [0, n_indices] are clamped and a bag whose offsets decrease
+// is empty, so malformed offsets never read outside of the indices.
+TEST(gather_offsets_test_t, MalformedOffsets) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "Gather primitive is implemented for CPU only.");
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    const memory::dim rows = 8, cols = 4;
+    const std::vector<int32_t> indices {0, 1, 2, 3, 4, 5};
+    const std::vector<int32_t> offsets {-3, 2, 1, 9, 4};
+    // Bags cover indices [0, 2), [2, 2), [1, 6), [6, 6) and [4, 6).
+    const std::vector<std::vector<int32_t>> bags {
+            {0, 1}, {}, {1, 2, 3, 4, 5}, {}, {4, 5}};
+    const memory::dim n_indices = (memory::dim)indices.size();
+    const memory::dim n_bags = (memory::dim)offsets.size();
+
+    std::vector<float> table_values(rows * cols);
+    for (size_t i = 0; i < table_values.size(); ++i)
+        table_values[i] = static_cast<float>(i);
+
+    memory::desc table_md({rows, cols}, mdt::f32, tag::ab);
+    memory::desc indices_md({n_indices}, mdt::s32, tag::a);
+    memory::desc offsets_md({n_bags}, mdt::s32, tag::a);
+    memory::desc dst_md({n_bags, cols}, mdt::f32, tag::ab);
+
+    impl::gather::primitive_desc pd;
+    try {
+        pd = impl::gather::primitive_desc(eng, table_md, indices_md,
+                &offsets_md, dst_md, algorithm::reduction_sum);
+    } catch (const dnnl::error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Unimplemented: " << e.what();
+        throw;
+    }
+    impl::gather prim(pd);
+
+    memory table(table_md, eng), indices_mem(indices_md, eng),
+            offsets_mem(offsets_md, eng), dst(dst_md, eng);
+    write_to_dnnl_memory(table_values.data(), table);
+    write_to_dnnl_memory(indices.data(), indices_mem);
+    write_to_dnnl_memory(offsets.data(), offsets_mem);
+    prim.execute(strm,
+            {{DNNL_ARG_SRC_0, table}, {DNNL_ARG_SRC_1, indices_mem},
+                    {DNNL_ARG_SRC_2, offsets_mem}, {DNNL_ARG_DST, dst}});
+    strm.wait();
+
+    const float *got = static_cast<const float *>(dst.get_data_handle());
+    for (memory::dim b = 0; b < n_bags; ++b) {
+        for (memory::dim c = 0; c < cols; ++c) {
+            float expected = 0.f;
+            for (int32_t r : bags[b])
+                expected += table_values[r * cols + c];
+            ASSERT_EQ(expected, got[b * cols + c])
+                    << "bag " << b << " col " << c;
+        }
+    }
+}
+
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(Gather,
+    gather_test_t,
+                              //  rows, cols, n_bags, max_bag,   table_dt,    dst_dt,                       alg, per_row_sc,    zp
+    testing::Values(
+                    gather_params_t{  100,   64,      0,      50,   mdt::f32,  mdt::f32,         algorithm::undef,      false, false },
+                    gather_params_t{  100,   64,      0,      50,  mdt::bf16, mdt::bf16,         algorithm::undef,      false, false },
+                    gather_params_t{  100,   64,      0,      50,    mdt::s8,  mdt::f32,         algorithm::undef,       true, false }
+    ), &print_to_string);
+
+INSTANTIATE_TEST_SUITE_P(EmbeddingBag,
+    gather_test_t,
+                              //  rows, cols, n_bags, max_bag,   table_dt,    dst_dt,                       alg, per_row_sc,    zp
+    testing::Values(
+                    gather_params_t{ 1000,  128,     32,      20,   mdt::f32,  mdt::f32, algorithm::reduction_sum,      false, false },
+                    gather_params_t{ 1000,  128,     32,      20,   mdt::f32,  mdt::f32, algorithm::reduction_mean,     false, false },
+                    gather_params_t{ 1000,  128,     32,      20,   mdt::f32,  mdt::f32, algorithm::reduction_max,      false, false },
+                    gather_params_t{ 1000,   33,     17,       7,   mdt::f32,  mdt::f32, algorithm::reduction_sum,      false, false },
+                    gather_params_t{ 1000,  128,     32,      20,  mdt::bf16, mdt::bf16, algorithm::reduction_sum,      false, false },
+                    gather_params_t{ 1000,  128,     32,      20,   mdt::f16,  mdt::f32, algorithm::reduction_mean,     false, false },
+                    gather_params_t{ 1000,  128,     32,      20,    mdt::s8,  mdt::f32, algorithm::reduction_sum,       true, false },
+                    gather_params_t{ 1000,  128,     32,      20,    mdt::u8, mdt::bf16, algorithm::reduction_mean,      true,  true },
+                    gather_params_t{ 1000,  128,     32,      20,    mdt::s4,  mdt::f32, algorithm::reduction_sum,       true, false },
+                    gather_params_t{ 1000,  128,     32,      20,    mdt::u4,  mdt::f32, algorithm::reduction_max,       true,  true }
+    ), &print_to_string);
+// clang-format on
+
+} // namespace dnnl
@@ -0,0 +1,223 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <dnnl_test_common.hpp>
+#include <gtest/gtest.h>
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace dnnl {
+
+// Normalization statistics of data with a large offset and a small spread.
+// Computing the variance from plain sums of values and of their squares
+// loses all significant digits on such data, so this checks that the
+// statistics of every implementation (including the single pass ones used for
+// shapes that do not fit caches) stay close to a two-pass reference computed
+// in double precision.
+class norm_stats_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "Test is implemented for CPU only.");
+        eng = engine(engine::kind::cpu, 0);
+        strm = stream(eng);
+    }
+
+    // Fills `src` with `offset(c) + noise`, with the channel index computed
+    // by `channel` from the physical offset.
+    template <typename F>
+    memory make_src(const memory::desc &md, F channel) {
+        memory m(md, eng);
+        auto *ptr = static_cast<float *>(m.get_data_handle());
+        const size_t n = md.get_size() / sizeof(float);
+        std::minstd_rand gen(7);
+        std::uniform_real_distribution<float> noise(-1.f, 1.f);
+        for (size_t i = 0; i < n; i++)
+            ptr[i] = 1000.f + 16.f * channel(i) + noise(gen);
+        return m;
+    }
+
+    struct ref_stats_t {
+        void add(double v) { vals.push_back(v); }
+        double mean() const {
+            double s = 0;
+            for (double v : vals)
+                s += v;
+            return s / vals.size();
+        }
+        double var() const {
+            const double m = mean();
+            double s = 0;
+            for (double v : vals)
+                s += (v - m) * (v - m);
+            return s / vals.size();
+        }
+        std::vector<double> vals;
+    };
+
+    void check_stats(const memory &mean, const memory &var,
+            const std::vector<ref_stats_t> &ref) {
+        const auto *mean_ptr
+                = static_cast<const float *>(mean.get_data_handle());
+        const auto *var_ptr = static_cast<const float *>(var.get_data_handle());
+        for (size_t i = 0; i < ref.size(); i++) {
+            const double ref_mean = ref[i].mean();
+            const double ref_var = ref[i].var();
+            ASSERT_NEAR(mean_ptr[i], ref_mean, 1e-5 * std::fabs(ref_mean))
+                    << "mean of #" << i;
+            ASSERT_NEAR(var_ptr[i], ref_var, 1e-3 * ref_var)
+                    << "variance of #" << i;
+        }
+    }
+
+    static void set_env(const char *name, const char *value) {
+#ifdef _WIN32
+        EXPECT_EQ(_putenv_s(name, value), 0);
+#else
+        EXPECT_EQ(::setenv(name, value, 1), 0);
+#endif
+    }
+
+    static void unset_env(const char *name) {
+#ifdef _WIN32
+        _putenv((std::string(name) + "=").c_str());
+#else
+        ::unsetenv(name);
+#endif
+    }
+
+    engine eng;
+    stream strm;
+};
+
+TEST_F(norm_stats_test_t, LayerNormalizationLongRows) {
+    const memory::dim T = 4, C = 16384;
+    const memory::desc src_md({T, C}, memory::data_type::f32,
+            memory::format_tag::ab);
+    auto pd = layer_normalization_forward::primitive_desc(eng,
+            prop_kind::forward_training, src_md, src_md, 1e-5f,
+            normalization_flags::none);
+
+    // Offsets vary along the normalized axis here.
+    auto src = make_src(src_md, [&](size_t i) { return (i % C) % 4; });
+    memory dst(pd.dst_desc(), eng);
+    memory mean(pd.mean_desc(), eng);
+    memory var(pd.variance_desc(), eng);
+
+    layer_normalization_forward(pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}, {DNNL_ARG_MEAN, mean},
+                    {DNNL_ARG_VARIANCE, var}});
+    strm.wait();
+
+    const auto *src_ptr = static_cast<const float *>(src.get_data_handle());
+    std::vector<ref_stats_t> ref(T);
+    for (memory::dim t = 0; t < T; t++)
+        for (memory::dim c = 0; c < C; c++)
+            ref[t].add(src_ptr[t * C + c]);
+    check_stats(mean, var, ref);
+}
+
+TEST_F(norm_stats_test_t, GroupNormalizationLargeSpatial) {
+    const memory::dim N = 2, C = 64, H = 64, W = 64;
+    for (memory::dim G : {2, 8}) {
+        const memory::desc src_md({N, C, H, W}, memory::data_type::f32,
+                memory::format_tag::nhwc);
+        auto pd = group_normalization_forward::primitive_desc(eng,
+                prop_kind::forward_training, src_md, src_md, G, 1e-5f,
+                normalization_flags::none);
+
+        auto src = make_src(src_md, [&](size_t i) { return i % C; });
+        memory dst(pd.dst_desc(), eng);
+        memory mean(pd.mean_desc(), eng);
+        memory var(pd.variance_desc(), eng);
+
+        group_normalization_forward(pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst},
+                        {DNNL_ARG_MEAN, mean}, {DNNL_ARG_VARIANCE, var}});
+        strm.wait();
+
+        const auto *src_ptr
+                = static_cast<const float *>(src.get_data_handle());
+        std::vector<ref_stats_t> ref(N * G);
+        for_(memory::dim n = 0; n < N; n++)
+        for_(memory::dim sp = 0; sp < H * W; sp++)
+        for (memory::dim c = 0; c < C; c++)
+            ref[n * G + c / (C / G)].add(src_ptr[(n * H * W + sp) * C + c]);
+        check_stats(mean, var, ref);
+    }
+}
+
+// The single pass statistics of the batch normalization are only used for
+// data that does not fit L2 of all threads, which tests cannot afford on
+// large machines, so they are forced with the internal
+// `_ONEDNN_BNORM_STATS_ONE_PASS` env var. Blocked layouts cover the per
+// channel block kernel and nhwc the nspc one.
+TEST_F(norm_stats_test_t, BatchNormalizationLargeTensor) {
+    // The env var is read at the primitive creation, which the primitive
+    // cache could skip.
+    const int cache_capacity = get_primitive_cache_capacity();
+    set_primitive_cache_capacity(0);
+    set_env("_ONEDNN_BNORM_STATS_ONE_PASS", "1");
+
+    using tag = memory::format_tag;
+    const memory::dim N = 4, C = 32, H = 64, W = 64;
+    for (auto t : {tag::nchw, tag::nhwc, tag::nChw8c, tag::nChw16c}) {
+        const memory::desc src_md({N, C, H, W}, memory::data_type::f32, t);
+        auto pd = batch_normalization_forward::primitive_desc(eng,
+                prop_kind::forward_training, src_md, src_md, 1e-5f,
+                normalization_flags::none);
+
+        const memory::dim blk
+                = t == tag::nChw8c ? 8 : t == tag::nChw16c ? 16 : 1;
+        // Physical offset of the point `sp` of the channel `c` of image `n`
+        auto offset = [&](memory::dim n, memory::dim c, memory::dim sp) {
+            if (t == tag::nhwc) return (n * H * W + sp) * C + c;
+            return ((n * (C / blk) + c / blk) * H * W + sp) * blk + c % blk;
+        };
+        auto src = make_src(src_md, [&](size_t i) {
+            if (t == tag::nhwc) return i % C;
+            return (i / (H * W * blk)) % (C / blk) * blk + i % blk;
+        });
+        memory dst(pd.dst_desc(), eng);
+        memory mean(pd.mean_desc(), eng);
+        memory var(pd.variance_desc(), eng);
+
+        batch_normalization_forward(pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst},
+                        {DNNL_ARG_MEAN, mean}, {DNNL_ARG_VARIANCE, var}});
+        strm.wait();
+
+        const auto *src_ptr
+                = static_cast<const float *>(src.get_data_handle());
+        std::vector<ref_stats_t> ref(C);
+        for_(memory::dim n = 0; n < N; n++)
+        for_(memory::dim c = 0; c < C; c++)
+        for (memory::dim sp = 0; sp < H * W; sp++)
+            ref[c].add(src_ptr[offset(n, c, sp)]);
+        check_stats(mean, var, ref);
+    }
+
+    unset_env("_ONEDNN_BNORM_STATS_ONE_PASS");
+    set_primitive_cache_capacity(cache_capacity);
+}
+
+} // namespace dnnl
@@ -0,0 +1,217 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "stdlib.h"
+
+#include <dnnl_test_common.hpp>
+#include <gtest/gtest.h>
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+void custom_setenv(const char *name, const char *value, int overwrite) {
+#ifdef _WIN32
+    auto status = SetEnvironmentVariable(name, value);
+    EXPECT_NE(status, 0);
+#else
+    auto status = ::setenv(name, value, overwrite);
+    EXPECT_EQ(status, 0);
+#endif
+}
+
+} // namespace
+
+namespace dnnl {
+
+// Executes the grid of cells of multi-layer RNNs as a wavefront, forced with
+// the internal `_ONEDNN_RNN_WAVEFRONT` env var, and compares the results with
+// a chain of single-layer RNNs, which are never executed as a wavefront.
+//
+// The env var is read once per process, so the test is a separate binary.
+class rnn_wavefront_test_t
+    : public ::testing::TestWithParam<std::tuple<algorithm, rnn_direction>> {
+protected:
+    void SetUp() override {
+        custom_setenv("_ONEDNN_RNN_WAVEFRONT", "1", 1);
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "Test is implemented for CPU only.");
+        eng = engine(engine::kind::cpu, 0);
+        strm = make_stream(eng);
+
+        std::tie(cell, dir) = GetParam();
+        is_lstm = cell == algorithm::vanilla_lstm;
+        D = dir == rnn_direction::bidirectional_sum ? 2 : 1;
+        G = is_lstm ? 4 : 3;
+
+        src_layer = make_data(T * N * C);
+        src_iter = make_data(L * D * N * C);
+        src_iter_c = make_data(L * D * N * C);
+        weights = make_data(L * D * C * G * C);
+        bias = make_data(L * D * G * C);
+    }
+
+    static std::vector<float> make_data(memory::dim n) {
+        std::vector<float> v(n);
+        for (memory::dim i = 0; i < n; i++)
+            v[i] = 0.05f * static_cast<float>(static_cast<int>(i % 13) - 6);
+        return v;
+    }
+
+    memory make_memory(const memory::desc &md, const float *data) {
+        memory m(md, eng);
+        std::copy(data, data + md.get_size() / sizeof(float),
+                static_cast<float *>(m.get_data_handle()));
+        return m;
+    }
+
+    static std::vector<float> read(const memory &m) {
+        const auto *ptr = static_cast<const float *>(m.get_data_handle());
+        return std::vector<float>(
+                ptr, ptr + m.get_desc().get_size() / sizeof(float));
+    }
+
+    struct result_t {
+        std::vector<float> dst_layer, dst_iter, dst_iter_c;
+    };
+
+    // Executes nl layers of the RNN, taking the data of the layers from
+    // the given pointers.
+    result_t run(memory::dim nl, const float *src_layer_ptr,
+            const float *src_iter_ptr, const float *src_iter_c_ptr,
+            const float *weights_ptr, const float *bias_ptr) {
+        using tag = memory::format_tag;
+        const auto dt = memory::data_type::f32;
+        memory::desc layer_md({T, N, C}, dt, tag::tnc);
+        memory::desc iter_md({nl, D, N, C}, dt, tag::ldnc);
+        memory::desc weights_md({nl, D, C, G, C}, dt, tag::ldigo);
+        memory::desc weights_any_md({nl, D, C, G, C}, dt, tag::any);
+        memory::desc bias_md({nl, D, G, C}, dt, tag::ldgo);
+        const auto pk = prop_kind::forward_inference;
+
+        primitive rnn;
+        memory::desc weights_layer_md, weights_iter_md;
+        if (is_lstm) {
+            lstm_forward::primitive_desc pd(eng, pk, dir, layer_md, iter_md,
+                    iter_md, weights_any_md, weights_any_md, bias_md, layer_md,
+                    iter_md, iter_md);
+            rnn = lstm_forward(pd);
+            weights_layer_md = pd.weights_layer_desc();
+            weights_iter_md = pd.weights_iter_desc();
+        } else {
+            gru_forward::primitive_desc pd(eng, pk, dir, layer_md, iter_md,
+                    weights_any_md, weights_any_md, bias_md, layer_md,
+                    iter_md);
+            rnn = gru_forward(pd);
+            weights_layer_md = pd.weights_layer_desc();
+            weights_iter_md = pd.weights_iter_desc();
+        }
+
+        auto user_weights = make_memory(weights_md, weights_ptr);
+        memory weights_layer(weights_layer_md, eng);
+        memory weights_iter(weights_iter_md, eng);
+        reorder(user_weights, weights_layer)
+                .execute(strm, user_weights, weights_layer);
+        reorder(user_weights, weights_iter)
+                .execute(strm, user_weights, weights_iter);
+
+        memory dst_layer(layer_md, eng), dst_iter(iter_md, eng),
+                dst_iter_c(iter_md, eng);
+        std::unordered_map<int, memory> args {
+                {DNNL_ARG_SRC_LAYER, make_memory(layer_md, src_layer_ptr)},
+                {DNNL_ARG_SRC_ITER, make_memory(iter_md, src_iter_ptr)},
+                {DNNL_ARG_WEIGHTS_LAYER, weights_layer},
+                {DNNL_ARG_WEIGHTS_ITER, weights_iter},
+                {DNNL_ARG_BIAS, make_memory(bias_md, bias_ptr)},
+                {DNNL_ARG_DST_LAYER, dst_layer},
+                {DNNL_ARG_DST_ITER, dst_iter}};
+        if (is_lstm) {
+            args.insert({DNNL_ARG_SRC_ITER_C,
+                    make_memory(iter_md, src_iter_c_ptr)});
+            args.insert({DNNL_ARG_DST_ITER_C, dst_iter_c});
+        }
+        rnn.execute(strm, args);
+        strm.wait();
+
+        result_t res {read(dst_layer), read(dst_iter), {}};
+        if (is_lstm) res.dst_iter_c = read(dst_iter_c);
+        return res;
+    }
+
+    static void compare(
+            const std::vector<float> &res, const std::vector<float> &ref) {
+        ASSERT_EQ(ref.size(), res.size());
+        for (size_t i = 0; i < ref.size(); i++) {
+            ASSERT_TRUE(std::isfinite(res[i])) << "index " << i;
+            ASSERT_NEAR(res[i], ref[i], 1e-5f * (1.f + std::fabs(ref[i])))
+                    << "index " << i;
+        }
+    }
+
+    const memory::dim T = 5, N = 2, C = 8, L = 3;
+    memory::dim D = 1, G = 1;
+    algorithm cell = algorithm::undef;
+    rnn_direction dir = rnn_direction::undef;
+    bool is_lstm = false;
+
+    engine eng;
+    stream strm;
+    std::vector<float> src_layer, src_iter, src_iter_c, weights, bias;
+};
+
+TEST_P(rnn_wavefront_test_t, MatchesLayerByLayer) {
+    const auto res = run(L, src_layer.data(), src_iter.data(),
+            src_iter_c.data(), weights.data(), bias.data());
+
+    // Tensors of the layers are contiguous slices of the multi-layer ones
+    result_t ref {src_layer, {}, {}};
+    const memory::dim iter_size = D * N * C;
+    for (memory::dim l = 0; l < L; l++) {
+        const auto layer = run(1, ref.dst_layer.data(),
+                src_iter.data() + l * iter_size,
+                src_iter_c.data() + l * iter_size,
+                weights.data() + l * D * C * G * C,
+                bias.data() + l * D * G * C);
+        ref.dst_layer = layer.dst_layer;
+        ref.dst_iter.insert(ref.dst_iter.end(), layer.dst_iter.begin(),
+                layer.dst_iter.end());
+        ref.dst_iter_c.insert(ref.dst_iter_c.end(), layer.dst_iter_c.begin(),
+                layer.dst_iter_c.end());
+    }
+
+    compare(res.dst_layer, ref.dst_layer);
+    compare(res.dst_iter, ref.dst_iter);
+    compare(res.dst_iter_c, ref.dst_iter_c);
+}
+
+INSTANTIATE_TEST_SUITE_P(Cells, rnn_wavefront_test_t,
+        ::testing::Combine(::testing::Values(algorithm::vanilla_lstm,
+                                   algorithm::vanilla_gru),
+                ::testing::Values(rnn_direction::unidirectional_left2right,
+                        rnn_direction::bidirectional_sum)));
+
+} // namespace dnnl
@@ -0,0 +1,160 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <dnnl_test_common.hpp>
+#include <gtest/gtest.h>
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace dnnl {
+
+using mdt = memory::data_type;
+using tag = memory::format_tag;
+
+struct softmax_int8_params_t {
+    mdt src_dt;
+    mdt dst_dt;
+    memory::dim axis_size;
+    float src_scale;
+};
+
+std::ostream &operator<<(std::ostream &ss, const softmax_int8_params_t &p) {
+    ss << dnnl_dt2str(memory::convert_to_c(p.src_dt)) << "_"
+       << dnnl_dt2str(memory::convert_to_c(p.dst_dt)) << "_axis_"
+       << p.axis_size;
+    return ss;
+}
+
+std::string print_to_string(
+        const ::testing::TestParamInfo<softmax_int8_params_t> &info) {
+    std::stringstream ss;
+    ss << info.param;
+    return ss.str();
+}
+
+// Softmax of s8 and u8 sources, whose exponent is looked up in tables by the
+// AVX-512 kernels, compared with a reference computed in double precision.
+// Values span the whole range of the source data type so that every entry of
+// the tables is used.
+class softmax_int8_test_t
+    : public ::testing::TestWithParam<softmax_int8_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "Test is implemented for CPU only.");
+        eng = engine(engine::kind::cpu, 0);
+        strm = stream(eng);
+        p = GetParam();
+    }
+
+    engine eng;
+    stream strm;
+    softmax_int8_params_t p;
+};
+
+TEST_P(softmax_int8_test_t, MatchesReference) {
+    const memory::dim N = 6, C = p.axis_size;
+    const bool is_signed = p.src_dt == mdt::s8;
+
+    // The last row is constant, all the others span the whole range.
+    std::minstd_rand gen(5);
+    std::uniform_int_distribution<int> dist(
+            is_signed ? -128 : 0, is_signed ? 127 : 255);
+    std::vector<int> values(N * C);
+    for (auto &v : values)
+        v = dist(gen);
+    for (memory::dim n = 0; n < N - 1; n++) {
+        values[n * C] = is_signed ? -128 : 0;
+        values[n * C + C - 1] = is_signed ? 127 : 255;
+    }
+    std::fill(values.end() - C, values.end(), is_signed ? -3 : 3);
+
+    memory::desc src_md({N, C}, p.src_dt, tag::nc);
+    memory::desc dst_md({N, C}, p.dst_dt, tag::nc);
+    primitive_attr attr;
+    attr.set_scales_mask(DNNL_ARG_SRC, 0);
+    auto pd = softmax_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::softmax_accurate, src_md,
+            dst_md, 1, attr);
+
+    memory src(src_md, eng);
+    if (is_signed) {
+        auto *ptr = static_cast<int8_t *>(src.get_data_handle());
+        for (size_t i = 0; i < values.size(); i++)
+            ptr[i] = static_cast<int8_t>(values[i]);
+    } else {
+        auto *ptr = static_cast<uint8_t *>(src.get_data_handle());
+        for (size_t i = 0; i < values.size(); i++)
+            ptr[i] = static_cast<uint8_t>(values[i]);
+    }
+    memory scale({{1}, mdt::f32, tag::x}, eng);
+    *static_cast<float *>(scale.get_data_handle()) = p.src_scale;
+    memory dst(dst_md, eng);
+
+    softmax_forward(pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst},
+                    {DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, scale}});
+    strm.wait();
+
+    for (memory::dim n = 0; n < N; n++) {
+        const auto row = values.begin() + n * C;
+        const int max = *std::max_element(row, row + C);
+        double sum = 0;
+        for (memory::dim c = 0; c < C; c++)
+            sum += std::exp(static_cast<double>(row[c] - max));
+        for (memory::dim c = 0; c < C; c++) {
+            const double ref = p.src_scale
+                    * std::exp(static_cast<double>(row[c] - max)) / sum;
+            const memory::dim off = n * C + c;
+            const void *dst_ptr = dst.get_data_handle();
+            if (p.dst_dt == mdt::f32) {
+                const float got = static_cast<const float *>(dst_ptr)[off];
+                ASSERT_NEAR(got, ref, 1e-5 * ref + 1e-7)
+                        << "row " << n << " col " << c;
+            } else {
+                // Rounding may differ for values close to a half.
+                const int got = p.dst_dt == mdt::s8
+                        ? static_cast<const int8_t *>(dst_ptr)[off]
+                        : static_cast<const uint8_t *>(dst_ptr)[off];
+                ASSERT_NEAR(got, ref, 1.) << "row " << n << " col " << c;
+            }
+        }
+    }
+}
+
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(Softmax,
+    softmax_int8_test_t,
+                                   //  src_dt,   dst_dt, axis_size, src_scale
+    testing::Values(
+                    softmax_int8_params_t{ mdt::s8, mdt::f32,         7,      1.f },
+                    softmax_int8_params_t{ mdt::s8, mdt::f32,        16,      1.f },
+                    softmax_int8_params_t{ mdt::s8, mdt::f32,      1000,      1.f },
+                    softmax_int8_params_t{ mdt::u8, mdt::f32,         7,      1.f },
+                    softmax_int8_params_t{ mdt::u8, mdt::f32,        16,      1.f },
+                    softmax_int8_params_t{ mdt::u8, mdt::f32,      1000,      1.f },
+                    softmax_int8_params_t{ mdt::s8,  mdt::u8,       100,    255.f },
+                    softmax_int8_params_t{ mdt::u8,  mdt::u8,       100,    255.f },
+                    softmax_int8_params_t{ mdt::u8,  mdt::s8,      1000,    127.f }
+    ), &print_to_string);
+// clang-format on
+
+} // namespace dnnl
@@ -0,0 +1,227 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <dnnl_test_common.hpp>
+#include <gtest/gtest.h>
+
+#include "test_utils.hpp"
+#include "topk_internal.hpp"
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+
+namespace dnnl {
+
+using mdt = memory::data_type;
+
+struct topk_params_t {
+    memory::dims dims;
+    int axis;
+    memory::dim k;
+    algorithm alg;
+    mdt dt;
+    bool with_softmax;
+    float scale;
+    // Fill with few distinct values to check that ties go to the lower
+    // position.
+    bool with_ties;
+    // Replace some values with NaN, which is greater than any number.
+    bool with_nans;
+};
+
+std::ostream &operator<<(std::ostream &ss, const topk_params_t &p) {
+    ss << "dims";
+    for (auto d : p.dims)
+        ss << "_" << d;
+    ss << "_axis_" << p.axis << "_k_" << p.k << "_"
+       << dnnl_alg_kind2str(dnnl::convert_to_c(p.alg)) << "_"
+       << dnnl_dt2str(memory::convert_to_c(p.dt));
+    if (p.with_softmax) ss << "_softmax";
+    if (p.scale != 1.f) ss << "_scaled";
+    if (p.with_ties) ss << "_ties";
+    if (p.with_nans) ss << "_nans";
+    return ss;
+}
+
+std::string print_to_string(
+        const ::testing::TestParamInfo<topk_params_t> &info) {
+    std::stringstream ss;
+    ss << info.param;
+    return ss.str();
+}
+
+class topk_test_t : public ::testing::TestWithParam<topk_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "Top-k primitive is implemented for CPU only.");
+        eng = engine(engine::kind::cpu, 0);
+        strm = stream(eng);
+        p = GetParam();
+    }
+
+    engine eng;
+    stream strm;
+    topk_params_t p;
+};
+
+CPU_TEST_P(topk_test_t, compare) {
+    const int ndims = (int)p.dims.size();
+    memory::dims dst_dims = p.dims;
+    dst_dims[p.axis] = p.k;
+    const memory::dim n = p.dims[p.axis];
+    memory::dim outer = 1, inner = 1;
+    for (int d = 0; d < p.axis; d++)
+        outer *= p.dims[d];
+    for (int d = p.axis + 1; d < ndims; d++)
+        inner *= p.dims[d];
+
+    // Small integers are exact in every data type, and a random permutation
+    // of them along the axis makes the expected order unique.
+    std::minstd_rand gen(11);
+    std::vector<float> src(outer * n * inner);
+    std::vector<int> perm(n);
+    for (memory::dim ou = 0; ou < outer; ++ou)
+        for (memory::dim in = 0; in < inner; ++in) {
+            std::iota(perm.begin(), perm.end(), -(int)n / 2);
+            std::shuffle(perm.begin(), perm.end(), gen);
+            for (memory::dim j = 0; j < n; ++j)
+                src[(ou * n + j) * inner + in]
+                        = (float)(p.with_ties ? perm[j] % 7 : perm[j]);
+            if (p.with_nans)
+                for (memory::dim j = 4; j < n; j += 9)
+                    src[(ou * n + j) * inner + in] = NAN;
+        }
+
+    auto tag = memory::format_tag::undef;
+    switch (ndims) {
+        case 1: tag = memory::format_tag::a; break;
+        case 2: tag = memory::format_tag::ab; break;
+        case 3: tag = memory::format_tag::abc; break;
+        default: tag = memory::format_tag::abcd; break;
+    }
+    memory::desc src_md(p.dims, p.dt, tag);
+    memory::desc dst_md(dst_dims, p.dt, tag);
+    memory::desc idx_md(dst_dims, mdt::s32, tag);
+
+    primitive_attr attr;
+    if (p.scale != 1.f) attr.set_scales_mask(DNNL_ARG_SRC, 0);
+
+    impl::topk::primitive_desc pd;
+    try {
+        pd = impl::topk::primitive_desc(eng, p.alg, src_md, dst_md, idx_md,
+                p.axis, p.k, p.with_softmax, attr);
+    } catch (const dnnl::error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Unimplemented: " << e.what();
+        throw;
+    }
+    impl::topk prim(pd);
+
+    memory f32_src({p.dims, mdt::f32, tag}, eng);
+    write_to_dnnl_memory(src.data(), f32_src);
+    memory src_mem(src_md, eng);
+    reorder(f32_src, src_mem).execute(strm, f32_src, src_mem);
+    memory dst_mem(dst_md, eng);
+    memory idx_mem(idx_md, eng);
+    memory scale_mem({{1}, mdt::f32, memory::format_tag::a}, eng);
+    write_to_dnnl_memory(&p.scale, scale_mem);
+
+    prim.execute(strm,
+            {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_DST, dst_mem},
+                    {DNNL_ARG_DST_1, idx_mem},
+                    {DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, scale_mem}});
+
+    memory f32_dst({dst_dims, mdt::f32, tag}, eng);
+    reorder(dst_mem, f32_dst).execute(strm, dst_mem, f32_dst);
+    strm.wait();
+
+    const float *got_v = static_cast<const float *>(f32_dst.get_data_handle());
+    const int32_t *got_i
+            = static_cast<const int32_t *>(idx_mem.get_data_handle());
+
+    const bool is_max = p.alg == algorithm::reduction_max;
+    // NaN is greater than any number.
+    auto greater = [](float a, float b) {
+        return a > b || (std::isnan(a) && !std::isnan(b));
+    };
+    const float eps = p.dt == mdt::f32 ? 1e-6f : 1e-2f;
+    std::vector<int> order(n);
+    for (memory::dim ou = 0; ou < outer; ++ou)
+        for (memory::dim in = 0; in < inner; ++in) {
+            auto val = [&](int j) { return src[(ou * n + j) * inner + in]; };
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+                return is_max ? greater(val(a), val(b))
+                              : greater(val(b), val(a));
+            });
+
+            float sum = 0.f;
+            for (memory::dim j = 0; j < p.k; ++j)
+                sum += std::exp(p.scale * (val(order[j]) - val(order[0])));
+
+            for (memory::dim j = 0; j < p.k; ++j) {
+                const memory::dim off = (ou * p.k + j) * inner + in;
+                ASSERT_EQ(order[j], got_i[off])
+                        << "outer " << ou << " inner " << in << " pos " << j;
+                const float expected = p.with_softmax
+                        ? std::exp(p.scale * (val(order[j]) - val(order[0])))
+                                / sum
+                        : p.scale * val(order[j]);
+                if (std::isnan(expected)) {
+                    ASSERT_TRUE(std::isnan(got_v[off]))
+                            << "outer " << ou << " inner " << in << " pos "
+                            << j;
+                    continue;
+                }
+                ASSERT_NEAR(expected, got_v[off],
+                        eps * std::max(1.f, std::abs(expected)))
+                        << "outer " << ou << " inner " << in << " pos " << j;
+            }
+        }
+}
+
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(TopK,
+    topk_test_t,
+                            //         dims, axis,   k,                      alg,        dt, softmax, scale,  ties,  nans
+    testing::Values(
+                    topk_params_t{   {4, 100},    1,   1, algorithm::reduction_max,  mdt::f32,   false,   1.f, false, false },
+                    topk_params_t{   {4, 100},    1,   5, algorithm::reduction_max,  mdt::f32,   false,   1.f, false, false },
+                    topk_params_t{   {4, 100},    1,   5, algorithm::reduction_min,  mdt::f32,   false,   1.f, false, false },
+                    topk_params_t{   {4, 100},    1,  64, algorithm::reduction_max,  mdt::f32,   false,   1.f, false, false },
+                    topk_params_t{   {4, 100},    1, 100, algorithm::reduction_min,  mdt::f32,   false,   1.f, false, false },
+                    topk_params_t{   {4, 100},    1,   8, algorithm::reduction_max,  mdt::f32,   false,   1.f,  true, false },
+                    topk_params_t{   {4, 100},    1,  40, algorithm::reduction_min,  mdt::f32,   false,   1.f,  true, false },
+                    topk_params_t{ {3, 50, 7},    1,   4, algorithm::reduction_max,  mdt::f32,   false,   1.f, false, false },
+                    topk_params_t{ {30, 5, 7},    0,   3, algorithm::reduction_min,  mdt::f32,   false,   1.f, false, false },
+                    topk_params_t{  {2, 200},     1,  10, algorithm::reduction_max, mdt::bf16,   false,   1.f, false, false },
+                    topk_params_t{ {2, 1000},     1,  10, algorithm::reduction_max,  mdt::f16,   false,   1.f, false, false },
+                    topk_params_t{ {8, 1000},     1,  20, algorithm::reduction_max,  mdt::f32,    true,  0.5f, false, false },
+                    topk_params_t{ {8, 1000},     1, 200, algorithm::reduction_max,  mdt::f32,    true,   2.f, false, false },
+                    topk_params_t{   {4, 100},    1,   5, algorithm::reduction_max,  mdt::f32,   false,   1.f, false,  true },
+                    topk_params_t{   {4, 100},    1,   5, algorithm::reduction_min,  mdt::f32,   false,   1.f, false,  true },
+                    topk_params_t{   {4, 100},    1,  64, algorithm::reduction_max,  mdt::f32,   false,   1.f, false,  true },
+                    topk_params_t{   {4, 100},    1, 100, algorithm::reduction_min,  mdt::f32,   false,   1.f, false,  true },
+                    topk_params_t{ {3, 50, 7},    1,   4, algorithm::reduction_min,  mdt::f32,   false,   1.f,  true,  true }
+    ), &print_to_string);
+// clang-format on
+
+} // namespace dnnl
@@ -14,9 +14,13 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <numeric>
+#include <random>
 #include <utility>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
@@ -912,4 +916,208 @@ CPU_INSTANTIATE_TEST_SUITE_P(TestAUGRUlbr, lbr_augru_forward_test_f32,
                                 fmt::undef},
                         test_rnn_sizes_t {1, 1, 5, 1, 4, 4, 4, 4}}));
 
+// Per-sample sequence lengths: every sample of a run with sequence lengths
+// must match a separate run over its valid time steps only. Time steps past
+// the length of a sample produce zeros and the output states are the states
+// of its last valid time step.
+class rnn_seq_lengths_test_t : public ::testing::Test {
+protected:
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    static constexpr memory::dim L = 2, C = 8;
+
+    struct result_t {
+        std::vector<float> dst_layer, dst_iter, dst_iter_c;
+    };
+
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Sequence lengths are supported on CPU only.");
+        eng = get_test_engine();
+        strm = make_stream(eng);
+    }
+
+    static std::vector<float> random_data(size_t n, unsigned seed) {
+        std::minstd_rand gen(seed);
+        std::uniform_real_distribution<float> dist(-1.f, 1.f);
+        std::vector<float> v(n);
+        for (auto &e : v)
+            e = dist(gen);
+        return v;
+    }
+
+    memory make_mem(const memory::desc &md, const std::vector<float> &v) {
+        memory m(md, eng);
+        auto *ptr = static_cast<float *>(m.get_data_handle());
+        std::copy(v.begin(), v.end(), ptr);
+        return m;
+    }
+
+    // Weights are passed in the layout preferred by the implementation.
+    memory make_weights(const memory::desc &md, const memory::dims &dims,
+            tag user_tag, unsigned seed) {
+        const memory::desc user_md(dims, dt::f32, user_tag);
+        auto user = make_mem(
+                user_md, random_data(user_md.get_size() / sizeof(float), seed));
+        if (md == user_md) return user;
+        memory m(md, eng);
+        reorder(user, m).execute(strm, user, m);
+        return m;
+    }
+
+    static std::vector<float> to_vector(const memory &m) {
+        const auto *ptr = static_cast<const float *>(m.get_data_handle());
+        return std::vector<float>(
+                ptr, ptr + m.get_desc().get_size() / sizeof(float));
+    }
+
+    result_t run(bool is_lstm, rnn_direction dir, memory::dim T,
+            memory::dim MB, const std::vector<float> &src_layer,
+            const std::vector<float> &src_iter,
+            const std::vector<float> &src_iter_c,
+            const std::vector<int32_t> *seq_lengths) {
+        const memory::dim D
+                = dir == rnn_direction::bidirectional_concat ? 2 : 1;
+        const memory::dim G = is_lstm ? 4 : 3;
+        const memory::desc src_layer_md({T, MB, C}, dt::f32, tag::tnc);
+        const memory::desc states_md({L, D, MB, C}, dt::f32, tag::ldnc);
+        const memory::desc wei_md({L, D, C, G, C}, dt::f32, tag::any);
+        const memory::desc bias_md({L, D, G, C}, dt::f32, tag::ldgo);
+        const memory::desc dst_layer_md({T, MB, D * C}, dt::f32, tag::tnc);
+        const auto flags = seq_lengths ? rnn_flags::seq_lengths
+                                       : rnn_flags::undef;
+
+        rnn_primitive_desc_base pd;
+        primitive prim;
+        if (is_lstm) {
+            lstm_forward::primitive_desc lstm_pd(eng,
+                    prop_kind::forward_inference, dir, src_layer_md, states_md,
+                    states_md, wei_md, wei_md, bias_md, dst_layer_md,
+                    states_md, states_md, flags);
+            pd = lstm_pd;
+            prim = lstm_forward(lstm_pd);
+        } else {
+            gru_forward::primitive_desc gru_pd(eng,
+                    prop_kind::forward_inference, dir, src_layer_md, states_md,
+                    wei_md, wei_md, bias_md, dst_layer_md, states_md, flags);
+            pd = gru_pd;
+            prim = gru_forward(gru_pd);
+        }
+
+        std::unordered_map<int, memory> args;
+        args[DNNL_ARG_SRC_LAYER] = make_mem(src_layer_md, src_layer);
+        args[DNNL_ARG_SRC_ITER] = make_mem(states_md, src_iter);
+        args[DNNL_ARG_WEIGHTS_LAYER] = make_weights(
+                pd.weights_layer_desc(), {L, D, C, G, C}, tag::ldigo, 1);
+        args[DNNL_ARG_WEIGHTS_ITER] = make_weights(
+                pd.weights_iter_desc(), {L, D, C, G, C}, tag::ldigo, 2);
+        args[DNNL_ARG_BIAS] = make_weights(
+                pd.bias_desc(), {L, D, G, C}, tag::ldgo, 3);
+        args[DNNL_ARG_DST_LAYER] = memory(dst_layer_md, eng);
+        args[DNNL_ARG_DST_ITER] = memory(states_md, eng);
+        if (is_lstm) {
+            args[DNNL_ARG_SRC_ITER_C] = make_mem(states_md, src_iter_c);
+            args[DNNL_ARG_DST_ITER_C] = memory(states_md, eng);
+        }
+        if (seq_lengths) {
+            memory m(pd.seq_lengths_desc(), eng);
+            std::copy(seq_lengths->begin(), seq_lengths->end(),
+                    static_cast<int32_t *>(m.get_data_handle()));
+            args[DNNL_ARG_SEQ_LENGTHS] = m;
+        }
+        prim.execute(strm, args);
+        strm.wait();
+
+        result_t res;
+        res.dst_layer = to_vector(args[DNNL_ARG_DST_LAYER]);
+        res.dst_iter = to_vector(args[DNNL_ARG_DST_ITER]);
+        if (is_lstm) res.dst_iter_c = to_vector(args[DNNL_ARG_DST_ITER_C]);
+        return res;
+    }
+
+    void test(bool is_lstm, rnn_direction dir) {
+        const memory::dim T = 6, MB = 5;
+        const memory::dim D
+                = dir == rnn_direction::bidirectional_concat ? 2 : 1;
+        // Unsorted lengths, with an empty and a full sequence.
+        const std::vector<int32_t> lengths = {4, 6, 0, 1, 3};
+
+        const auto src_layer = random_data(T * MB * C, 4);
+        const auto src_iter = random_data(L * D * MB * C, 5);
+        const auto src_iter_c = random_data(L * D * MB * C, 6);
+        const auto res = run(is_lstm, dir, T, MB, src_layer, src_iter,
+                src_iter_c, &lengths);
+
+        for (memory::dim b = 0; b < MB; b++) {
+            const memory::dim len = lengths[b];
+            for_(memory::dim t = len; t < T; t++)
+            for (memory::dim c = 0; c < D * C; c++)
+                ASSERT_EQ(res.dst_layer[(t * MB + b) * D * C + c], 0.f);
+
+            // Inputs of the sample, truncated to its length.
+            std::vector<float> b_src_layer, b_src_iter, b_src_iter_c;
+            for (memory::dim t = 0; t < len; t++)
+                b_src_layer.insert(b_src_layer.end(),
+                        src_layer.begin() + (t * MB + b) * C,
+                        src_layer.begin() + (t * MB + b + 1) * C);
+            for (memory::dim ld = 0; ld < L * D; ld++) {
+                b_src_iter.insert(b_src_iter.end(),
+                        src_iter.begin() + (ld * MB + b) * C,
+                        src_iter.begin() + (ld * MB + b + 1) * C);
+                b_src_iter_c.insert(b_src_iter_c.end(),
+                        src_iter_c.begin() + (ld * MB + b) * C,
+                        src_iter_c.begin() + (ld * MB + b + 1) * C);
+            }
+
+            // An empty sequence forwards its input states.
+            const auto ref = len > 0 ? run(is_lstm, dir, len, 1, b_src_layer,
+                                             b_src_iter, b_src_iter_c, nullptr)
+                                     : result_t {{}, b_src_iter, b_src_iter_c};
+
+            for_(memory::dim t = 0; t < len; t++)
+            for (memory::dim c = 0; c < D * C; c++)
+                ASSERT_NEAR(res.dst_layer[(t * MB + b) * D * C + c],
+                        ref.dst_layer[t * D * C + c], 1e-5f)
+                        << "dst_layer t:" << t << " mb:" << b << " c:" << c;
+            for_(memory::dim ld = 0; ld < L * D; ld++)
+            for (memory::dim c = 0; c < C; c++) {
+                ASSERT_NEAR(res.dst_iter[(ld * MB + b) * C + c],
+                        ref.dst_iter[ld * C + c], 1e-5f)
+                        << "dst_iter ld:" << ld << " mb:" << b << " c:" << c;
+                if (!is_lstm) continue;
+                ASSERT_NEAR(res.dst_iter_c[(ld * MB + b) * C + c],
+                        ref.dst_iter_c[ld * C + c], 1e-5f)
+                        << "dst_iter_c ld:" << ld << " mb:" << b << " c:" << c;
+            }
+        }
+    }
+
+    engine eng;
+    stream strm;
+};
+
+TEST_F(rnn_seq_lengths_test_t, LSTM) {
+    test(true, rnn_direction::unidirectional_left2right);
+    test(true, rnn_direction::unidirectional_right2left);
+    test(true, rnn_direction::bidirectional_concat);
+}
+
+TEST_F(rnn_seq_lengths_test_t, GRU) {
+    test(false, rnn_direction::unidirectional_left2right);
+    test(false, rnn_direction::bidirectional_concat);
+}
+
+TEST_F(rnn_seq_lengths_test_t, TrainingIsNotSupported) {
+    const memory::desc src_layer_md({4, 2, C}, dt::f32, tag::tnc);
+    const memory::desc states_md({1, 1, 2, C}, dt::f32, tag::ldnc);
+    const memory::desc wei_md({1, 1, C, 3, C}, dt::f32, tag::any);
+    const memory::desc bias_md({1, 1, 3, C}, dt::f32, tag::ldgo);
+    EXPECT_ANY_THROW(gru_forward::primitive_desc(eng,
+            prop_kind::forward_training,
+            rnn_direction::unidirectional_left2right, src_layer_md, states_md,
+            wei_md, wei_md, bias_md, src_layer_md, states_md,
+            rnn_flags::seq_lengths));
+}
+
 } // namespace dnnl